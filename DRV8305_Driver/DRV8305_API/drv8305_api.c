@@ -38,8 +38,12 @@
 #include "DRV8305_Config/drv8305_configuration.h"
 #include "DRV8305_Control_Registers/drv8305_control_registers_definitions.h"
 #include "drv8305_api.h"
+#include "drv8305_dispatch.h"
+#include "drv8305_timing.h"
+#include "drv8305_trace_hook.h"
 
 #include "DRV8305_Status_Registers/drv8305_status_registers_handlers.h"
+#include "DRV8305_Status_Registers/drv8305_status_registers_decoder.h"
 #include "DRV8305_Control_Registers/drv8305_control_registers_handlers.h"
 
 /* -------------------------------- FUNCTION PROTOTYPES -------------------------------- */
@@ -52,14 +56,28 @@ DRV8305_PRIVATE void     drv8305_status_sm_go_to_next_state       (drv8305_user_
 DRV8305_PRIVATE void     drv8305_control_sm_go_to_next_state      (drv8305_user_object_t *self, drv8305_control_sm_state_e next_state, uint32_t delay_time);
 DRV8305_PRIVATE uint16_t drv8305_spi_write_packet_create          (drv8305_register_types_t register_type, uint16_t data);
 DRV8305_PRIVATE uint16_t drv8305_spi_read_packet_create           (drv8305_register_types_t register_type);
-DRV8305_PRIVATE uint16_t drv8305_spi_response_packet_create       (uint16_t data);
-DRV8305_PRIVATE uint16_t drv8305_control_register_05_parser       (drv8305_user_object_t *self);
-DRV8305_PRIVATE uint16_t drv8305_control_register_06_parser       (drv8305_user_object_t *self);
-DRV8305_PRIVATE uint16_t drv8305_control_register_07_parser       (drv8305_user_object_t *self);
-DRV8305_PRIVATE uint16_t drv8305_control_register_09_parser       (drv8305_user_object_t *self);
-DRV8305_PRIVATE uint16_t drv8305_control_register_0A_parser       (drv8305_user_object_t *self);
-DRV8305_PRIVATE uint16_t drv8305_control_register_0B_parser       (drv8305_user_object_t *self);
-DRV8305_PRIVATE uint16_t drv8305_control_register_0C_parser       (drv8305_user_object_t *self);
+DRV8305_PRIVATE void     drv8305_register_snapshot_publish        (drv8305_user_object_t *self);
+DRV8305_PRIVATE uint16_t drv8305_status_register_update           (drv8305_user_object_t *self, uint16_t status_index);
+DRV8305_PRIVATE uint16_t drv8305_status_register_process          (drv8305_user_object_t *self, uint16_t status_index, uint16_t response);
+DRV8305_PRIVATE void     drv8305_status_summary_publish           (drv8305_user_object_t *self);
+DRV8305_PRIVATE void     drv8305_recovery_process_polling         (drv8305_user_object_t *self);
+DRV8305_PRIVATE void     drv8305_recovery_sm_go_to_next_state     (drv8305_user_object_t *self, drv8305_recovery_sm_state_e next_state, uint32_t delay_time);
+DRV8305_PRIVATE drv8305_recovery_status_e drv8305_recovery_classify (drv8305_user_object_t *self);
+DRV8305_PRIVATE bool     drv8305_recovery_schedule                (drv8305_user_object_t *self);
+DRV8305_PRIVATE void     drv8305_recovery_conclude                (drv8305_user_object_t *self);
+DRV8305_PRIVATE void     drv8305_control_register_write_step      (drv8305_user_object_t *self, uint16_t array_index, drv8305_control_sm_state_e next_state);
+DRV8305_PRIVATE void     drv8305_control_register_read_step       (drv8305_user_object_t *self, uint16_t array_index, drv8305_control_sm_state_e next_state);
+DRV8305_PRIVATE void     drv8305_control_register_readback_process(drv8305_user_object_t *self, uint16_t array_index, uint16_t response);
+DRV8305_PRIVATE void     drv8305_configuration_commit_start       (drv8305_user_object_t *self);
+DRV8305_PRIVATE bool     drv8305_configuration_commit_verify      (const drv8305_user_object_t *self);
+DRV8305_PRIVATE bool     drv8305_configuration_commit_conclude    (drv8305_user_object_t *self);
+DRV8305_PRIVATE uint32_t drv8305_control_step_delay               (const drv8305_user_object_t *self);
+DRV8305_PRIVATE bool     drv8305_reset_detect_schedule            (drv8305_user_object_t *self, uint16_t raised);
+DRV8305_PRIVATE void     drv8305_reset_detect_readback            (drv8305_user_object_t *self, uint16_t array_index);
+DRV8305_PRIVATE bool     drv8305_reset_detect_conclude            (drv8305_user_object_t *self);
+DRV8305_PRIVATE void     drv8305_reset_detect_reprogram           (drv8305_user_object_t *self, uint16_t register_mask);
+DRV8305_PRIVATE void     drv8305_scrubber_earn                    (drv8305_user_object_t *self);
+DRV8305_PRIVATE bool     drv8305_scrubber_step                    (drv8305_user_object_t *self);
 
 /**
  * @brief Array of all DRV8305 register types (addresses) to be managed
@@ -82,6 +100,38 @@ DRV8305_PRIVATE const drv8305_register_types_t drv8305_registers[DRV8305_NUMBER_
      DRV8305_CONTROL_0C
 };
 
+/**@brief: Readback bits compared against the programmed word, image word order **/
+DRV8305_PRIVATE const uint16_t drv8305_control_verify_mask[DRV8305_NUMBER_OF_CONTROL_REGISTERS] =
+{
+    DRV8305_CTRL05_VERIFY_MASK,
+    DRV8305_CTRL06_VERIFY_MASK,
+    DRV8305_CTRL07_VERIFY_MASK,
+    DRV8305_CTRL09_VERIFY_MASK,
+    DRV8305_CTRL0A_VERIFY_MASK,
+    DRV8305_CTRL0B_VERIFY_MASK,
+    DRV8305_CTRL0C_VERIFY_MASK
+};
+
+/**@brief: Datasheet reset words, what a control register holds after a device reset **/
+DRV8305_PRIVATE DRV8305_REGISTER_IMAGE_DEFINE(drv8305_reset_image,
+    (DRV8305_TDRIVE_1780NS, DRV8305_ISINK_60MA, DRV8305_ISOURCE_50MA),
+    (DRV8305_TDRIVE_1780NS, DRV8305_ISINK_60MA, DRV8305_ISOURCE_50MA),
+    (DRV8305_VCPH_FREQ_518KHZ, DRV8305_COMM_ACTIVE_FREEWHEEL, DRV8305_PWM_6_INPUTS, DRV8305_DEADTIME_52NS, DRV8305_TBLANK_1_75US, DRV8305_TVDS_3_5US),
+    (0, 0, 0, 0, DRV8305_WD_DLY_20MS, 0, 0, 0, 0, 0),
+    (0, 0, 0, DRV8305_CS_BLANK_0NS, DRV8305_GAIN_10V_V, DRV8305_GAIN_10V_V, DRV8305_GAIN_10V_V),
+    (DRV8305_VREF_SCALE_DIV2, DRV8305_SLEEP_DLY_10US, 0, DRV8305_VREG_UV_70PCT),
+    (DRV8305_VDS_1_175V, DRV8305_VDS_MODE_LATCH_SHUTDOWN));
+
+/**@brief: Latched faults cleared by a CLR_FLTS pulse when no recoverable mask is given (0x01 is never recovered) **/
+DRV8305_PRIVATE const uint16_t drv8305_recovery_default_mask[DRV8305_NUMBER_OF_STATUS_REGISTERS] =
+{
+    0,
+    DRV8305_VDS_SNS_A_OCP | DRV8305_VDS_SNS_B_OCP | DRV8305_VDS_SNS_C_OCP |
+    DRV8305_VDS_LC | DRV8305_VDS_HC | DRV8305_VDS_LB | DRV8305_VDS_HB | DRV8305_VDS_LA | DRV8305_VDS_HA,
+    DRV8305_IC_VCPH_OVLO | DRV8305_IC_VCPH_UVLO2 | DRV8305_IC_VCP_LSD_UVLO2 | DRV8305_IC_OTSD | DRV8305_IC_WD_FAULT | DRV8305_IC_PVDD_UVLO2,
+    DRV8305_VGS_LC | DRV8305_VGS_HC | DRV8305_VGS_LB | DRV8305_VGS_HB | DRV8305_VGS_LA | DRV8305_VGS_HA
+};
+
 /**
  * @brief Default DRV8305 configuration instance
  * @details Defined in drv8305_configuration.c; used for storing and accessing current configuration settings.
@@ -96,13 +146,16 @@ extern drv8305_configuration_t default_configuration;
  *          Calls wake_up and disable IO at startup.
  * @param[in,out] self Pointer to DRV8305 user object
  * @return None
- * @note Validates all required callbacks are non-NULL before initialization
+ * @note Validates all required callbacks are non-NULL before initialization, unless built
+ *       with DRV8305_STATIC_DISPATCH (drv8305_dispatch.h)
  * @see drv8305_api_initialize (declaration in header)
  */
 DRV8305_PUBLIC void drv8305_api_initialize(drv8305_user_object_t *self)
 {
-    if(self                                                            == NULL ||
-       self->hw_callbacks.drv8305_disable_io                           == NULL ||
+    if(self == NULL) { return; }
+
+#if !defined(DRV8305_STATIC_DISPATCH)
+    if(self->hw_callbacks.drv8305_disable_io                           == NULL ||
        self->hw_callbacks.drv8305_enable_io                            == NULL || 
        self->hw_callbacks.drv8305_sleep_io                             == NULL || 
        self->hw_callbacks.drv8305_wake_up_io                           == NULL ||
@@ -111,6 +164,7 @@ DRV8305_PUBLIC void drv8305_api_initialize(drv8305_user_object_t *self)
     { 
         return; 
     }
+#endif
 
      /**@Todo: This status could be changed by user. If you made an calculation on start this would be true because "enable" pin must be HIGH on first start */
     self->enable_pin_status                                  = true;
@@ -119,6 +173,7 @@ DRV8305_PUBLIC void drv8305_api_initialize(drv8305_user_object_t *self)
 
     self->state.cycle_time                                   = 0;
     self->state.delay_time                                   = 0;
+    self->state.system_time                                  = 0;
 
     self->configuration_confirmation_flags.hs_gate_drive     = false;
     self->configuration_confirmation_flags.ls_gate_drive     = false;
@@ -131,10 +186,23 @@ DRV8305_PUBLIC void drv8305_api_initialize(drv8305_user_object_t *self)
     self->state.main_state                                   = DRV8305_IDLE_STATE;
     self->state.status_state                                 = DRV8305_SM_STATUS_WARNING_REG;
     self->state.control_state                                = DRV8305_SM_CONTROL_HS_GATE_DRIVE_REG;
+    self->state.recovery_state                               = DRV8305_SM_RECOVERY_CLEAR_FAULTS;
+
+    drv8305_configuration_pack(&self->config, drv8305_get_configuration());
+    self->staged                                             = self->config;
+    self->commit.status                                      = DRV8305_COMMIT_IDLE;
+    self->commit.register_mask                               = 0;
+    self->control_write_mask                                 = DRV8305_CONTROL_REGISTER_ALL;
 
-    drv8305_configuration_t* temp_config                     = drv8305_get_configuration();
-    memset(&self->config, 0, sizeof(drv8305_configuration_t));
-    memcpy(&self->config, temp_config, sizeof(drv8305_configuration_t));
+    memset(&self->reset_detect, 0, sizeof(drv8305_reset_detect_t));
+    memset(&self->scrubber, 0, sizeof(drv8305_scrubber_t));
+    self->scrubber.budget                                    = DRV8305_SCRUB_BUDGET_PERCENT;
+
+#if defined(DRV8305_RUNTIME_TIMING)
+    self->timing.control_gap_ms                              = DRV8305_CONTROL_REGISTER_GAP_MS;
+    self->timing.status_gap_ms                               = DRV8305_STATUS_REGISTER_GAP_MS;
+    self->timing.reset_gap_ms                                = DRV8305_RESET_REGISTER_GAP_MS;
+#endif
 
     for(int index = 0; index < DRV8305_NUMBER_OF_REGISTERS; index++)
     {
@@ -142,6 +210,33 @@ DRV8305_PUBLIC void drv8305_api_initialize(drv8305_user_object_t *self)
         self->register_manager[index].type = drv8305_registers[index];        
     }
 
+    drv8305_snapshot_init(&self->snapshot);
+
+    for(int index = 0; index < DRV8305_NUMBER_OF_STATUS_REGISTERS; index++)
+    {
+        self->status_edges.previous[index] = 0;
+    }
+
+    drv8305_event_ring_init(&self->events);
+#if defined(DRV8305_POSTMORTEM_EVENTS)
+    drv8305_event_history_init(&self->event_history);
+#endif
+
+#if defined(DRV8305_SPI_TRACE)
+    drv8305_trace_ring_init(&self->trace);
+#endif
+
+#if defined(DRV8305_STATISTICS)
+    drv8305_statistics_reset(&self->statistics);
+#endif
+
+    memset(&self->status_summary, 0, sizeof(drv8305_status_summary_t));
+
+    /**@brief: Recovery stays off until drv8305_api_set_recovery_policy() is called after this **/
+    memset(&self->recovery, 0, sizeof(drv8305_recovery_t));
+    self->recovery.status                                    = DRV8305_RECOVERY_DISABLED;
+    self->recovery.backoff                                   = DRV8305_RECOVERY_BACKOFF_MIN_MS;
+
     /**@brief: This lines has been closed because given HIGH on start the enable and drv_wake pins! **/
 //    drv8305_api_ic_wake_up(self);
 //    drv8305_api_ic_disable(self);
@@ -173,10 +268,19 @@ DRV8305_PUBLIC void drv8305_api_master_sm_polling(drv8305_user_object_t *self)
 
         case DRV8305_IDLE_STATE:
         {
-            if(self->state.cycle_time >= DRV8305_STATUS_POLLING_INTERVAL_MS)
+            if(self->commit.status == DRV8305_COMMIT_PENDING)
+            {
+                drv8305_configuration_commit_start(self);
+            }
+            else if(self->state.cycle_time >= DRV8305_STATUS_POLLING_INTERVAL_MS)
             {
                 drv8305_main_sm_go_to_next_state(self, DRV8305_STATUS_STATE, DRV8305_REGISTER_SWITCH_DELAY_MS);
             }
+            else
+            {
+                // Scrub slots only while no status scan is due
+                (void)drv8305_scrubber_step(self);
+            }
             break;
         }
 
@@ -194,12 +298,24 @@ DRV8305_PUBLIC void drv8305_api_master_sm_polling(drv8305_user_object_t *self)
             break;
         }
 
+        case DRV8305_RECOVERY_STATE:
+        {
+            drv8305_recovery_process_polling(self);
+
+            break;
+        }
+
         case DRV8305_DELAY_STATE:
         {
             if(self->state.cycle_time >= self->state.delay_time)
             {
                 self->state.main_state  = self->state.next_main_state;
             }
+            else if(self->state.next_main_state == DRV8305_IDLE_STATE)
+            {
+                // Waiting between two scans: the bus is free for a scrub slot
+                (void)drv8305_scrubber_step(self);
+            }
 
             break;
         } 
@@ -216,6 +332,7 @@ DRV8305_PUBLIC void drv8305_api_master_sm_polling(drv8305_user_object_t *self)
 DRV8305_PUBLIC void drv8305_api_timer(drv8305_user_object_t *self)
 {
     self->state.cycle_time++;
+    self->state.system_time++;
 }
 
 /**
@@ -229,7 +346,7 @@ DRV8305_PUBLIC void drv8305_api_ic_enable(drv8305_user_object_t *self)
 {
     if(self->enable_pin_status == true) { return; }
     self->enable_pin_status = true;
-    self->hw_callbacks.drv8305_enable_io();
+    DRV8305_DISPATCH_ENABLE_IO(self);
 }
 
 /**
@@ -243,7 +360,7 @@ DRV8305_PUBLIC void drv8305_api_ic_disable(drv8305_user_object_t *self)
 {
     if(self->enable_pin_status == false) { return; }
     self->enable_pin_status = false;
-    self->hw_callbacks.drv8305_disable_io();
+    DRV8305_DISPATCH_DISABLE_IO(self);
 }
 
 /**
@@ -257,7 +374,7 @@ DRV8305_PUBLIC void drv8305_api_ic_sleep(drv8305_user_object_t *self)
 {
     if(self->drv_wake_pin_status == false) { return; }
     self->drv_wake_pin_status = false;
-    self->hw_callbacks.drv8305_sleep_io();
+    DRV8305_DISPATCH_SLEEP_IO(self);
 }
 
 /**
@@ -271,7 +388,7 @@ DRV8305_PUBLIC void drv8305_api_ic_wake_up(drv8305_user_object_t *self)
 {
     if(self->drv_wake_pin_status == true) { return; }
     self->drv_wake_pin_status = true;
-    self->hw_callbacks.drv8305_wake_up_io();
+    DRV8305_DISPATCH_WAKE_UP_IO(self);
 }
 
 /**
@@ -310,6 +427,8 @@ DRV8305_PUBLIC void drv8305_set_configuration(drv8305_configuration_t *cfg)
  */
 DRV8305_PUBLIC void drv8305_api_confirm_configuration(drv8305_user_object_t *self)
 {
+    self->control_write_mask = DRV8305_CONTROL_REGISTER_ALL;
+
     drv8305_control_sm_go_to_next_state(self, DRV8305_SM_CONTROL_HS_GATE_DRIVE_REG, DRV8305_REGISTER_SWITCH_DELAY_MS);
     drv8305_main_sm_go_to_next_state(self, DRV8305_CONTROL_STATE, DRV8305_REGISTER_SWITCH_DELAY_MS);
 }
@@ -339,396 +458,1586 @@ DRV8305_PUBLIC bool drv8305_api_is_configuration_confirm(drv8305_user_object_t *
     }
 }
 
-/* -------------------------------- PRIVATE FUNCTIONS -------------------------------- */
-
 /**
- * @brief Process status register reading state machine (internal)
- * @details Sequentially reads all status registers (0x01 through 0x04) and triggers
- *          corresponding status callbacks for each register.
+ * @brief Select precomputed control register image (implementation)
  * @param[in,out] self Pointer to DRV8305 user object
+ * @param[in] image Const image, NULL to pack config again
  * @return None
- * @note Internal state machine handling - called from drv8305_api_master_sm_polling()
+ * @see drv8305_api_set_register_image (declaration)
  */
-DRV8305_PRIVATE void drv8305_status_register_process_polling(drv8305_user_object_t *self)
+DRV8305_PUBLIC void drv8305_api_set_register_image(drv8305_user_object_t *self, const drv8305_register_image_t *image)
 {
-    switch (self->state.status_state)
-    {
-        case DRV8305_SM_STATUS_WARNING_REG:
-        {
-            self->register_manager[DRV8305_STATUS_01_ARRAY_INDEX].data = drv8305_spi_read_command_process(self, self->register_manager[DRV8305_STATUS_01_ARRAY_INDEX].type);
-            self->status_callbacks.drv8305_warning_register_cb(self, self->register_manager[DRV8305_STATUS_01_ARRAY_INDEX].data);
-
-            drv8305_status_sm_go_to_next_state(self, DRV8305_SM_STATUS_OV_VDS_REG, DRV8305_STANDARD_TASK_DELAY_TIMEOUT);
-
-            break;
-        }
-
-        case DRV8305_SM_STATUS_OV_VDS_REG:
-        {
-            self->register_manager[DRV8305_STATUS_02_ARRAY_INDEX].data = drv8305_spi_read_command_process(self, self->register_manager[DRV8305_STATUS_02_ARRAY_INDEX].type);
-            self->status_callbacks.drv8305_ov_vds_register_cb(self, self->register_manager[DRV8305_STATUS_02_ARRAY_INDEX].data);
-
-            drv8305_status_sm_go_to_next_state(self, DRV8305_SM_STATUS_IC_FAULTS_REG, DRV8305_STANDARD_TASK_DELAY_TIMEOUT);
-
-            break;
-        }
-
-        case DRV8305_SM_STATUS_IC_FAULTS_REG:
-        {
-            self->register_manager[DRV8305_STATUS_03_ARRAY_INDEX].data = drv8305_spi_read_command_process(self, self->register_manager[DRV8305_STATUS_03_ARRAY_INDEX].type);
-            self->status_callbacks.drv8305_ic_faults_register_cb(self, self->register_manager[DRV8305_STATUS_03_ARRAY_INDEX].data);
-
-            drv8305_status_sm_go_to_next_state(self, DRV8305_SM_STATUS_VGS_FAULTS_REG, DRV8305_STANDARD_TASK_DELAY_TIMEOUT);
-
-            break;
-        }
-
-        case DRV8305_SM_STATUS_VGS_FAULTS_REG:
-        {
-            self->register_manager[DRV8305_STATUS_04_ARRAY_INDEX].data = drv8305_spi_read_command_process(self, self->register_manager[DRV8305_STATUS_04_ARRAY_INDEX].type);
-            self->status_callbacks.drv8305_vgs_faults_register_cb(self, self->register_manager[DRV8305_STATUS_04_ARRAY_INDEX].data);
+    if(!self) { return; }
 
-            drv8305_status_sm_go_to_next_state(self, DRV8305_SM_STATUS_WARNING_REG, DRV8305_STANDARD_TASK_DELAY_TIMEOUT);
-            drv8305_main_sm_go_to_next_state(self, DRV8305_IDLE_STATE, DRV8305_STANDARD_TASK_DELAY_TIMEOUT);
+    self->register_image = image;
+}
 
-            break;
-        }
+/**
+ * @brief Get programmed control register word (implementation)
+ * @details An attached image takes precedence over the packed working copy (config).
+ * @param[in] self Pointer to DRV8305 user object
+ * @param[in] array_index Control register index (DRV8305_CONTROL_xx_ARRAY_INDEX)
+ * @return uint16_t Register data bits 10:0, 0 if out of range
+ * @see drv8305_api_get_control_word (declaration)
+ */
+DRV8305_PUBLIC uint16_t drv8305_api_get_control_word(const drv8305_user_object_t *self, uint16_t array_index)
+{
+    if(!self || array_index < DRV8305_CONTROL_05_ARRAY_INDEX || array_index > DRV8305_CONTROL_0C_ARRAY_INDEX) { return 0; }
 
-        case DRV8305_SM_STATUS_CYCLE_DELAY:
-        {
-            if(self->state.cycle_time >= self->state.delay_time)
-            {
-                self->state.status_state = self->state.next_status_state;
-            }
+    const drv8305_register_image_t *image = (self->register_image) ? self->register_image : &self->config;
 
-            break;
-        } 
-    }
+    return image->word[DRV8305_REGISTER_IMAGE_INDEX(array_index)];
 }
 
 /**
- * @brief Process control register programming state machine (internal)
- * @details Sequentially writes all control registers (0x05, 0x06, 0x07, 0x09, 0x0A, 0x0B, 0x0C)
- *          with configuration values and triggers corresponding control callbacks.
+ * @brief Get staged configuration profile (implementation)
  * @param[in,out] self Pointer to DRV8305 user object
- * @return None
- * @note Internal state machine handling - called from drv8305_api_master_sm_polling()
+ * @return drv8305_packed_configuration_t* Staged profile, NULL if self is NULL
+ * @see drv8305_api_get_staged_configuration (declaration)
  */
-DRV8305_PRIVATE void drv8305_control_register_process_polling(drv8305_user_object_t *self)
+DRV8305_PUBLIC drv8305_packed_configuration_t* drv8305_api_get_staged_configuration(drv8305_user_object_t *self)
 {
-    switch (self->state.control_state)
-    {
-        /**@brief: Control Register Write States */ 
-
-        case DRV8305_SM_CONTROL_HS_GATE_DRIVE_REG:
-        {
-            self->register_manager[DRV8305_CONTROL_05_ARRAY_INDEX].data = drv8305_control_register_05_parser(self);
-            self->register_manager[DRV8305_CONTROL_05_ARRAY_INDEX].data = drv8305_spi_write_command_process(self, self->register_manager[DRV8305_CONTROL_05_ARRAY_INDEX].type, self->register_manager[DRV8305_CONTROL_05_ARRAY_INDEX].data);
-            
-            drv8305_control_sm_go_to_next_state(self, DRV8305_SM_CONTROL_LS_GATE_DRIVE_REG, DRV8305_REGISTER_SWITCH_DELAY_MS);
-
-            break;
-        }
-
-        case DRV8305_SM_CONTROL_LS_GATE_DRIVE_REG:
-        {
-            self->register_manager[DRV8305_CONTROL_06_ARRAY_INDEX].data = drv8305_control_register_06_parser(self);
-            self->register_manager[DRV8305_CONTROL_06_ARRAY_INDEX].data = drv8305_spi_write_command_process(self, self->register_manager[DRV8305_CONTROL_06_ARRAY_INDEX].type, self->register_manager[DRV8305_CONTROL_06_ARRAY_INDEX].data);
-            
-            drv8305_control_sm_go_to_next_state(self, DRV8305_SM_CONTROL_GATE_DRIVE_REG, DRV8305_REGISTER_SWITCH_DELAY_MS);
-
-            break;
-        }
-        
-        case DRV8305_SM_CONTROL_GATE_DRIVE_REG:
-        {
-            self->register_manager[DRV8305_CONTROL_07_ARRAY_INDEX].data = drv8305_control_register_07_parser(self);
-            self->register_manager[DRV8305_CONTROL_07_ARRAY_INDEX].data = drv8305_spi_write_command_process(self, self->register_manager[DRV8305_CONTROL_07_ARRAY_INDEX].type, self->register_manager[DRV8305_CONTROL_07_ARRAY_INDEX].data);
-            
-            drv8305_control_sm_go_to_next_state(self, DRV8305_SM_CONTROL_IC_OPERATION_REG, DRV8305_REGISTER_SWITCH_DELAY_MS);
-
-            break;
-        }
-        
-        case DRV8305_SM_CONTROL_IC_OPERATION_REG:
-        {
-            self->register_manager[DRV8305_CONTROL_09_ARRAY_INDEX].data = drv8305_control_register_09_parser(self);
-            self->register_manager[DRV8305_CONTROL_09_ARRAY_INDEX].data = drv8305_spi_write_command_process(self, self->register_manager[DRV8305_CONTROL_09_ARRAY_INDEX].type, self->register_manager[DRV8305_CONTROL_09_ARRAY_INDEX].data);
-            
-            drv8305_control_sm_go_to_next_state(self, DRV8305_SM_CONTROL_SHUNT_AMPLIFIER_REG, DRV8305_REGISTER_SWITCH_DELAY_MS);
-
-            break;
-        }
-        
-        case DRV8305_SM_CONTROL_SHUNT_AMPLIFIER_REG:
-        {
-            self->register_manager[DRV8305_CONTROL_0A_ARRAY_INDEX].data = drv8305_control_register_0A_parser(self);
-            self->register_manager[DRV8305_CONTROL_0A_ARRAY_INDEX].data = drv8305_spi_write_command_process(self, self->register_manager[DRV8305_CONTROL_0A_ARRAY_INDEX].type, self->register_manager[DRV8305_CONTROL_0A_ARRAY_INDEX].data);
-            
-            drv8305_control_sm_go_to_next_state(self, DRV8305_SM_CONTROL_VOLTAGE_REGULATOR_REG, DRV8305_REGISTER_SWITCH_DELAY_MS);
+    if(!self) { return NULL; }
 
-            break;
-        }
-        
-        case DRV8305_SM_CONTROL_VOLTAGE_REGULATOR_REG:
-        {
-            self->register_manager[DRV8305_CONTROL_0B_ARRAY_INDEX].data = drv8305_control_register_0B_parser(self);
-            self->register_manager[DRV8305_CONTROL_0B_ARRAY_INDEX].data = drv8305_spi_write_command_process(self, self->register_manager[DRV8305_CONTROL_0B_ARRAY_INDEX].type, self->register_manager[DRV8305_CONTROL_0B_ARRAY_INDEX].data);
-            
-            drv8305_control_sm_go_to_next_state(self, DRV8305_SM_CONTROL_VDS_SENSE_REG, DRV8305_REGISTER_SWITCH_DELAY_MS);    
+    return &self->staged;
+}
 
-            break;
-        }
+/**
+ * @brief Request configuration commit (implementation)
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @return true if queued, false if a commit is already pending or in progress
+ * @see drv8305_api_commit_configuration (declaration)
+ */
+DRV8305_PUBLIC bool drv8305_api_commit_configuration(drv8305_user_object_t *self)
+{
+    if(!self) { return false; }
 
-        case DRV8305_SM_CONTROL_VDS_SENSE_REG:
-        {
-            self->register_manager[DRV8305_CONTROL_0C_ARRAY_INDEX].data = drv8305_control_register_0C_parser(self);
-            self->register_manager[DRV8305_CONTROL_0C_ARRAY_INDEX].data = drv8305_spi_write_command_process(self, self->register_manager[DRV8305_CONTROL_0C_ARRAY_INDEX].type, self->register_manager[DRV8305_CONTROL_0C_ARRAY_INDEX].data);
-            
-            drv8305_control_sm_go_to_next_state(self, DRV8305_SM_READ_CONTROL_HS_GATE_DRIVE_REG, DRV8305_REGISTER_SWITCH_DELAY_MS);                
+    if(self->commit.status == DRV8305_COMMIT_PENDING ||
+       self->commit.status == DRV8305_COMMIT_WRITING ||
+       self->commit.status == DRV8305_COMMIT_ROLLING_BACK)
+    {
+        return false;
+    }
 
-            break;
-        }
+    self->commit.status = DRV8305_COMMIT_PENDING;
 
-        /**@brief: Control Register Read States */ 
+    return true;
+}
 
-        case DRV8305_SM_READ_CONTROL_HS_GATE_DRIVE_REG:
-        {
-            self->register_manager[DRV8305_CONTROL_05_ARRAY_INDEX].data = drv8305_spi_read_command_process(self, self->register_manager[DRV8305_CONTROL_05_ARRAY_INDEX].type);
-            self->control_callbacks.drv8305_hs_gate_drive_control_register_cb(self, self->register_manager[DRV8305_CONTROL_05_ARRAY_INDEX].data);
+/**
+ * @brief Get configuration commit state (implementation)
+ * @param[in] self Pointer to DRV8305 user object
+ * @return drv8305_commit_status_e Commit state
+ * @see drv8305_api_get_commit_status (declaration)
+ */
+DRV8305_PUBLIC drv8305_commit_status_e drv8305_api_get_commit_status(const drv8305_user_object_t *self)
+{
+    if(!self) { return DRV8305_COMMIT_IDLE; }
 
-            drv8305_control_sm_go_to_next_state(self, DRV8305_SM_READ_CONTROL_LS_GATE_DRIVE_REG, DRV8305_REGISTER_SWITCH_DELAY_MS);
+    return self->commit.status;
+}
 
-            break;
-        }
+/**
+ * @brief Compare configuration with readback (implementation)
+ * @param[in] self Pointer to DRV8305 user object
+ * @param[in] desired Configuration to compare, NULL for the programmed words
+ * @param[out] diff Changed registers and bits (may be NULL)
+ * @return uint16_t Register mask
+ * @see drv8305_api_diff_readback (declaration)
+ */
+DRV8305_PUBLIC uint16_t drv8305_api_diff_readback(const drv8305_user_object_t *self, const drv8305_packed_configuration_t *desired, drv8305_configuration_diff_t *diff)
+{
+    drv8305_packed_configuration_t expected;
+    drv8305_packed_configuration_t readback;
 
-        case DRV8305_SM_READ_CONTROL_LS_GATE_DRIVE_REG:
-        {
-            self->register_manager[DRV8305_CONTROL_06_ARRAY_INDEX].data = drv8305_spi_read_command_process(self, self->register_manager[DRV8305_CONTROL_06_ARRAY_INDEX].type);
-            self->control_callbacks.drv8305_ls_gate_drive_control_register_cb(self, self->register_manager[DRV8305_CONTROL_06_ARRAY_INDEX].data);
+    if(!self) { return 0; }
 
-            drv8305_control_sm_go_to_next_state(self, DRV8305_SM_READ_CONTROL_GATE_DRIVE_REG, DRV8305_REGISTER_SWITCH_DELAY_MS);
+    for(int index = 0; index < DRV8305_NUMBER_OF_CONTROL_REGISTERS; index++)
+    {
+        uint16_t word = (desired) ? desired->word[index] : drv8305_api_get_control_word(self, (uint16_t)(DRV8305_CONTROL_05_ARRAY_INDEX + index));
 
-            break;
-        }
+        expected.word[index] = (uint16_t)(word & drv8305_control_verify_mask[index]);
+        readback.word[index] = (uint16_t)(self->register_manager[DRV8305_CONTROL_05_ARRAY_INDEX + index].data & drv8305_control_verify_mask[index]);
+    }
 
-        case DRV8305_SM_READ_CONTROL_GATE_DRIVE_REG:
-        {
-            self->register_manager[DRV8305_CONTROL_07_ARRAY_INDEX].data = drv8305_spi_read_command_process(self, self->register_manager[DRV8305_CONTROL_07_ARRAY_INDEX].type);
-            self->control_callbacks.drv8305_gate_drive_control_register_cb(self, self->register_manager[DRV8305_CONTROL_07_ARRAY_INDEX].data);
+    return drv8305_configuration_diff(diff, &expected, &readback);
+}
 
-            drv8305_control_sm_go_to_next_state(self, DRV8305_SM_READ_CONTROL_IC_OPERATION_REG, DRV8305_REGISTER_SWITCH_DELAY_MS);
+/**
+ * @brief Get coherent register snapshot (implementation)
+ * @param[in] self Pointer to DRV8305 user object
+ * @param[out] snapshot Destination for register image
+ * @return true if a coherent copy was taken, false otherwise
+ * @see drv8305_api_get_register_snapshot (declaration)
+ */
+DRV8305_PUBLIC bool drv8305_api_get_register_snapshot(const drv8305_user_object_t *self, drv8305_snapshot_t *snapshot)
+{
+    if(!self) { return false; }
 
-            break;
-        }
+    return drv8305_snapshot_read(&self->snapshot, snapshot);
+}
 
-        case DRV8305_SM_READ_CONTROL_IC_OPERATION_REG:
-        {
-            self->register_manager[DRV8305_CONTROL_09_ARRAY_INDEX].data = drv8305_spi_read_command_process(self, self->register_manager[DRV8305_CONTROL_09_ARRAY_INDEX].type);
-            self->control_callbacks.drv8305_ic_operation_register_cb(self, self->register_manager[DRV8305_CONTROL_09_ARRAY_INDEX].data);
+/**
+ * @brief Subscribe to status changes (implementation)
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @param[in] callback Change callback
+ * @param[in] interest_mask Per status register interest masks
+ * @return true if subscribed or updated, false if the table is full
+ * @see drv8305_api_status_subscribe (declaration)
+ */
+DRV8305_PUBLIC bool drv8305_api_status_subscribe(drv8305_user_object_t *self, drv8305_status_change_cb_t callback, const uint16_t *interest_mask)
+{
+    if(!self || !callback || !interest_mask) { return false; }
 
-            drv8305_control_sm_go_to_next_state(self, DRV8305_SM_READ_CONTROL_SHUNT_AMPLIFIER_REG, DRV8305_REGISTER_SWITCH_DELAY_MS);
+    drv8305_status_subscriber_t *slot = NULL;
 
-            break;
-        }
+    for(int index = 0; index < DRV8305_STATUS_MAX_SUBSCRIBERS; index++)
+    {
+        drv8305_status_subscriber_t *subscriber = &self->status_edges.subscribers[index];
 
-        case DRV8305_SM_READ_CONTROL_SHUNT_AMPLIFIER_REG:
-        {
-            self->register_manager[DRV8305_CONTROL_0A_ARRAY_INDEX].data = drv8305_spi_read_command_process(self, self->register_manager[DRV8305_CONTROL_0A_ARRAY_INDEX].type);
-            self->control_callbacks.drv8305_shunt_amplifier_control_register_cb(self, self->register_manager[DRV8305_CONTROL_0A_ARRAY_INDEX].data);
+        if(subscriber->callback == callback) { slot = subscriber; break; }
+        if(subscriber->callback == NULL && slot == NULL) { slot = subscriber; }
+    }
 
-            drv8305_control_sm_go_to_next_state(self, DRV8305_SM_READ_CONTROL_VOLTAGE_REGULATOR_REG, DRV8305_REGISTER_SWITCH_DELAY_MS);
+    if(slot == NULL) { return false; }
 
-            break;
-        }
+    for(int index = 0; index < DRV8305_NUMBER_OF_STATUS_REGISTERS; index++)
+    {
+        slot->interest_mask[index] = interest_mask[index] & DRV8305_REGISTER_DATA_MASK;
+    }
 
-        case DRV8305_SM_READ_CONTROL_VOLTAGE_REGULATOR_REG:
-        {
-            self->register_manager[DRV8305_CONTROL_0B_ARRAY_INDEX].data = drv8305_spi_read_command_process(self, self->register_manager[DRV8305_CONTROL_0B_ARRAY_INDEX].type);
-            self->control_callbacks.drv8305_voltage_regulator_control_register_cb(self, self->register_manager[DRV8305_CONTROL_0B_ARRAY_INDEX].data);
+    slot->callback = callback;
 
-            drv8305_control_sm_go_to_next_state(self, DRV8305_SM_READ_CONTROL_VDS_SENSE_REG, DRV8305_REGISTER_SWITCH_DELAY_MS);
+    return true;
+}
 
-            break;
-        }
+/**
+ * @brief Remove status change subscription (implementation)
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @param[in] callback Subscribed callback
+ * @return None
+ * @see drv8305_api_status_unsubscribe (declaration)
+ */
+DRV8305_PUBLIC void drv8305_api_status_unsubscribe(drv8305_user_object_t *self, drv8305_status_change_cb_t callback)
+{
+    if(!self || !callback) { return; }
 
-        case DRV8305_SM_READ_CONTROL_VDS_SENSE_REG:
+    for(int index = 0; index < DRV8305_STATUS_MAX_SUBSCRIBERS; index++)
+    {
+        if(self->status_edges.subscribers[index].callback == callback)
         {
-            self->register_manager[DRV8305_CONTROL_0C_ARRAY_INDEX].data = drv8305_spi_read_command_process(self, self->register_manager[DRV8305_CONTROL_0C_ARRAY_INDEX].type);
-            self->control_callbacks.drv8305_vds_sense_control_register_cb(self, self->register_manager[DRV8305_CONTROL_0C_ARRAY_INDEX].data);
-            
-            drv8305_main_sm_go_to_next_state(self, DRV8305_IDLE_STATE, DRV8305_REGISTER_SWITCH_DELAY_MS);
-
-            break;
+            self->status_edges.subscribers[index].callback = NULL;
         }
-
-
-        case DRV8305_SM_CONTROL_CYCLE_DELAY:
-        {
-            if(self->state.cycle_time >= self->state.delay_time)
-            {
-                self->state.control_state = self->state.next_control_state;
-            }
-
-            break;
-        } 
     }
 }
 
 /**
- * @brief Execute SPI write command and receive response (internal)
- * @details Creates SPI write packet for register, transmits via callback, and returns
- *          parsed response data from hardware SPI receive callback.
- * @param[in] self Pointer to DRV8305 user object
- * @param[in] drv8305_register Register address to write
- * @param[in] data Data value to write to register
- * @return uint16_t SPI response data (lower 11 bits valid)
- * @note Uses hardware SPI callbacks configured during initialization
+ * @brief Pop oldest status change event (implementation)
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @param[out] event Destination of the event
+ * @return true if an event was returned
+ * @see drv8305_api_pop_event (declaration)
  */
-DRV8305_PRIVATE uint16_t drv8305_spi_write_command_process(drv8305_user_object_t *self, drv8305_register_types_t drv8305_register, uint16_t data)
+DRV8305_PUBLIC bool drv8305_api_pop_event(drv8305_user_object_t *self, drv8305_event_t *event)
 {
-    uint16_t drv8305_write_packet = drv8305_spi_write_packet_create(drv8305_register, data);
-    uint16_t drv8305_read_packet = self->hw_callbacks.drv8305_spi_write_and_read_from_register_cb(drv8305_write_packet);
+    if(!self) { return false; }
 
-    return drv8305_read_packet;
+    return drv8305_event_ring_pop(&self->events, event);
 }
 
 /**
- * @brief Execute SPI read command and receive response (internal)
- * @details Creates SPI read packet for register, transmits via callback, and returns
- *          parsed response data from hardware SPI receive callback.
+ * @brief Get dropped status event count (implementation)
  * @param[in] self Pointer to DRV8305 user object
- * @param[in] drv8305_register Register address to read
- * @return uint16_t SPI response data containing register contents (lower 11 bits)
- * @note Uses hardware SPI callbacks configured during initialization
+ * @return uint32_t Dropped events
+ * @see drv8305_api_get_event_overflows (declaration)
  */
-DRV8305_PRIVATE uint16_t drv8305_spi_read_command_process(drv8305_user_object_t *self, drv8305_register_types_t drv8305_register)
+DRV8305_PUBLIC uint32_t drv8305_api_get_event_overflows(const drv8305_user_object_t *self)
 {
-    uint16_t drv8305_write_packet = drv8305_spi_read_packet_create(drv8305_register);
-    uint16_t drv8305_read_packet = self->hw_callbacks.drv8305_spi_write_and_read_from_register_cb(drv8305_write_packet);
+    if(!self) { return 0; }
 
-    return drv8305_read_packet;
+    return drv8305_event_ring_overflows(&self->events);
 }
 
 /**
- * @brief Schedule main state machine transition with delay (internal)
- * @details Prepares transition to next_state after specified delay_time cycles.
- *          Enters DRV8305_DELAY_STATE intermediate state.
+ * @brief Install protective-action policy (implementation)
  * @param[in,out] self Pointer to DRV8305 user object
- * @param[in] next_state Target state to transition to
- * @param[in] delay_time Number of cycles to wait before transition
+ * @param[in] shutdown_mask Per status register mask or NULL for descriptor defaults
+ * @param[in] emergency_mask Per status register mask or NULL
+ * @param[in] emergency_cb Emergency hook (may be NULL)
  * @return None
- * @note Delay is synchronized with drv8305_api_timer() call rate
+ * @see drv8305_api_set_protection_policy (declaration)
  */
-DRV8305_PRIVATE void drv8305_main_sm_go_to_next_state(drv8305_user_object_t *self, drv8305_sm_state_e next_state, uint32_t delay_time)
+DRV8305_PUBLIC void drv8305_api_set_protection_policy(drv8305_user_object_t *self, const uint16_t *shutdown_mask, const uint16_t *emergency_mask, drv8305_emergency_cb_t emergency_cb)
 {
-    self->state.cycle_time      = 0;
-    self->state.main_state      = DRV8305_DELAY_STATE;
-    self->state.next_main_state = next_state;
-    self->state.delay_time      = delay_time;
+    if(!self) { return; }
+
+    for(int index = 0; index < DRV8305_NUMBER_OF_STATUS_REGISTERS; index++)
+    {
+        self->protection.shutdown_mask[index]  = ((shutdown_mask  != NULL) ? shutdown_mask[index]
+                                                                          : drv8305_status_action_mask((uint16_t)index, DRV8305_ACTION_STOP_MOTOR)) & DRV8305_REGISTER_DATA_MASK;
+        self->protection.emergency_mask[index] = ((emergency_mask != NULL) ? emergency_mask[index] : 0) & DRV8305_REGISTER_DATA_MASK;
+    }
+
+    self->protection.emergency_cb = emergency_cb;
 }
 
 /**
- * @brief Schedule status state machine transition with delay (internal)
- * @details Prepares transition to next_state in status SM after delay_time cycles.
- *          Enters status DRV8305_STATUS_DELAY_STATE intermediate state.
+ * @brief Install automatic fault recovery policy (implementation)
  * @param[in,out] self Pointer to DRV8305 user object
- * @param[in] next_state Target status state to transition to
- * @param[in] delay_time Number of cycles to wait before transition
+ * @param[in] recoverable_mask Per status register mask or NULL for driver defaults
+ * @param[in] rearm_en_gate Drive EN_GATE high after a successful recovery
  * @return None
+ * @see drv8305_api_set_recovery_policy (declaration)
  */
-DRV8305_PRIVATE void drv8305_status_sm_go_to_next_state(drv8305_user_object_t *self, drv8305_status_sm_state_e next_state, uint32_t delay_time)
+DRV8305_PUBLIC void drv8305_api_set_recovery_policy(drv8305_user_object_t *self, const uint16_t *recoverable_mask, bool rearm_en_gate)
 {
-    self->state.cycle_time        = 0;
-    self->state.status_state      = DRV8305_SM_STATUS_CYCLE_DELAY;
-    self->state.next_status_state = next_state;
-    self->state.delay_time        = delay_time;
-}
+    if(!self) { return; }
 
-/**
+    for(int index = 0; index < DRV8305_NUMBER_OF_STATUS_REGISTERS; index++)
+    {
+        self->recovery.recoverable_mask[index] = ((recoverable_mask != NULL) ? recoverable_mask[index] : drv8305_recovery_default_mask[index]) & DRV8305_REGISTER_DATA_MASK;
+    }
+
+    self->recovery.rearm_en_gate = rearm_en_gate;
+    self->recovery.status        = DRV8305_RECOVERY_IDLE;
+    self->recovery.attempts      = 0;
+    self->recovery.backoff       = DRV8305_RECOVERY_BACKOFF_MIN_MS;
+}
+
+/**
+ * @brief Leave latched-out recovery state (implementation)
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @return None
+ * @see drv8305_api_recovery_unlatch (declaration)
+ */
+DRV8305_PUBLIC void drv8305_api_recovery_unlatch(drv8305_user_object_t *self)
+{
+    if(!self || self->recovery.status != DRV8305_RECOVERY_LATCHED) { return; }
+
+    self->recovery.status   = DRV8305_RECOVERY_IDLE;
+    self->recovery.attempts = 0;
+    self->recovery.backoff  = DRV8305_RECOVERY_BACKOFF_MIN_MS;
+}
+
+/**
+ * @brief Get fault recovery status (implementation)
+ * @param[in] self Pointer to DRV8305 user object
+ * @return drv8305_recovery_status_e Recovery status
+ * @see drv8305_api_get_recovery_status (declaration)
+ */
+DRV8305_PUBLIC drv8305_recovery_status_e drv8305_api_get_recovery_status(const drv8305_user_object_t *self)
+{
+    if(!self) { return DRV8305_RECOVERY_DISABLED; }
+
+    return self->recovery.status;
+}
+
+/**
+ * @brief Get device reset detection counters (implementation)
+ * @param[in] self Pointer to DRV8305 user object
+ * @param[out] reset_detect Destination for state and counters
+ * @return None
+ * @see drv8305_api_get_reset_detect (declaration)
+ */
+DRV8305_PUBLIC void drv8305_api_get_reset_detect(const drv8305_user_object_t *self, drv8305_reset_detect_t *reset_detect)
+{
+    if(!self || !reset_detect) { return; }
+
+    *reset_detect = self->reset_detect;
+}
+
+/**
+ * @brief Set scrubber budget (implementation)
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @param[in] budget_percent 0 (off) to 100
+ * @return None
+ * @see drv8305_api_set_scrub_budget (declaration)
+ */
+DRV8305_PUBLIC void drv8305_api_set_scrub_budget(drv8305_user_object_t *self, uint16_t budget_percent)
+{
+    if(!self) { return; }
+
+    self->scrubber.budget = (budget_percent > (uint16_t)DRV8305_SCRUB_BUDGET_SCALE) ? (uint16_t)DRV8305_SCRUB_BUDGET_SCALE : budget_percent;
+    self->scrubber.credit = 0;
+}
+
+#if defined(DRV8305_RUNTIME_TIMING)
+/**
+ * @brief Set register gaps (implementation)
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @param[in] timing Gaps in milliseconds
+ * @return None
+ * @see drv8305_api_set_timing_profile (declaration)
+ */
+DRV8305_PUBLIC void drv8305_api_set_timing_profile(drv8305_user_object_t *self, const drv8305_timing_profile_t *timing)
+{
+    if(!self || !timing) { return; }
+
+    self->timing = *timing;
+}
+#endif
+
+#if defined(DRV8305_SPI_TRACE)
+/**
+ * @brief Export the SPI trace (implementation)
+ * @param[in] self Pointer to DRV8305 user object
+ * @param[out] words Destination dump words
+ * @param[in] max_words Capacity of words
+ * @return uint32_t Words written
+ * @see drv8305_api_export_trace (declaration)
+ */
+DRV8305_PUBLIC uint32_t drv8305_api_export_trace(const drv8305_user_object_t *self, uint16_t *words, uint32_t max_words)
+{
+    if(!self) { return 0; }
+
+    return drv8305_trace_ring_export(&self->trace, words, max_words, DRV8305_TRACE_TIMESTAMP_HZ);
+}
+#endif
+
+/**
+ * @brief Get scrubber state (implementation)
+ * @param[in] self Pointer to DRV8305 user object
+ * @param[out] scrubber Destination for budget and counters
+ * @return None
+ * @see drv8305_api_get_scrubber (declaration)
+ */
+DRV8305_PUBLIC void drv8305_api_get_scrubber(const drv8305_user_object_t *self, drv8305_scrubber_t *scrubber)
+{
+    if(!self || !scrubber) { return; }
+
+    *scrubber = self->scrubber;
+}
+
+/**
+ * @brief Get latest status summary (implementation)
+ * @param[in] self Pointer to DRV8305 user object
+ * @param[out] summary Destination summary
+ * @return None
+ * @see drv8305_api_get_status_summary (declaration)
+ */
+DRV8305_PUBLIC void drv8305_api_get_status_summary(const drv8305_user_object_t *self, drv8305_status_summary_t *summary)
+{
+    if(!self || !summary) { return; }
+
+    *summary     = self->status_summary;
+    summary->age = (summary->sequence != 0) ? (self->state.system_time - summary->timestamp) : 0;
+}
+
+/**
+ * @brief Attach post-mortem record (implementation)
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @param[in] record No-init post-mortem record
+ * @return true if a capture from before the reset is held
+ * @see drv8305_api_postmortem_attach (declaration)
+ */
+DRV8305_PUBLIC bool drv8305_api_postmortem_attach(drv8305_user_object_t *self, drv8305_postmortem_record_t *record)
+{
+    if(!self) { return false; }
+
+    self->postmortem = record;
+
+    if(drv8305_postmortem_is_valid(record)) { return true; }
+
+    drv8305_postmortem_invalidate(record);
+
+    return false;
+}
+
+/**
+ * @brief Capture driver state (implementation)
+ * @details The record is cleared first so padding is deterministic, then filled and
+ *          sealed with CRC-32.
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @param[in] reason Capture reason
+ * @return true if captured
+ * @see drv8305_api_postmortem_capture (declaration)
+ */
+DRV8305_PUBLIC bool drv8305_api_postmortem_capture(drv8305_user_object_t *self, drv8305_postmortem_reason_e reason)
+{
+    if(!self || !self->postmortem) { return false; }
+
+    drv8305_postmortem_record_t *record = self->postmortem;
+
+    if(drv8305_postmortem_is_valid(record)) { return false; }
+
+    memset(record, 0, sizeof(drv8305_postmortem_record_t));
+
+    record->timestamp          = self->state.system_time;
+    record->shutdown_count     = self->protection.shutdown_count;
+    record->event_overflows    = drv8305_event_ring_overflows(&self->events);
+    record->reason             = (uint16_t)reason;
+    record->flags              = (uint16_t)((self->enable_pin_status   ? DRV8305_POSTMORTEM_FLAG_ENABLE_PIN : 0U) |
+                                            (self->drv_wake_pin_status ? DRV8305_POSTMORTEM_FLAG_WAKE_PIN   : 0U) |
+                                            (drv8305_api_is_configuration_confirm(self) ? DRV8305_POSTMORTEM_FLAG_CONFIRMED : 0U));
+    record->confirmation_flags = (uint16_t)((self->configuration_confirmation_flags.hs_gate_drive     ? (1U << 0) : 0U) |
+                                            (self->configuration_confirmation_flags.ls_gate_drive     ? (1U << 1) : 0U) |
+                                            (self->configuration_confirmation_flags.gate_drive        ? (1U << 2) : 0U) |
+                                            (self->configuration_confirmation_flags.ic_operation      ? (1U << 3) : 0U) |
+                                            (self->configuration_confirmation_flags.shunt_amplifier   ? (1U << 4) : 0U) |
+                                            (self->configuration_confirmation_flags.voltage_regulator ? (1U << 5) : 0U) |
+                                            (self->configuration_confirmation_flags.vds_sense         ? (1U << 6) : 0U));
+    record->main_state         = (uint16_t)self->state.main_state;
+    record->next_main_state    = (uint16_t)self->state.next_main_state;
+    record->status_state       = (uint16_t)self->state.status_state;
+    record->control_state      = (uint16_t)self->state.control_state;
+    record->recovery_state     = (uint16_t)self->state.recovery_state;
+    record->recovery_status    = (uint16_t)self->recovery.status;
+    record->recovery_attempts  = self->recovery.attempts;
+
+    for(int index = 0; index < DRV8305_NUMBER_OF_REGISTERS; index++)
+    {
+        record->registers[index] = self->register_manager[index].data;
+    }
+
+#if defined(DRV8305_POSTMORTEM_EVENTS)
+    record->event_count = drv8305_event_history_copy(&self->event_history, record->events, (uint16_t)DRV8305_POSTMORTEM_EVENT_DEPTH);
+#endif
+
+    drv8305_postmortem_seal(record);
+
+    return true;
+}
+
+/**
+ * @brief Copy frozen post-mortem record (implementation)
+ * @param[in] self Pointer to DRV8305 user object
+ * @param[out] record Destination copy
+ * @return true if a valid record was copied
+ * @see drv8305_api_get_postmortem (declaration)
+ */
+DRV8305_PUBLIC bool drv8305_api_get_postmortem(const drv8305_user_object_t *self, drv8305_postmortem_record_t *record)
+{
+    if(!self || !record || !drv8305_postmortem_is_valid(self->postmortem)) { return false; }
+
+    *record = *self->postmortem;
+
+    return true;
+}
+
+/**
+ * @brief Release frozen post-mortem record (implementation)
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @return None
+ * @see drv8305_api_postmortem_release (declaration)
+ */
+DRV8305_PUBLIC void drv8305_api_postmortem_release(drv8305_user_object_t *self)
+{
+    if(!self) { return; }
+
+    drv8305_postmortem_invalidate(self->postmortem);
+}
+
+#if defined(DRV8305_STATISTICS)
+/**
+ * @brief Export per-bit status statistics (implementation)
+ * @param[in] self Pointer to DRV8305 user object
+ * @param[out] image Destination export image
+ * @return None
+ * @see drv8305_api_get_statistics (declaration)
+ */
+DRV8305_PUBLIC void drv8305_api_get_statistics(const drv8305_user_object_t *self, drv8305_statistics_export_t *image)
+{
+    if(!self) { return; }
+
+    drv8305_statistics_export(&self->statistics, self->state.system_time, image);
+}
+#endif
+
+/**
+ * @brief Build the SPI frame of one register access (implementation)
+ * @param[in] self Pointer to DRV8305 user object
+ * @param[in] array_index Register index (register_manager[] indexing)
+ * @param[in] write true for a write of the programmed control word, false for a read
+ * @return uint16_t SPI command frame
+ * @see drv8305_api_frame_create (declaration)
+ */
+DRV8305_PUBLIC uint16_t drv8305_api_frame_create(const drv8305_user_object_t *self, uint16_t array_index, bool write)
+{
+    if(!self || array_index >= DRV8305_NUMBER_OF_REGISTERS) { return 0; }
+
+    if(write && array_index >= DRV8305_CONTROL_05_ARRAY_INDEX)
+    {
+        return drv8305_spi_write_packet_create(self->register_manager[array_index].type, drv8305_api_get_control_word(self, array_index));
+    }
+
+    return drv8305_spi_read_packet_create(self->register_manager[array_index].type);
+}
+
+/**
+ * @brief Process the response frame of one register access (implementation)
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @param[in] array_index Register index (register_manager[] indexing)
+ * @param[in] frame Command frame that was transmitted
+ * @param[in] response Raw response frame
+ * @return uint16_t Status bits raised by a status read, 0 otherwise
+ * @see drv8305_api_frame_process (declaration)
+ */
+DRV8305_PUBLIC uint16_t drv8305_api_frame_process(drv8305_user_object_t *self, uint16_t array_index, uint16_t frame, uint16_t response)
+{
+    if(!self || array_index >= DRV8305_NUMBER_OF_REGISTERS) { return 0; }
+
+    DRV8305_TRACE_FRAME(self, frame, response);
+
+    if(array_index < DRV8305_CONTROL_05_ARRAY_INDEX)
+    {
+        return drv8305_status_register_process(self, array_index, response);
+    }
+
+    /**@brief: R/W bit 15 clear -> write frame **/
+    if((frame & 0x8000U) == 0)
+    {
+        self->register_manager[array_index].data = response;
+    }
+    else
+    {
+        drv8305_control_register_readback_process(self, array_index, response);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Publish a completed status scan (implementation)
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @return None
+ * @see drv8305_api_scan_complete (declaration)
+ */
+DRV8305_PUBLIC void drv8305_api_scan_complete(drv8305_user_object_t *self)
+{
+    if(!self) { return; }
+
+    drv8305_register_snapshot_publish(self);
+    drv8305_status_summary_publish(self);
+}
+
+/**
+ * @brief Publish a completed control pass (implementation)
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @return None
+ * @see drv8305_api_control_pass_complete (declaration)
+ */
+DRV8305_PUBLIC void drv8305_api_control_pass_complete(drv8305_user_object_t *self)
+{
+    if(!self) { return; }
+
+    drv8305_register_snapshot_publish(self);
+
+    self->reset_detect.armed = true;
+}
+
+/* -------------------------------- PRIVATE FUNCTIONS -------------------------------- */
+
+/**
+ * @brief Process status register reading state machine (internal)
+ * @details Sequentially reads all status registers (0x01 through 0x04) and triggers
+ *          corresponding status callbacks for each register.
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @return None
+ * @note Internal state machine handling - called from drv8305_api_master_sm_polling()
+ */
+DRV8305_PRIVATE void drv8305_status_register_process_polling(drv8305_user_object_t *self)
+{
+    switch (self->state.status_state)
+    {
+        case DRV8305_SM_STATUS_WARNING_REG:
+        {
+            drv8305_status_register_update(self, DRV8305_STATUS_01_ARRAY_INDEX);
+
+            drv8305_status_sm_go_to_next_state(self, DRV8305_SM_STATUS_OV_VDS_REG, DRV8305_TIMING_STATUS_GAP(self));
+
+            break;
+        }
+
+        case DRV8305_SM_STATUS_OV_VDS_REG:
+        {
+            drv8305_status_register_update(self, DRV8305_STATUS_02_ARRAY_INDEX);
+
+            drv8305_status_sm_go_to_next_state(self, DRV8305_SM_STATUS_IC_FAULTS_REG, DRV8305_TIMING_STATUS_GAP(self));
+
+            break;
+        }
+
+        case DRV8305_SM_STATUS_IC_FAULTS_REG:
+        {
+            uint16_t raised = drv8305_status_register_update(self, DRV8305_STATUS_03_ARRAY_INDEX);
+
+            if(drv8305_reset_detect_schedule(self, raised))
+            {
+                drv8305_status_sm_go_to_next_state(self, DRV8305_SM_STATUS_WARNING_REG, 0);
+                break;
+            }
+
+            drv8305_status_sm_go_to_next_state(self, DRV8305_SM_STATUS_VGS_FAULTS_REG, DRV8305_TIMING_STATUS_GAP(self));
+
+            break;
+        }
+
+        case DRV8305_SM_STATUS_VGS_FAULTS_REG:
+        {
+            drv8305_status_register_update(self, DRV8305_STATUS_04_ARRAY_INDEX);
+
+            drv8305_api_scan_complete(self);
+            drv8305_status_sm_go_to_next_state(self, DRV8305_SM_STATUS_WARNING_REG, DRV8305_STANDARD_TASK_DELAY_TIMEOUT);
+
+            if(!drv8305_recovery_schedule(self))
+            {
+                drv8305_main_sm_go_to_next_state(self, DRV8305_IDLE_STATE, DRV8305_STANDARD_TASK_DELAY_TIMEOUT);
+            }
+
+            break;
+        }
+
+        case DRV8305_SM_STATUS_CYCLE_DELAY:
+        {
+            if(self->state.cycle_time >= self->state.delay_time)
+            {
+                self->state.status_state = self->state.next_status_state;
+            }
+
+            break;
+        } 
+    }
+}
+
+/**
+ * @brief Process control register programming state machine (internal)
+ * @details Sequentially writes all control registers (0x05, 0x06, 0x07, 0x09, 0x0A, 0x0B, 0x0C)
+ *          with configuration values and triggers corresponding control callbacks.
+ *          Registers outside control_write_mask are skipped without SPI traffic (commit).
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @return None
+ * @note Internal state machine handling - called from drv8305_api_master_sm_polling()
+ */
+DRV8305_PRIVATE void drv8305_control_register_process_polling(drv8305_user_object_t *self)
+{
+    switch (self->state.control_state)
+    {
+        /**@brief: Control Register Write States */ 
+
+        case DRV8305_SM_CONTROL_HS_GATE_DRIVE_REG:
+        {
+            drv8305_control_register_write_step(self, DRV8305_CONTROL_05_ARRAY_INDEX, DRV8305_SM_CONTROL_LS_GATE_DRIVE_REG);
+
+            break;
+        }
+
+        case DRV8305_SM_CONTROL_LS_GATE_DRIVE_REG:
+        {
+            drv8305_control_register_write_step(self, DRV8305_CONTROL_06_ARRAY_INDEX, DRV8305_SM_CONTROL_GATE_DRIVE_REG);
+
+            break;
+        }
+        
+        case DRV8305_SM_CONTROL_GATE_DRIVE_REG:
+        {
+            drv8305_control_register_write_step(self, DRV8305_CONTROL_07_ARRAY_INDEX, DRV8305_SM_CONTROL_IC_OPERATION_REG);
+
+            break;
+        }
+        
+        case DRV8305_SM_CONTROL_IC_OPERATION_REG:
+        {
+            drv8305_control_register_write_step(self, DRV8305_CONTROL_09_ARRAY_INDEX, DRV8305_SM_CONTROL_SHUNT_AMPLIFIER_REG);
+
+            break;
+        }
+        
+        case DRV8305_SM_CONTROL_SHUNT_AMPLIFIER_REG:
+        {
+            drv8305_control_register_write_step(self, DRV8305_CONTROL_0A_ARRAY_INDEX, DRV8305_SM_CONTROL_VOLTAGE_REGULATOR_REG);
+
+            break;
+        }
+        
+        case DRV8305_SM_CONTROL_VOLTAGE_REGULATOR_REG:
+        {
+            drv8305_control_register_write_step(self, DRV8305_CONTROL_0B_ARRAY_INDEX, DRV8305_SM_CONTROL_VDS_SENSE_REG);
+
+            break;
+        }
+
+        case DRV8305_SM_CONTROL_VDS_SENSE_REG:
+        {
+            drv8305_control_register_write_step(self, DRV8305_CONTROL_0C_ARRAY_INDEX, DRV8305_SM_READ_CONTROL_HS_GATE_DRIVE_REG);
+
+            break;
+        }
+
+        /**@brief: Control Register Read States */ 
+
+        case DRV8305_SM_READ_CONTROL_HS_GATE_DRIVE_REG:
+        {
+            drv8305_control_register_read_step(self, DRV8305_CONTROL_05_ARRAY_INDEX, DRV8305_SM_READ_CONTROL_LS_GATE_DRIVE_REG);
+
+            break;
+        }
+
+        case DRV8305_SM_READ_CONTROL_LS_GATE_DRIVE_REG:
+        {
+            drv8305_control_register_read_step(self, DRV8305_CONTROL_06_ARRAY_INDEX, DRV8305_SM_READ_CONTROL_GATE_DRIVE_REG);
+
+            break;
+        }
+
+        case DRV8305_SM_READ_CONTROL_GATE_DRIVE_REG:
+        {
+            drv8305_control_register_read_step(self, DRV8305_CONTROL_07_ARRAY_INDEX, DRV8305_SM_READ_CONTROL_IC_OPERATION_REG);
+
+            break;
+        }
+
+        case DRV8305_SM_READ_CONTROL_IC_OPERATION_REG:
+        {
+            drv8305_control_register_read_step(self, DRV8305_CONTROL_09_ARRAY_INDEX, DRV8305_SM_READ_CONTROL_SHUNT_AMPLIFIER_REG);
+
+            break;
+        }
+
+        case DRV8305_SM_READ_CONTROL_SHUNT_AMPLIFIER_REG:
+        {
+            drv8305_control_register_read_step(self, DRV8305_CONTROL_0A_ARRAY_INDEX, DRV8305_SM_READ_CONTROL_VOLTAGE_REGULATOR_REG);
+
+            break;
+        }
+
+        case DRV8305_SM_READ_CONTROL_VOLTAGE_REGULATOR_REG:
+        {
+            drv8305_control_register_read_step(self, DRV8305_CONTROL_0B_ARRAY_INDEX, DRV8305_SM_READ_CONTROL_VDS_SENSE_REG);
+
+            break;
+        }
+
+        case DRV8305_SM_READ_CONTROL_VDS_SENSE_REG:
+        {
+            if(self->control_write_mask & DRV8305_CONTROL_REGISTER_BIT(DRV8305_CONTROL_0C_ARRAY_INDEX))
+            {
+                drv8305_control_register_readback_process(self, DRV8305_CONTROL_0C_ARRAY_INDEX, drv8305_spi_read_command_process(self, self->register_manager[DRV8305_CONTROL_0C_ARRAY_INDEX].type));
+            }
+
+            drv8305_api_control_pass_complete(self);
+
+            if(!drv8305_configuration_commit_conclude(self) && !drv8305_reset_detect_conclude(self))
+            {
+                drv8305_main_sm_go_to_next_state(self, DRV8305_IDLE_STATE, DRV8305_REGISTER_SWITCH_DELAY_MS);
+            }
+
+            break;
+        }
+
+
+        case DRV8305_SM_CONTROL_CYCLE_DELAY:
+        {
+            if(self->state.cycle_time >= self->state.delay_time)
+            {
+                self->state.control_state = self->state.next_control_state;
+            }
+
+            break;
+        } 
+    }
+}
+
+/**
+ * @brief Process latched fault recovery state machine (internal)
+ * @details Writes the programmed Control 0x09 word with CLR_FLTS set, then re-reads the fault
+ *          registers 0x02 - 0x04 through the normal status path (protection, events,
+ *          statistics and callbacks all see the result) and concludes the attempt.
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @return None
+ * @note Internal state machine handling - called from drv8305_api_master_sm_polling()
+ */
+DRV8305_PRIVATE void drv8305_recovery_process_polling(drv8305_user_object_t *self)
+{
+    switch (self->state.recovery_state)
+    {
+        case DRV8305_SM_RECOVERY_CLEAR_FAULTS:
+        {
+            // Programmed word, not a readback: after a brown-out 0x09 holds its reset word
+            uint16_t ic_operation = (uint16_t)(drv8305_api_get_control_word(self, DRV8305_CONTROL_09_ARRAY_INDEX) | DRV8305_CTRL09_CLR_FLTS_MASK);
+
+            drv8305_spi_write_command_process(self, self->register_manager[DRV8305_CONTROL_09_ARRAY_INDEX].type, ic_operation);
+
+            drv8305_recovery_sm_go_to_next_state(self, DRV8305_SM_RECOVERY_VERIFY_OV_VDS_REG, DRV8305_RECOVERY_STEP_DELAY_MS);
+
+            break;
+        }
+
+        case DRV8305_SM_RECOVERY_VERIFY_OV_VDS_REG:
+        {
+            drv8305_status_register_update(self, DRV8305_STATUS_02_ARRAY_INDEX);
+
+            drv8305_recovery_sm_go_to_next_state(self, DRV8305_SM_RECOVERY_VERIFY_IC_FAULTS_REG, DRV8305_RECOVERY_STEP_DELAY_MS);
+
+            break;
+        }
+
+        case DRV8305_SM_RECOVERY_VERIFY_IC_FAULTS_REG:
+        {
+            drv8305_status_register_update(self, DRV8305_STATUS_03_ARRAY_INDEX);
+
+            drv8305_recovery_sm_go_to_next_state(self, DRV8305_SM_RECOVERY_VERIFY_VGS_FAULTS_REG, DRV8305_RECOVERY_STEP_DELAY_MS);
+
+            break;
+        }
+
+        case DRV8305_SM_RECOVERY_VERIFY_VGS_FAULTS_REG:
+        {
+            drv8305_status_register_update(self, DRV8305_STATUS_04_ARRAY_INDEX);
+
+            drv8305_register_snapshot_publish(self);
+            drv8305_recovery_conclude(self);
+
+            break;
+        }
+
+        case DRV8305_SM_RECOVERY_CYCLE_DELAY:
+        {
+            if(self->state.cycle_time >= self->state.delay_time)
+            {
+                self->state.recovery_state = self->state.next_recovery_state;
+            }
+
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Execute SPI write command and receive response (internal)
+ * @details Creates SPI write packet for register, transmits via callback, and returns
+ *          parsed response data from hardware SPI receive callback.
+ * @param[in] self Pointer to DRV8305 user object
+ * @param[in] drv8305_register Register address to write
+ * @param[in] data Data value to write to register
+ * @return uint16_t SPI response data (lower 11 bits valid)
+ * @note Uses hardware SPI callbacks configured during initialization
+ */
+DRV8305_PRIVATE uint16_t drv8305_spi_write_command_process(drv8305_user_object_t *self, drv8305_register_types_t drv8305_register, uint16_t data)
+{
+    uint16_t drv8305_write_packet = drv8305_spi_write_packet_create(drv8305_register, data);
+    uint16_t drv8305_read_packet = DRV8305_DISPATCH_SPI_TRANSFER(self, drv8305_write_packet);
+
+    DRV8305_TRACE_FRAME(self, drv8305_write_packet, drv8305_read_packet);
+    drv8305_scrubber_earn(self);
+
+    return drv8305_read_packet;
+}
+
+/**
+ * @brief Execute SPI read command and receive response (internal)
+ * @details Creates SPI read packet for register, transmits via callback, and returns
+ *          parsed response data from hardware SPI receive callback.
+ * @param[in] self Pointer to DRV8305 user object
+ * @param[in] drv8305_register Register address to read
+ * @return uint16_t SPI response data containing register contents (lower 11 bits)
+ * @note Uses hardware SPI callbacks configured during initialization
+ */
+DRV8305_PRIVATE uint16_t drv8305_spi_read_command_process(drv8305_user_object_t *self, drv8305_register_types_t drv8305_register)
+{
+    uint16_t drv8305_write_packet = drv8305_spi_read_packet_create(drv8305_register);
+    uint16_t drv8305_read_packet = DRV8305_DISPATCH_SPI_TRANSFER(self, drv8305_write_packet);
+
+    DRV8305_TRACE_FRAME(self, drv8305_write_packet, drv8305_read_packet);
+    drv8305_scrubber_earn(self);
+
+    return drv8305_read_packet;
+}
+
+/**
+ * @brief Schedule main state machine transition with delay (internal)
+ * @details Prepares transition to next_state after specified delay_time cycles.
+ *          Enters DRV8305_DELAY_STATE intermediate state.
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @param[in] next_state Target state to transition to
+ * @param[in] delay_time Number of cycles to wait before transition
+ * @return None
+ * @note Delay is synchronized with drv8305_api_timer() call rate
+ */
+DRV8305_PRIVATE void drv8305_main_sm_go_to_next_state(drv8305_user_object_t *self, drv8305_sm_state_e next_state, uint32_t delay_time)
+{
+    self->state.cycle_time      = 0;
+    self->state.main_state      = DRV8305_DELAY_STATE;
+    self->state.next_main_state = next_state;
+    self->state.delay_time      = delay_time;
+}
+
+/**
+ * @brief Schedule status state machine transition with delay (internal)
+ * @details Prepares transition to next_state in status SM after delay_time cycles.
+ *          Enters status DRV8305_STATUS_DELAY_STATE intermediate state, unless the timing
+ *          profile elides zero delays (DRV8305_TIMING_ELIDE_ZERO_DELAY).
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @param[in] next_state Target status state to transition to
+ * @param[in] delay_time Number of cycles to wait before transition
+ * @return None
+ */
+DRV8305_PRIVATE void drv8305_status_sm_go_to_next_state(drv8305_user_object_t *self, drv8305_status_sm_state_e next_state, uint32_t delay_time)
+{
+    if(DRV8305_TIMING_ELIDE_ZERO_DELAY && delay_time == 0U)
+    {
+        self->state.status_state = next_state;
+        return;
+    }
+
+    self->state.cycle_time        = 0;
+    self->state.status_state      = DRV8305_SM_STATUS_CYCLE_DELAY;
+    self->state.next_status_state = next_state;
+    self->state.delay_time        = delay_time;
+}
+
+/**
  * @brief Schedule control state machine transition with delay (internal)
  * @details Prepares transition to next_state in control SM after delay_time cycles.
- *          Enters control DRV8305_SM_CONTROL_CYCLE_DELAY intermediate state.
+ *          Enters control DRV8305_SM_CONTROL_CYCLE_DELAY intermediate state, unless the timing
+ *          profile elides zero delays (DRV8305_TIMING_ELIDE_ZERO_DELAY).
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @param[in] next_state Target control state to transition to
+ * @param[in] delay_time Number of cycles to wait before transition
+ * @return None
+ */
+DRV8305_PRIVATE void drv8305_control_sm_go_to_next_state(drv8305_user_object_t *self, drv8305_control_sm_state_e next_state, uint32_t delay_time)
+{
+    if(DRV8305_TIMING_ELIDE_ZERO_DELAY && delay_time == 0U)
+    {
+        self->state.control_state = next_state;
+        return;
+    }
+
+    self->state.cycle_time         = 0;
+    self->state.control_state      = DRV8305_SM_CONTROL_CYCLE_DELAY;
+    self->state.next_control_state = next_state;
+    self->state.delay_time         = delay_time;
+}
+
+/**
+ * @brief Schedule recovery state machine transition with delay (internal)
+ * @details Prepares transition to next_state in recovery SM after delay_time cycles.
+ *          Enters DRV8305_SM_RECOVERY_CYCLE_DELAY intermediate state.
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @param[in] next_state Target recovery state to transition to
+ * @param[in] delay_time Number of cycles to wait before transition
+ * @return None
+ */
+DRV8305_PRIVATE void drv8305_recovery_sm_go_to_next_state(drv8305_user_object_t *self, drv8305_recovery_sm_state_e next_state, uint32_t delay_time)
+{
+    self->state.cycle_time          = 0;
+    self->state.recovery_state      = DRV8305_SM_RECOVERY_CYCLE_DELAY;
+    self->state.next_recovery_state = next_state;
+    self->state.delay_time          = delay_time;
+}
+
+/**
+ * @brief Create SPI write packet from register and data (internal)
+ * @details Formats register address and data into SPI command packet format.
+ *          Packet structure: [R/W bit (0)] [Register Address (bits 14:11)] [Data (bits 10:0)]
+ * @param[in] register_type Register address to write
+ * @param[in] data Data value to write (lower 11 bits used)
+ * @return uint16_t SPI write command packet
+ */
+DRV8305_PRIVATE uint16_t drv8305_spi_write_packet_create(drv8305_register_types_t register_type, uint16_t data)
+{
+    return (((uint16_t)register_type & 0x0F) << 11) | ((uint16_t)data & 0x7FF);
+}
+
+/**
+ * @brief Create SPI read packet from register address (internal)
+ * @details Formats register address into SPI read command packet.
+ *          Packet structure: [R/W bit (1)] [Register Address (bits 14:11)] [Reserved (bits 10:0)]
+ * @param[in] register_type Register address to read
+ * @return uint16_t SPI read command packet
+ */
+DRV8305_PRIVATE uint16_t drv8305_spi_read_packet_create(drv8305_register_types_t register_type)
+{
+    return (1 << 15) | (((uint16_t)register_type & 0x0F) << 11);
+}
+
+/**
+ * @brief Publish register_manager[] as a coherent snapshot (internal)
+ * @details Called once a status scan or control readback pass is complete so that readers
+ *          in other contexts never observe a partially updated register set.
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @return None
+ */
+DRV8305_PRIVATE void drv8305_register_snapshot_publish(drv8305_user_object_t *self)
+{
+    uint16_t registers[DRV8305_NUMBER_OF_REGISTERS];
+
+    for(int index = 0; index < DRV8305_NUMBER_OF_REGISTERS; index++)
+    {
+        registers[index] = self->register_manager[index].data;
+    }
+
+    drv8305_snapshot_publish(&self->snapshot, registers, self->state.system_time);
+}
+
+/**
+ * @brief Build the per-scan status summary and deliver it (internal)
+ * @details Called once the four status registers of a scan have been read.
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @return None
+ */
+DRV8305_PRIVATE void drv8305_status_summary_publish(drv8305_user_object_t *self)
+{
+    drv8305_status_summary_build(&self->status_summary, self->status_edges.previous);
+
+    self->status_summary.sequence++;
+    self->status_summary.timestamp = self->state.system_time;
+    self->status_summary.age       = 0;
+
+    if(self->status_summary_callback != NULL)
+    {
+        self->status_summary_callback(self, &self->status_summary);
+    }
+}
+
+/**
+ * @brief Read one status register and dispatch change notifications (internal)
+ * @details Stores the frame in register_manager[] and applies the protective policy first
+ *          (EN_GATE low, emergency hook) so its latency does not depend on the work below.
+ *          Raised/cleared masks come from the previous scan with a single XOR and the rest
+ *          runs only when something changed: the
+ *          change is recorded in the event ring and the statistics, the level callback receives
+ *          the full data and each subscriber is woken only if the change intersects its
+ *          interest mask.
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @param[in] status_index Status register index (DRV8305_STATUS_0x_ARRAY_INDEX)
+ * @return uint16_t Bits raised by this read (0 -> 1 since the previous scan)
+ */
+DRV8305_PRIVATE uint16_t drv8305_status_register_update(drv8305_user_object_t *self, uint16_t status_index)
+{
+    return drv8305_status_register_process(self, status_index, drv8305_spi_read_command_process(self, self->register_manager[status_index].type));
+}
+
+/**
+ * @brief Process the response frame of a status register read (internal)
+ * @details Body of drv8305_status_register_update() after the SPI transfer; shared with
+ *          transports that complete frames outside the state machine (drv8305_api_frame_process()).
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @param[in] status_index Status register index (DRV8305_STATUS_0x_ARRAY_INDEX)
+ * @param[in] response Raw response frame
+ * @return uint16_t Bits raised by this read (0 -> 1 since the previous scan)
+ */
+DRV8305_PRIVATE uint16_t drv8305_status_register_process(drv8305_user_object_t *self, uint16_t status_index, uint16_t response)
+{
+    self->register_manager[status_index].data = response;
+
+    uint16_t data     = self->register_manager[status_index].data & DRV8305_REGISTER_DATA_MASK;
+    uint16_t previous = self->status_edges.previous[status_index];
+    uint16_t changed  = data ^ previous;
+    bool     shutdown = false;
+
+    if((data & self->protection.shutdown_mask[status_index]) != 0 && self->enable_pin_status == true)
+    {
+        drv8305_api_ic_disable(self);
+        self->protection.shutdown_count++;
+        shutdown = true;
+    }
+
+    if(changed == 0)
+    {
+        if(shutdown) { drv8305_api_postmortem_capture(self, DRV8305_POSTMORTEM_REASON_PROTECTIVE_SHUTDOWN); }
+        return 0;
+    }
+
+    uint16_t raised  = changed & data;
+    uint16_t cleared = changed & previous;
+    uint16_t trip    = raised & self->protection.emergency_mask[status_index];
+
+    if(trip != 0 && self->protection.emergency_cb != NULL)
+    {
+        self->protection.emergency_cb(self, status_index, data, trip);
+    }
+
+    self->status_edges.previous[status_index] = data;
+
+    drv8305_event_t event;
+
+    event.timestamp        = self->state.system_time;
+    event.register_address = (uint16_t)self->register_manager[status_index].type;
+    event.data             = data;
+    event.raised           = raised;
+    event.cleared          = cleared;
+    event.main_state       = (uint16_t)self->state.main_state;
+
+    drv8305_event_ring_push(&self->events, &event);
+#if defined(DRV8305_POSTMORTEM_EVENTS)
+    drv8305_event_history_record(&self->event_history, &event);
+#endif
+
+#if defined(DRV8305_STATISTICS)
+    drv8305_statistics_update(&self->statistics, status_index, raised, cleared, self->state.system_time);
+#endif
+
+    if(shutdown) { drv8305_api_postmortem_capture(self, DRV8305_POSTMORTEM_REASON_PROTECTIVE_SHUTDOWN); }
+
+    DRV8305_DISPATCH_STATUS(self, status_index, self->register_manager[status_index].data);
+
+    for(int index = 0; index < DRV8305_STATUS_MAX_SUBSCRIBERS; index++)
+    {
+        const drv8305_status_subscriber_t *subscriber = &self->status_edges.subscribers[index];
+
+        if(subscriber->callback != NULL && (changed & subscriber->interest_mask[status_index]) != 0)
+        {
+            subscriber->callback(self, status_index, data, raised, cleared);
+        }
+    }
+
+    return raised;
+}
+
+/**
+ * @brief Classify latched faults of registers 0x02 - 0x04 (internal)
+ * @details Sets recovery.status to IDLE (no fault), LATCHED (a bit outside the recoverable
+ *          mask) or ACTIVE (only recoverable bits). Register 0x01 (warnings) is not considered.
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @return drv8305_recovery_status_e New recovery status
+ */
+DRV8305_PRIVATE drv8305_recovery_status_e drv8305_recovery_classify(drv8305_user_object_t *self)
+{
+    uint16_t faults        = 0;
+    uint16_t unrecoverable = 0;
+
+    for(int index = DRV8305_STATUS_02_ARRAY_INDEX; index < DRV8305_NUMBER_OF_STATUS_REGISTERS; index++)
+    {
+        faults        |= self->status_edges.previous[index];
+        unrecoverable |= self->status_edges.previous[index] & (uint16_t)~self->recovery.recoverable_mask[index];
+    }
+
+    if(faults == 0)              { self->recovery.status = DRV8305_RECOVERY_IDLE;    }
+    else if(unrecoverable != 0)  { self->recovery.status = DRV8305_RECOVERY_LATCHED; }
+    else                         { self->recovery.status = DRV8305_RECOVERY_ACTIVE;  }
+
+    return self->recovery.status;
+}
+
+/**
+ * @brief Schedule a recovery attempt after a status scan (internal)
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @return true if the main state machine was sent to DRV8305_RECOVERY_STATE
+ */
+DRV8305_PRIVATE bool drv8305_recovery_schedule(drv8305_user_object_t *self)
+{
+    if(self->recovery.status == DRV8305_RECOVERY_DISABLED || self->recovery.status == DRV8305_RECOVERY_LATCHED) { return false; }
+
+    if(drv8305_recovery_classify(self) != DRV8305_RECOVERY_ACTIVE)
+    {
+        if(self->recovery.status == DRV8305_RECOVERY_LATCHED)
+        {
+            drv8305_api_postmortem_capture(self, DRV8305_POSTMORTEM_REASON_RECOVERY_LATCHED);
+        }
+
+        return false;
+    }
+
+    drv8305_recovery_sm_go_to_next_state(self, DRV8305_SM_RECOVERY_CLEAR_FAULTS, 0);
+    drv8305_main_sm_go_to_next_state(self, DRV8305_RECOVERY_STATE, self->recovery.backoff);
+
+    return true;
+}
+
+/**
+ * @brief Evaluate the verify re-read of a recovery attempt (internal)
+ * @details Success resets attempts and backoff (and re-arms EN_GATE if requested). A failure
+ *          doubles the backoff and retries directly, until DRV8305_RECOVERY_MAX_ATTEMPTS
+ *          failures latch the recovery out.
  * @param[in,out] self Pointer to DRV8305 user object
- * @param[in] next_state Target control state to transition to
- * @param[in] delay_time Number of cycles to wait before transition
  * @return None
  */
-DRV8305_PRIVATE void drv8305_control_sm_go_to_next_state(drv8305_user_object_t *self, drv8305_control_sm_state_e next_state, uint32_t delay_time)
+DRV8305_PRIVATE void drv8305_recovery_conclude(drv8305_user_object_t *self)
 {
-    self->state.cycle_time         = 0;
-    self->state.control_state      = DRV8305_SM_CONTROL_CYCLE_DELAY;
-    self->state.next_control_state = next_state;
-    self->state.delay_time         = delay_time;
+    switch (drv8305_recovery_classify(self))
+    {
+        case DRV8305_RECOVERY_ACTIVE:
+        {
+            self->recovery.attempts++;
+
+            if(self->recovery.attempts >= (uint16_t)DRV8305_RECOVERY_MAX_ATTEMPTS)
+            {
+                self->recovery.status = DRV8305_RECOVERY_LATCHED;
+                break;
+            }
+
+            self->recovery.backoff = (self->recovery.backoff >= (uint32_t)DRV8305_RECOVERY_BACKOFF_MAX_MS / 2U) ? (uint32_t)DRV8305_RECOVERY_BACKOFF_MAX_MS
+                                                                                                               : self->recovery.backoff * 2U;
+
+            drv8305_recovery_sm_go_to_next_state(self, DRV8305_SM_RECOVERY_CLEAR_FAULTS, 0);
+            drv8305_main_sm_go_to_next_state(self, DRV8305_RECOVERY_STATE, self->recovery.backoff);
+
+            return;
+        }
+
+        case DRV8305_RECOVERY_IDLE:
+        {
+            self->recovery.recoveries++;
+            self->recovery.attempts = 0;
+            self->recovery.backoff  = DRV8305_RECOVERY_BACKOFF_MIN_MS;
+
+            if(self->recovery.rearm_en_gate)
+            {
+                drv8305_api_ic_enable(self);
+            }
+
+            break;
+        }
+
+        default:
+        {
+            break;
+        }
+    }
+
+    if(self->recovery.status == DRV8305_RECOVERY_LATCHED)
+    {
+        drv8305_api_postmortem_capture(self, DRV8305_POSTMORTEM_REASON_RECOVERY_LATCHED);
+    }
+
+    drv8305_main_sm_go_to_next_state(self, DRV8305_IDLE_STATE, DRV8305_STANDARD_TASK_DELAY_TIMEOUT);
 }
 
 /**
- * @brief Create SPI write packet from register and data (internal)
- * @details Formats register address and data into SPI command packet format.
- *          Packet structure: [R/W bit (0)] [Register Address (bits 14:11)] [Data (bits 10:0)]
- * @param[in] register_type Register address to write
- * @param[in] data Data value to write (lower 11 bits used)
- * @return uint16_t SPI write command packet
+ * @brief Write one control register if it belongs to the current pass (internal)
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @param[in] array_index Control register index (DRV8305_CONTROL_xx_ARRAY_INDEX)
+ * @param[in] next_state Next control state
+ * @return None
  */
-DRV8305_PRIVATE uint16_t drv8305_spi_write_packet_create(drv8305_register_types_t register_type, uint16_t data)
+DRV8305_PRIVATE void drv8305_control_register_write_step(drv8305_user_object_t *self, uint16_t array_index, drv8305_control_sm_state_e next_state)
 {
-    return (((uint16_t)register_type & 0x0F) << 11) | ((uint16_t)data & 0x7FF);
+    uint32_t delay_time = 0;
+
+    if(self->control_write_mask & DRV8305_CONTROL_REGISTER_BIT(array_index))
+    {
+        self->register_manager[array_index].data = drv8305_api_get_control_word(self, array_index);
+        self->register_manager[array_index].data = drv8305_spi_write_command_process(self, self->register_manager[array_index].type, self->register_manager[array_index].data);
+
+        delay_time = drv8305_control_step_delay(self);
+    }
+
+    drv8305_control_sm_go_to_next_state(self, next_state, delay_time);
 }
 
 /**
- * @brief Create SPI read packet from register address (internal)
- * @details Formats register address into SPI read command packet.
- *          Packet structure: [R/W bit (1)] [Register Address (bits 14:11)] [Reserved (bits 10:0)]
- * @param[in] register_type Register address to read
- * @return uint16_t SPI read command packet
+ * @brief Read back one control register if it belongs to the current pass (internal)
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @param[in] array_index Control register index (DRV8305_CONTROL_xx_ARRAY_INDEX)
+ * @param[in] next_state Next control state
+ * @return None
  */
-DRV8305_PRIVATE uint16_t drv8305_spi_read_packet_create(drv8305_register_types_t register_type)
+DRV8305_PRIVATE void drv8305_control_register_read_step(drv8305_user_object_t *self, uint16_t array_index, drv8305_control_sm_state_e next_state)
 {
-    return (1 << 15) | (((uint16_t)register_type & 0x0F) << 11);
+    uint32_t delay_time = 0;
+
+    if(self->control_write_mask & DRV8305_CONTROL_REGISTER_BIT(array_index))
+    {
+        drv8305_control_register_readback_process(self, array_index, drv8305_spi_read_command_process(self, self->register_manager[array_index].type));
+
+        delay_time = drv8305_control_step_delay(self);
+    }
+
+    drv8305_control_sm_go_to_next_state(self, next_state, delay_time);
+}
+
+/**
+ * @brief Process the response frame of a control register readback (internal)
+ * @details Stores the frame, notifies the control callback and updates reset detection.
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @param[in] array_index Control register index (DRV8305_CONTROL_xx_ARRAY_INDEX)
+ * @param[in] response Raw response frame
+ * @return None
+ */
+DRV8305_PRIVATE void drv8305_control_register_readback_process(drv8305_user_object_t *self, uint16_t array_index, uint16_t response)
+{
+    self->register_manager[array_index].data = response;
+    DRV8305_DISPATCH_CONTROL(self, array_index, response);
+    drv8305_reset_detect_readback(self, array_index);
+}
+
+/**
+ * @brief Start a requested commit at the IDLE safe point (internal)
+ * @details The staged profile becomes active; only registers whose word differs from the
+ *          previously active words are written. An identical profile completes immediately.
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @return None
+ */
+DRV8305_PRIVATE void drv8305_configuration_commit_start(drv8305_user_object_t *self)
+{
+    self->commit.previous = (self->register_image) ? *self->register_image : self->config;
+
+    uint16_t mask = drv8305_configuration_diff(NULL, &self->commit.previous, &self->staged);
+
+    self->register_image       = NULL;
+    self->config               = self->staged;
+    self->commit.register_mask = mask;
+
+    if(mask == 0)
+    {
+        self->commit.status = DRV8305_COMMIT_DONE;
+        return;
+    }
+
+    self->commit.status       = DRV8305_COMMIT_WRITING;
+    self->control_write_mask  = mask;
+
+    drv8305_control_sm_go_to_next_state(self, DRV8305_SM_CONTROL_HS_GATE_DRIVE_REG, DRV8305_REGISTER_SWITCH_DELAY_MS);
+    drv8305_main_sm_go_to_next_state(self, DRV8305_CONTROL_STATE, DRV8305_REGISTER_SWITCH_DELAY_MS);
+}
+
+/**
+ * @brief Compare the readback of the committed registers with the active words (internal)
+ * @param[in] self Pointer to DRV8305 user object
+ * @return true if every written register reads back as programmed
+ */
+DRV8305_PRIVATE bool drv8305_configuration_commit_verify(const drv8305_user_object_t *self)
+{
+    for(int index = 0; index < DRV8305_NUMBER_OF_CONTROL_REGISTERS; index++)
+    {
+        if((self->commit.register_mask & (1U << index)) == 0) { continue; }
+
+        if(((self->register_manager[DRV8305_CONTROL_05_ARRAY_INDEX + index].data ^ self->config.word[index]) & drv8305_control_verify_mask[index]) != 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
 }
 
 /**
- * @brief Parse and extract data from SPI response packet (internal)
- * @details Extracts the lower 11 bits containing register data from raw SPI response.
- * @param[in] data Raw SPI response packet
- * @return uint16_t Extracted register data (lower 11 bits)
+ * @brief Evaluate a commit at the end of its control pass (internal)
+ * @details A failed verify restores the previous words and runs the same registers again;
+ *          the rollback pass concludes the commit either way.
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @return true if another control pass was started (rollback), false to return to IDLE
  */
-DRV8305_PRIVATE uint16_t drv8305_spi_response_packet_create(uint16_t data)
+DRV8305_PRIVATE bool drv8305_configuration_commit_conclude(drv8305_user_object_t *self)
 {
-    return (data & 0x7FF);
+    bool verified;
+
+    switch (self->commit.status)
+    {
+        case DRV8305_COMMIT_WRITING:
+        {
+            if(drv8305_configuration_commit_verify(self))
+            {
+                self->commit.status = DRV8305_COMMIT_DONE;
+                break;
+            }
+
+            self->config        = self->commit.previous;
+            self->commit.status = DRV8305_COMMIT_ROLLING_BACK;
+
+            drv8305_control_sm_go_to_next_state(self, DRV8305_SM_CONTROL_HS_GATE_DRIVE_REG, DRV8305_REGISTER_SWITCH_DELAY_MS);
+
+            return true;
+        }
+
+        case DRV8305_COMMIT_ROLLING_BACK:
+        {
+            verified            = drv8305_configuration_commit_verify(self);
+            self->commit.status = (verified) ? DRV8305_COMMIT_ROLLED_BACK : DRV8305_COMMIT_FAILED;
+
+            break;
+        }
+
+        default:
+        {
+            break;
+        }
+    }
+
+    self->control_write_mask = DRV8305_CONTROL_REGISTER_ALL;
+
+    return false;
 }
 
-DRV8305_PRIVATE uint16_t drv8305_control_register_05_parser(drv8305_user_object_t *self)
+/**
+ * @brief Delay between the SPI operations of a control pass (internal)
+ * @param[in] self Pointer to DRV8305 user object
+ * @return uint32_t DRV8305_TIMING_RESET_GAP() while handling a device reset, else DRV8305_TIMING_CONTROL_GAP()
+ */
+DRV8305_PRIVATE uint32_t drv8305_control_step_delay(const drv8305_user_object_t *self)
 {
-    return DRV8305_PACK_CTRL05(self->config.hs_gate_drive);
+    return (self->reset_detect.state != DRV8305_RESET_DETECT_IDLE) ? DRV8305_TIMING_RESET_GAP(self) : DRV8305_TIMING_CONTROL_GAP(self);
 }
 
-DRV8305_PRIVATE uint16_t drv8305_control_register_06_parser (drv8305_user_object_t *self)
+/**
+ * @brief Start a readback of every control register after a brown-out bit (internal)
+ * @details Called right after Status 0x03 was read; the rest of the status scan is skipped
+ *          so the readback starts DRV8305_RESET_STEP_DELAY_MS later.
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @param[in] raised Status 0x03 bits raised by the read
+ * @return true if the main state machine was sent to DRV8305_CONTROL_STATE
+ */
+DRV8305_PRIVATE bool drv8305_reset_detect_schedule(drv8305_user_object_t *self, uint16_t raised)
 {
-    return DRV8305_PACK_CTRL06(self->config.ls_gate_drive);
+    if((raised & DRV8305_RESET_DETECT_IC_FAULTS) == 0 || !self->reset_detect.armed || self->reset_detect.state != DRV8305_RESET_DETECT_IDLE) { return false; }
+
+    self->reset_detect.state = DRV8305_RESET_DETECT_CHECKING;
+    self->control_write_mask = DRV8305_CONTROL_REGISTER_ALL;
+
+    drv8305_control_sm_go_to_next_state(self, DRV8305_SM_READ_CONTROL_HS_GATE_DRIVE_REG, 0);
+    drv8305_main_sm_go_to_next_state(self, DRV8305_CONTROL_STATE, DRV8305_RESET_STEP_DELAY_MS);
+
+    return true;
 }
 
-DRV8305_PRIVATE uint16_t drv8305_control_register_07_parser (drv8305_user_object_t *self)
+/**
+ * @brief Track control readbacks that hold the reset word instead of the programmed one (internal)
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @param[in] array_index Control register index (DRV8305_CONTROL_xx_ARRAY_INDEX)
+ * @return None
+ */
+DRV8305_PRIVATE void drv8305_reset_detect_readback(drv8305_user_object_t *self, uint16_t array_index)
 {
-    return DRV8305_PACK_CTRL07(self->config.gate_drive);
+    uint16_t index    = (uint16_t)DRV8305_REGISTER_IMAGE_INDEX(array_index);
+    uint16_t mask     = drv8305_control_verify_mask[index];
+    uint16_t reset    = drv8305_reset_image.word[index] & mask;
+    uint16_t readback = self->register_manager[array_index].data & mask;
+    uint16_t expected = drv8305_api_get_control_word(self, array_index) & mask;
+
+    if(readback == reset && expected != reset)
+    {
+        self->reset_detect.reverted_mask |= DRV8305_CONTROL_REGISTER_BIT(array_index);
+    }
+    else
+    {
+        self->reset_detect.reverted_mask &= (uint16_t)~DRV8305_CONTROL_REGISTER_BIT(array_index);
+    }
 }
 
-DRV8305_PRIVATE uint16_t drv8305_control_register_09_parser (drv8305_user_object_t *self)
+/**
+ * @brief Evaluate reset detection at the end of a control pass (internal)
+ * @details A register read back at its reset word, or any mismatch after a brown-out bit,
+ *          counts as a device reset: only the registers that differ from the programmed words
+ *          are written again and read back. Gives up after DRV8305_RESET_REPROGRAM_ATTEMPTS.
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @return true if a re-programming pass was started, false to return to IDLE
+ */
+DRV8305_PRIVATE bool drv8305_reset_detect_conclude(drv8305_user_object_t *self)
 {
-    return DRV8305_PACK_CTRL09(self->config.ic_operation);
+    drv8305_reset_detect_t *reset_detect = &self->reset_detect;
+    uint16_t                mismatch     = drv8305_api_diff_readback(self, NULL, NULL);
+
+    switch (reset_detect->state)
+    {
+        case DRV8305_RESET_DETECT_IDLE:
+        {
+            if(reset_detect->reverted_mask == 0 || mismatch == 0) { return false; }
+
+            reset_detect->detections++;
+            reset_detect->attempts = 0;
+
+            break;
+        }
+
+        case DRV8305_RESET_DETECT_CHECKING:
+        {
+            if(mismatch == 0)
+            {
+                reset_detect->state = DRV8305_RESET_DETECT_IDLE;
+                return false;
+            }
+
+            reset_detect->detections++;
+            reset_detect->attempts = 0;
+
+            break;
+        }
+
+        case DRV8305_RESET_DETECT_REPROGRAMMING:
+        {
+            if(mismatch != 0 && ++reset_detect->attempts >= (uint16_t)DRV8305_RESET_REPROGRAM_ATTEMPTS)
+            {
+                reset_detect->failures++;
+            }
+
+            if(mismatch == 0 || reset_detect->attempts >= (uint16_t)DRV8305_RESET_REPROGRAM_ATTEMPTS)
+            {
+                reset_detect->state = DRV8305_RESET_DETECT_IDLE;
+                return false;
+            }
+
+            break;
+        }
+    }
+
+    drv8305_reset_detect_reprogram(self, mismatch);
+
+    return true;
 }
 
-DRV8305_PRIVATE uint16_t drv8305_control_register_0A_parser (drv8305_user_object_t *self)
+/**
+ * @brief Start a re-programming pass of the given registers (internal)
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @param[in] register_mask Registers to write and read back, DRV8305_CONTROL_REGISTER_BIT()
+ * @return None
+ * @note The caller owns the main state machine transition
+ */
+DRV8305_PRIVATE void drv8305_reset_detect_reprogram(drv8305_user_object_t *self, uint16_t register_mask)
 {
-    return DRV8305_PACK_CTRL0A(self->config.shunt_amplifier);
+    for(uint16_t bits = register_mask; bits != 0; bits &= (uint16_t)(bits - 1U))
+    {
+        self->reset_detect.reprogrammed++;
+    }
+
+    self->reset_detect.state = DRV8305_RESET_DETECT_REPROGRAMMING;
+    self->control_write_mask = register_mask;
+
+    drv8305_control_sm_go_to_next_state(self, DRV8305_SM_CONTROL_HS_GATE_DRIVE_REG, DRV8305_RESET_STEP_DELAY_MS);
 }
 
-DRV8305_PRIVATE uint16_t drv8305_control_register_0B_parser (drv8305_user_object_t *self)
+/**
+ * @brief Credit the scrubber for one SPI frame (internal)
+ * @details Credit saturates at one slot, so an idle bus never builds up a burst of scrub reads.
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @return None
+ */
+DRV8305_PRIVATE void drv8305_scrubber_earn(drv8305_user_object_t *self)
 {
-    return DRV8305_PACK_CTRL0B(self->config.voltage_regulator);
+    uint16_t credit = (uint16_t)(self->scrubber.credit + self->scrubber.budget);
+
+    self->scrubber.credit = (credit > (uint16_t)DRV8305_SCRUB_BUDGET_SCALE) ? (uint16_t)DRV8305_SCRUB_BUDGET_SCALE : credit;
 }
 
-DRV8305_PRIVATE uint16_t drv8305_control_register_0C_parser (drv8305_user_object_t *self)
+/**
+ * @brief Read back one control register if the budget allows (internal)
+ * @details Runs while the main state machine waits for IDLE or sits in IDLE with no status
+ *          scan due, without a state transition, so a scan is never delayed. A mismatch re-applies that register through
+ *          the re-programming path; a readback at the reset word counts as a device reset.
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @return true if a scrub read was made
+ */
+DRV8305_PRIVATE bool drv8305_scrubber_step(drv8305_user_object_t *self)
 {
-    return DRV8305_PACK_CTRL0C(self->config.vds_sense);
+    drv8305_scrubber_t *scrubber = &self->scrubber;
+
+    if(!self->reset_detect.armed || scrubber->budget == 0 || scrubber->credit < (uint16_t)DRV8305_SCRUB_BUDGET_SCALE) { return false; }
+
+    uint16_t index       = scrubber->next_index;
+    uint16_t array_index = (uint16_t)(DRV8305_CONTROL_05_ARRAY_INDEX + index);
+
+    scrubber->credit     = (uint16_t)(scrubber->credit - DRV8305_SCRUB_BUDGET_SCALE);
+    scrubber->next_index = (uint16_t)((index + 1U) % (uint16_t)DRV8305_NUMBER_OF_CONTROL_REGISTERS);
+
+    self->register_manager[array_index].data = drv8305_spi_read_command_process(self, self->register_manager[array_index].type);
+    scrubber->reads++;
+
+    drv8305_reset_detect_readback(self, array_index);
+    drv8305_register_snapshot_publish(self);
+
+    if(((self->register_manager[array_index].data ^ drv8305_api_get_control_word(self, array_index)) & drv8305_control_verify_mask[index]) == 0) { return true; }
+
+    scrubber->mismatches++;
+
+    if(self->reset_detect.reverted_mask & DRV8305_CONTROL_REGISTER_BIT(array_index))
+    {
+        self->reset_detect.detections++;
+    }
+
+    self->reset_detect.attempts = 0;
+
+    drv8305_reset_detect_reprogram(self, DRV8305_CONTROL_REGISTER_BIT(array_index));
+    drv8305_main_sm_go_to_next_state(self, DRV8305_CONTROL_STATE, DRV8305_RESET_STEP_DELAY_MS);
+
+    return true;
 }
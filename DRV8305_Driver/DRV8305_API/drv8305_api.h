@@ -18,6 +18,12 @@
  * @dependencies
  *   - drv8305_register_map.h (register address definitions)
  *   - drv8305_configuration.h (configuration structures)
+ *   - drv8305_snapshot.h (lock-free register snapshot)
+ *   - drv8305_event_ring.h (status event ring)
+ *   - drv8305_statistics.h (per-bit status statistics, -DDRV8305_STATISTICS)
+ *   - drv8305_status_summary.h (consolidated per-scan status)
+ *   - drv8305_postmortem.h (fault capture preserved across reset)
+ *   - drv8305_trace.h (SPI frame trace, -DDRV8305_SPI_TRACE)
  */
 
 #ifndef DRV8305_API_H_
@@ -33,6 +39,14 @@ extern "C" {
 #include "drv8305_macros.h"
 #include "drv8305_register_map.h"
 #include "DRV8305_Config/drv8305_configuration.h"
+#include "DRV8305_Config/drv8305_register_image.h"
+#include "DRV8305_Config/drv8305_packed_configuration.h"
+#include "DRV8305_Snapshot/drv8305_snapshot.h"
+#include "DRV8305_Events/drv8305_event_ring.h"
+#include "DRV8305_Statistics/drv8305_statistics.h"
+#include "DRV8305_Status_Registers/drv8305_status_summary.h"
+#include "DRV8305_PostMortem/drv8305_postmortem.h"
+#include "DRV8305_Trace/drv8305_trace.h"
 
 /**
  * @brief DRV8305 Register Address Map
@@ -58,11 +72,12 @@ typedef enum
 
 typedef enum
 {
-    DRV8305_INIT_STATE,    // -> Initialize all driver registers
-    DRV8305_IDLE_STATE,    // -> Idle state
-    DRV8305_STATUS_STATE,  // -> DRV8305 status process
-    DRV8305_CONTROL_STATE, // -> DRV8305 control process
-    DRV8305_DELAY_STATE,   // -> Delay state
+    DRV8305_INIT_STATE,     // -> Initialize all driver registers
+    DRV8305_IDLE_STATE,     // -> Idle state
+    DRV8305_STATUS_STATE,   // -> DRV8305 status process
+    DRV8305_CONTROL_STATE,  // -> DRV8305 control process
+    DRV8305_RECOVERY_STATE, // -> DRV8305 latched fault recovery
+    DRV8305_DELAY_STATE,    // -> Delay state
 } drv8305_sm_state_e;
 
 typedef enum
@@ -97,6 +112,41 @@ typedef enum
     DRV8305_SM_CONTROL_CYCLE_DELAY,                // Delay state    
 } drv8305_control_sm_state_e;
 
+typedef enum
+{
+    DRV8305_SM_RECOVERY_CLEAR_FAULTS,              // Control 0x09: Write programmed word | CLR_FLTS
+    DRV8305_SM_RECOVERY_VERIFY_OV_VDS_REG,         // Status 0x02
+    DRV8305_SM_RECOVERY_VERIFY_IC_FAULTS_REG,      // Status 0x03
+    DRV8305_SM_RECOVERY_VERIFY_VGS_FAULTS_REG,     // Status 0x04
+    DRV8305_SM_RECOVERY_CYCLE_DELAY,               // Delay state
+} drv8305_recovery_sm_state_e;
+
+typedef enum
+{
+    DRV8305_RECOVERY_DISABLED, // -> No policy installed, latched faults stay latched
+    DRV8305_RECOVERY_IDLE,     // -> No latched fault
+    DRV8305_RECOVERY_ACTIVE,   // -> Backing off or clearing a recoverable fault
+    DRV8305_RECOVERY_LATCHED,  // -> Non-recoverable fault or attempts exhausted
+} drv8305_recovery_status_e;
+
+typedef enum
+{
+    DRV8305_COMMIT_IDLE,         // -> No commit requested yet
+    DRV8305_COMMIT_PENDING,      // -> Requested, waiting for the next safe point (IDLE)
+    DRV8305_COMMIT_WRITING,      // -> Writing and verifying the differing registers
+    DRV8305_COMMIT_ROLLING_BACK, // -> Verify failed, writing the previous words back
+    DRV8305_COMMIT_DONE,         // -> Staged profile active and verified
+    DRV8305_COMMIT_ROLLED_BACK,  // -> Previous profile restored and verified
+    DRV8305_COMMIT_FAILED,       // -> Rollback did not verify either
+} drv8305_commit_status_e;
+
+typedef enum
+{
+    DRV8305_RESET_DETECT_IDLE,          // -> Registers hold the programmed words
+    DRV8305_RESET_DETECT_CHECKING,      // -> Brown-out bit raised, reading back every control register
+    DRV8305_RESET_DETECT_REPROGRAMMING, // -> Re-applying the registers that lost their words
+} drv8305_reset_detect_state_e;
+
 typedef struct 
 {
     uint16_t (*drv8305_spi_write_and_read_from_register_cb) (uint16_t data);
@@ -117,6 +167,7 @@ typedef struct
 {
     uint32_t                   cycle_time;
     uint32_t                   delay_time;
+    uint32_t                   system_time; // Monotonic tick count (never reset by transitions)
 
     drv8305_sm_state_e         main_state;
     drv8305_sm_state_e         next_main_state;
@@ -126,8 +177,16 @@ typedef struct
 
     drv8305_control_sm_state_e control_state;
     drv8305_control_sm_state_e next_control_state;
+
+    drv8305_recovery_sm_state_e recovery_state;
+    drv8305_recovery_sm_state_e next_recovery_state;
 } drv8305_state_machine_t;
 
+/**
+ * @brief Per-register status callbacks
+ * @note Called only when the register data (bits 10:0) changed since the previous scan.
+ *       Each callback is optional (NULL = not used).
+ */
 typedef struct
 {
     void (*drv8305_warning_register_cb)    (void *self, uint16_t data);
@@ -136,6 +195,102 @@ typedef struct
     void (*drv8305_vgs_faults_register_cb) (void *self, uint16_t data);
 } drv8305_status_register_cb_t;
 
+/**
+ * @brief Consolidated status callback, called once per completed status scan
+ * @param[in] self Pointer to DRV8305 user object
+ * @param[in] summary Summary of the scan (age is 0)
+ */
+typedef void (*drv8305_status_summary_cb_t)(void *self, const drv8305_status_summary_t *summary);
+
+/**
+ * @brief Edge-triggered status change callback
+ * @param[in] self Pointer to DRV8305 user object
+ * @param[in] status_index Status register index (DRV8305_STATUS_0x_ARRAY_INDEX)
+ * @param[in] data New register data (bits 10:0)
+ * @param[in] raised Bits that changed 0 -> 1 since the previous scan
+ * @param[in] cleared Bits that changed 1 -> 0 since the previous scan
+ */
+typedef void (*drv8305_status_change_cb_t)(void *self, uint16_t status_index, uint16_t data, uint16_t raised, uint16_t cleared);
+
+typedef struct
+{
+    drv8305_status_change_cb_t callback;
+    uint16_t                   interest_mask[DRV8305_NUMBER_OF_STATUS_REGISTERS]; // Bits that wake this subscriber
+} drv8305_status_subscriber_t;
+
+typedef struct
+{
+    uint16_t                    previous[DRV8305_NUMBER_OF_STATUS_REGISTERS];  // Data of previous scan (bits 10:0)
+    drv8305_status_subscriber_t subscribers[DRV8305_STATUS_MAX_SUBSCRIBERS];
+} drv8305_status_edge_t;
+
+/**
+ * @brief Emergency hook of the protective policy
+ * @param[in] self Pointer to DRV8305 user object
+ * @param[in] status_index Status register index (DRV8305_STATUS_0x_ARRAY_INDEX)
+ * @param[in] data Register data that tripped the policy (bits 10:0)
+ * @param[in] trip Newly raised bits inside the emergency mask
+ * @note Runs inline in the polling context right after the frame was read; keep it short
+ */
+typedef void (*drv8305_emergency_cb_t)(void *self, uint16_t status_index, uint16_t data, uint16_t trip);
+
+typedef struct
+{
+    uint16_t               shutdown_mask[DRV8305_NUMBER_OF_STATUS_REGISTERS];   // Set bit -> EN_GATE low (level)
+    uint16_t               emergency_mask[DRV8305_NUMBER_OF_STATUS_REGISTERS];  // Raised bit -> emergency hook (edge)
+    drv8305_emergency_cb_t emergency_cb;                                        // May be NULL
+    uint32_t               shutdown_count;                                      // Protective EN_GATE low transitions
+} drv8305_protection_policy_t;
+
+typedef struct
+{
+    drv8305_recovery_status_e status;
+    uint16_t                  recoverable_mask[DRV8305_NUMBER_OF_STATUS_REGISTERS]; // Faults cleared with CLR_FLTS
+    bool                      rearm_en_gate;                                        // EN_GATE high after success
+    uint16_t                  attempts;                                             // Consecutive failed attempts
+    uint32_t                  backoff;                                              // Wait before next attempt (ticks)
+    uint32_t                  recoveries;                                           // Successful recoveries
+} drv8305_recovery_t;
+
+/** @brief Status 0x03 bits after which the control registers may be back at their reset words **/
+#define DRV8305_RESET_DETECT_IC_FAULTS  (DRV8305_IC_PVDD_UVLO2 | DRV8305_IC_VREG_UV)
+
+typedef struct
+{
+    drv8305_reset_detect_state_e state;
+    uint16_t                     reverted_mask; // Registers whose last readback equals the reset word, DRV8305_CONTROL_REGISTER_BIT()
+    uint16_t                     attempts;      // Re-programming passes of the current detection
+    uint32_t                     detections;    // Device resets detected
+    uint32_t                     reprogrammed;  // Control registers re-applied
+    uint32_t                     failures;      // Detections given up after DRV8305_RESET_REPROGRAM_ATTEMPTS
+    bool                         armed;         // A control pass completed, the device holds programmed words
+} drv8305_reset_detect_t;
+
+typedef struct
+{
+    uint16_t budget;     // Share of SPI frames in percent (0 = scrubber off)
+    uint16_t credit;     // Earns budget per SPI frame, a scrub read costs DRV8305_SCRUB_BUDGET_SCALE
+    uint16_t next_index; // Next control register to read, packed word order
+    uint32_t reads;      // Scrub readbacks
+    uint32_t mismatches; // Readbacks that differed from the programmed word
+} drv8305_scrubber_t;
+
+#if defined(DRV8305_RUNTIME_TIMING)
+typedef struct
+{
+    uint32_t control_gap_ms; // After each control register write or readback
+    uint32_t status_gap_ms;  // After each status register read of a scan
+    uint32_t reset_gap_ms;   // After each access of a reset re-programming pass
+} drv8305_timing_profile_t;
+#endif
+
+typedef struct
+{
+    drv8305_commit_status_e        status;
+    uint16_t                       register_mask; // Registers written by the commit, DRV8305_CONTROL_REGISTER_BIT()
+    drv8305_packed_configuration_t previous;      // Active profile before the commit (rollback words)
+} drv8305_configuration_commit_t;
+
 typedef struct
 {
     void (*drv8305_hs_gate_drive_control_register_cb)     (void *self, uint16_t data);
@@ -167,12 +322,55 @@ typedef struct
 
     drv8305_control_register_cb_t                 control_callbacks;
     drv8305_status_register_cb_t                  status_callbacks;
+    drv8305_status_summary_cb_t                   status_summary_callback; // Optional (NULL = not used)
     drv8305_hardware_low_level_cb_t               hw_callbacks;
 
-    drv8305_configuration_t                       config;    
+    drv8305_packed_configuration_t                config;         // Working copy, one word per control register
+
+    const drv8305_register_image_t               *register_image; // Precomputed control words (NULL = pack config)
+
+    drv8305_packed_configuration_t                staged;         // Edited by the application, applied by commit
+
+    drv8305_configuration_commit_t                commit;
+
+    uint16_t                                      control_write_mask; // Registers of the current control pass
 
     drv8305_register_node_t                       register_manager[DRV8305_NUMBER_OF_REGISTERS];
 
+    drv8305_snapshot_publisher_t                  snapshot;
+
+    drv8305_status_edge_t                         status_edges;
+
+    drv8305_event_ring_t                          events;
+
+#if defined(DRV8305_POSTMORTEM_EVENTS)
+    drv8305_event_history_t                       event_history; // Latest events for the post-mortem record
+#endif
+
+    drv8305_status_summary_t                      status_summary;
+
+#if defined(DRV8305_STATISTICS)
+    drv8305_statistics_t                          statistics;
+#endif
+
+    drv8305_protection_policy_t                   protection;
+
+    drv8305_recovery_t                            recovery;
+
+    drv8305_reset_detect_t                        reset_detect;
+
+    drv8305_scrubber_t                            scrubber;
+
+#if defined(DRV8305_RUNTIME_TIMING)
+    drv8305_timing_profile_t                      timing;     // Register gaps (drv8305_timing.h)
+#endif
+
+    drv8305_postmortem_record_t                  *postmortem; // Attached no-init record (NULL = no capture)
+
+#if defined(DRV8305_SPI_TRACE)
+    drv8305_trace_ring_t                          trace;      // Last DRV8305_TRACE_DEPTH SPI frames
+#endif
+
     drv8305_control_register_configuration_flag_t configuration_confirmation_flags;
 } drv8305_user_object_t;
 
@@ -317,6 +515,358 @@ DRV8305_PUBLIC void drv8305_api_confirm_configuration(drv8305_user_object_t *sel
  */
 DRV8305_PUBLIC bool drv8305_api_is_configuration_confirm(drv8305_user_object_t * self);
 
+/**
+ * @brief Program the control registers from a precomputed image
+ * @details While an image is set, the control state machine streams its words as they are
+ *          and readback confirmation compares against them; config is not packed or read.
+ *          Takes effect on the next drv8305_api_confirm_configuration().
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @param[in] image Const image (DRV8305_REGISTER_IMAGE_DEFINE), NULL to use config again
+ * @return None
+ * @note The image is referenced, not copied; it must outlive its use by the driver
+ * @see DRV8305_REGISTER_IMAGE_DEFINE
+ */
+DRV8305_PUBLIC void drv8305_api_set_register_image(drv8305_user_object_t *self, const drv8305_register_image_t *image);
+
+/**
+ * @brief Get the staged configuration profile
+ * @details The staged profile is a second packed configuration the application edits with
+ *          the drv8305_packed_set_*() accessors while the active one (config) keeps driving
+ *          the IC. It is initialized from the active profile by drv8305_api_initialize().
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @return drv8305_packed_configuration_t* Staged profile, NULL if self is NULL
+ * @see drv8305_api_commit_configuration
+ */
+DRV8305_PUBLIC drv8305_packed_configuration_t* drv8305_api_get_staged_configuration(drv8305_user_object_t *self);
+
+/**
+ * @brief Request an atomic switch to the staged profile
+ * @details Applied by the state machine at the next IDLE state, never in the middle of a
+ *          status scan or control pass. Only registers whose word differs from the active
+ *          profile are written and read back. If a readback does not match, the previous
+ *          words are written back (DRV8305_COMMIT_ROLLED_BACK). A commit detaches a
+ *          register image set with drv8305_api_set_register_image().
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @return true if queued, false if a commit is already pending or in progress
+ * @usage
+ * @code
+ * drv8305_packed_configuration_t *staged = drv8305_api_get_staged_configuration(&user_drv8305_obj);
+ * drv8305_packed_set_hs_gate_drive_isink(staged, DRV8305_ISINK_250MA);
+ * drv8305_api_commit_configuration(&user_drv8305_obj);
+ * @endcode
+ */
+DRV8305_PUBLIC bool drv8305_api_commit_configuration(drv8305_user_object_t *self);
+
+/**
+ * @brief Get the state of the last configuration commit
+ * @param[in] self Pointer to DRV8305 user object
+ * @return drv8305_commit_status_e Commit state, DRV8305_COMMIT_IDLE if self is NULL
+ */
+DRV8305_PUBLIC drv8305_commit_status_e drv8305_api_get_commit_status(const drv8305_user_object_t *self);
+
+/**
+ * @brief Get the word the driver programs into a control register
+ * @param[in] self Pointer to DRV8305 user object
+ * @param[in] array_index Control register index (DRV8305_CONTROL_xx_ARRAY_INDEX)
+ * @return uint16_t Register data bits 10:0 (image word, or packed config), 0 if out of range
+ */
+DRV8305_PUBLIC uint16_t drv8305_api_get_control_word(const drv8305_user_object_t *self, uint16_t array_index);
+
+/**
+ * @brief Compare a configuration with the last control register readback
+ * @details Uses the words held in register_manager[]; bits the device does not read back
+ *          as written (CLR_FLTS) are ignored. Call from the driver context.
+ * @param[in] self Pointer to DRV8305 user object
+ * @param[in] desired Configuration to compare (NULL: the words the driver programs)
+ * @param[out] diff Changed registers and bits (may be NULL)
+ * @return uint16_t Register mask of readbacks that differ, 0 if self is NULL
+ */
+DRV8305_PUBLIC uint16_t drv8305_api_diff_readback(const drv8305_user_object_t *self, const drv8305_packed_configuration_t *desired, drv8305_configuration_diff_t *diff);
+
+/**
+ * @brief Get a coherent copy of all 11 registers
+ * @details Copies the last published register image (published after every completed
+ *          status scan and control readback pass). Safe to call from any context,
+ *          including ISRs that preempt drv8305_api_master_sm_polling(); never disables
+ *          interrupts and never blocks the polling context.
+ * @param[in] self Pointer to DRV8305 user object
+ * @param[out] snapshot Destination for register image, sequence number and timestamp
+ * @return true if a coherent copy was taken, false if the copy kept racing with the writer
+ * @note snapshot->sequence is 0 until the first scan has completed
+ * @see drv8305_snapshot_read
+ */
+DRV8305_PUBLIC bool drv8305_api_get_register_snapshot(const drv8305_user_object_t *self, drv8305_snapshot_t *snapshot);
+
+/**
+ * @brief Subscribe to edge-triggered status changes
+ * @details The callback is invoked from the polling context only when at least one bit of
+ *          its interest mask was raised or cleared in the scanned register.
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @param[in] callback Change callback (receives new data, raised and cleared masks)
+ * @param[in] interest_mask Per status register bit mask (DRV8305_NUMBER_OF_STATUS_REGISTERS entries)
+ * @return true if subscribed (or interest mask updated), false if the table is full
+ * @note Subscriptions survive drv8305_api_initialize(); the user object must start zeroed
+ * @see drv8305_api_status_unsubscribe
+ *
+ * @example
+ * @code
+ * const uint16_t interest[DRV8305_NUMBER_OF_STATUS_REGISTERS] =
+ *     { DRV8305_WARN_OTW, DRV8305_VDS_HA | DRV8305_VDS_LA, 0, 0 };
+ * drv8305_api_status_subscribe(&user_drv8305_obj, on_status_change, interest);
+ * @endcode
+ */
+DRV8305_PUBLIC bool drv8305_api_status_subscribe(drv8305_user_object_t *self, drv8305_status_change_cb_t callback, const uint16_t *interest_mask);
+
+/**
+ * @brief Remove a status change subscription
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @param[in] callback Callback passed to drv8305_api_status_subscribe()
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_api_status_unsubscribe(drv8305_user_object_t *self, drv8305_status_change_cb_t callback);
+
+/**
+ * @brief Pop the oldest status change event
+ * @details Every raised or cleared status bit is recorded by the polling context with
+ *          timestamp, register, raised/cleared masks and main state. Intended for a single
+ *          logger task (single consumer); the polling context never waits for it.
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @param[out] event Destination of the event
+ * @return true if an event was returned, false if no event is pending
+ * @see drv8305_api_get_event_overflows
+ */
+DRV8305_PUBLIC bool drv8305_api_pop_event(drv8305_user_object_t *self, drv8305_event_t *event);
+
+/**
+ * @brief Get number of status events dropped because the ring was full
+ * @param[in] self Pointer to DRV8305 user object
+ * @return uint32_t Total dropped events since initialization
+ */
+DRV8305_PUBLIC uint32_t drv8305_api_get_event_overflows(const drv8305_user_object_t *self);
+
+/**
+ * @brief Install the protective-action policy
+ * @details Evaluated inline right after each status frame is read, before any event,
+ *          statistics or callback work:
+ *          - data & shutdown_mask  -> drv8305_api_ic_disable() (EN_GATE low), every scan
+ *            while the bit stays set, so a re-enable with the fault present is undone
+ *          - raised & emergency_mask -> emergency_cb, once per rising edge
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @param[in] shutdown_mask Per status register mask, NULL = bits with DRV8305_ACTION_STOP_MOTOR
+ * @param[in] emergency_mask Per status register mask, NULL = no emergency bits
+ * @param[in] emergency_cb Application emergency hook (may be NULL)
+ * @return None
+ * @note The policy is disabled (all masks zero) until this is called; it survives
+ *       drv8305_api_initialize(), the user object must start zeroed
+ * @see drv8305_api_ic_enable
+ *
+ * @example
+ * @code
+ * const uint16_t emergency[DRV8305_NUMBER_OF_STATUS_REGISTERS] = { 0, DRV8305_VDS_HA | DRV8305_VDS_LA, 0, 0 };
+ * drv8305_api_set_protection_policy(&user_drv8305_obj, NULL, emergency, on_emergency);
+ * @endcode
+ */
+DRV8305_PUBLIC void drv8305_api_set_protection_policy(drv8305_user_object_t *self, const uint16_t *shutdown_mask, const uint16_t *emergency_mask, drv8305_emergency_cb_t emergency_cb);
+
+/**
+ * @brief Install the automatic fault recovery policy
+ * @details After each status scan the latched fault bits of registers 0x02 - 0x04 are
+ *          classified. Any bit outside recoverable_mask latches the recovery out at once.
+ *          Otherwise, after the current backoff, the recovery sub-machine reads 0x09,
+ *          writes it back with CLR_FLTS set and re-reads 0x02 - 0x04. A clean re-read ends
+ *          the recovery; a failed one doubles the backoff (DRV8305_RECOVERY_BACKOFF_MIN_MS
+ *          to DRV8305_RECOVERY_BACKOFF_MAX_MS) and retries, up to DRV8305_RECOVERY_MAX_ATTEMPTS.
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @param[in] recoverable_mask Per status register mask, NULL = driver defaults
+ *            (VDS/sense overcurrent, VGS, charge pump, watchdog, PVDD UVLO2, OTSD)
+ * @param[in] rearm_en_gate true to drive EN_GATE high after a successful recovery
+ * @return None
+ * @note Call after drv8305_api_initialize(), which disables recovery and clears the mask
+ * @see drv8305_api_recovery_unlatch, drv8305_api_get_recovery_status
+ */
+DRV8305_PUBLIC void drv8305_api_set_recovery_policy(drv8305_user_object_t *self, const uint16_t *recoverable_mask, bool rearm_en_gate);
+
+/**
+ * @brief Leave the latched-out recovery state
+ * @details Clears the attempt counter and backoff so recovery restarts on the next scan.
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_api_recovery_unlatch(drv8305_user_object_t *self);
+
+/**
+ * @brief Get current fault recovery status
+ * @param[in] self Pointer to DRV8305 user object
+ * @return drv8305_recovery_status_e Recovery status
+ */
+DRV8305_PUBLIC drv8305_recovery_status_e drv8305_api_get_recovery_status(const drv8305_user_object_t *self);
+
+/**
+ * @brief Get device reset detection counters
+ * @details A reset is detected when a status scan raises DRV8305_RESET_DETECT_IC_FAULTS and
+ *          the following readback differs from the programmed words, or when any control
+ *          readback equals the datasheet reset word instead of the programmed one. Only the
+ *          registers that differ are written again, DRV8305_RESET_STEP_DELAY_MS apart.
+ * @param[in] self Pointer to DRV8305 user object
+ * @param[out] reset_detect Destination for state and counters
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_api_get_reset_detect(const drv8305_user_object_t *self, drv8305_reset_detect_t *reset_detect);
+
+/**
+ * @brief Set the SPI bandwidth share of the background configuration scrubber
+ * @details Between status scans (the wait before IDLE, or IDLE with no scan due), the
+ *          scrubber reads back one control register per slot in round-robin and compares it with the programmed word; a mismatch is
+ *          re-applied through the reset re-programming path. Every SPI frame earns
+ *          budget_percent credit and a scrub read costs DRV8305_SCRUB_BUDGET_SCALE, so scrub
+ *          reads never exceed budget_percent of all frames; status scans always go first.
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @param[in] budget_percent 0 (off) to 100, DRV8305_SCRUB_BUDGET_PERCENT after initialization
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_api_set_scrub_budget(drv8305_user_object_t *self, uint16_t budget_percent);
+
+/**
+ * @brief Get background scrubber state and counters
+ * @param[in] self Pointer to DRV8305 user object
+ * @param[out] scrubber Destination for budget and counters
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_api_get_scrubber(const drv8305_user_object_t *self, drv8305_scrubber_t *scrubber);
+
+#if defined(DRV8305_RUNTIME_TIMING)
+/**
+ * @brief Set the register gaps of control passes and status scans
+ * @details Only built with DRV8305_RUNTIME_TIMING; otherwise the gaps are fixed by
+ *          DRV8305_TIMING_PROFILE (drv8305_timing.h). Takes effect at the next transition.
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @param[in] timing Gaps in milliseconds, the DRV8305_TIMING_PROFILE gaps after initialization
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_api_set_timing_profile(drv8305_user_object_t *self, const drv8305_timing_profile_t *timing);
+#endif
+
+#if defined(DRV8305_SPI_TRACE)
+/**
+ * @brief Export the SPI trace as a dump for Tools/drv8305_trace
+ * @details Only built with DRV8305_SPI_TRACE. Writes the most recent frames, oldest first, in
+ *          the drv8305_trace.h dump format with DRV8305_TRACE_TIMESTAMP_HZ.
+ * @param[in] self Pointer to DRV8305 user object
+ * @param[out] words Destination, DRV8305_TRACE_DUMP_WORDS(DRV8305_TRACE_DEPTH) words for all frames
+ * @param[in] max_words Capacity of words
+ * @return uint32_t Words written
+ * @note Call from the polling context
+ */
+DRV8305_PUBLIC uint32_t drv8305_api_export_trace(const drv8305_user_object_t *self, uint16_t *words, uint32_t max_words);
+#endif
+
+/**
+ * @brief Get summary of the latest completed status scan
+ * @details Pull alternative to status_summary_callback. age is set to the ticks elapsed
+ *          since the scan completed; sequence 0 means no scan has completed yet.
+ * @param[in] self Pointer to DRV8305 user object
+ * @param[out] summary Destination summary
+ * @return None
+ * @note Call from the polling context; use drv8305_api_get_register_snapshot() from others
+ */
+DRV8305_PUBLIC void drv8305_api_get_status_summary(const drv8305_user_object_t *self, drv8305_status_summary_t *summary);
+
+/**
+ * @brief Attach the post-mortem record
+ * @details Call once at boot, after drv8305_api_initialize(). A record sealed before the
+ *          reset stays frozen and is reported by drv8305_api_get_postmortem() until released;
+ *          anything else in the region is cleared.
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @param[in] record Record defined with DRV8305_POSTMORTEM_DEFINE() in no-init RAM
+ * @return true if the record holds a capture from before the reset
+ *
+ * @example
+ * @code
+ * DRV8305_POSTMORTEM_DEFINE(drv8305_postmortem);
+ *
+ * if(drv8305_api_postmortem_attach(&user_drv8305_obj, &drv8305_postmortem)) { upload_postmortem(); }
+ * @endcode
+ */
+DRV8305_PUBLIC bool drv8305_api_postmortem_attach(drv8305_user_object_t *self, drv8305_postmortem_record_t *record);
+
+/**
+ * @brief Capture driver state into the attached post-mortem record
+ * @details Called by the driver on a protective shutdown and when fault recovery latches
+ *          out; the application may call it e.g. before a deliberate reset.
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @param[in] reason Capture reason
+ * @return true if captured, false if no record is attached or a capture is already frozen
+ */
+DRV8305_PUBLIC bool drv8305_api_postmortem_capture(drv8305_user_object_t *self, drv8305_postmortem_reason_e reason);
+
+/**
+ * @brief Copy the frozen post-mortem record for upload
+ * @param[in] self Pointer to DRV8305 user object
+ * @param[out] record Destination copy
+ * @return true if a valid record was copied
+ */
+DRV8305_PUBLIC bool drv8305_api_get_postmortem(const drv8305_user_object_t *self, drv8305_postmortem_record_t *record);
+
+/**
+ * @brief Release the frozen post-mortem record (after upload) and re-arm capture
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_api_postmortem_release(drv8305_user_object_t *self);
+
+#if defined(DRV8305_STATISTICS)
+/**
+ * @brief Export per-bit status statistics
+ * @details Only built with DRV8305_STATISTICS. Occurrence count, cumulative and longest
+ *          continuous active time of all 44 status bits since initialization; bits still
+ *          active include their running time.
+ * @param[in] self Pointer to DRV8305 user object
+ * @param[out] image Destination export image
+ * @return None
+ * @note Call from the polling context (or with polling suspended); the statistics are
+ *       updated there without any locking
+ */
+DRV8305_PUBLIC void drv8305_api_get_statistics(const drv8305_user_object_t *self, drv8305_statistics_export_t *image);
+#endif
+
+/**
+ * @brief Build the SPI frame of one register access
+ * @details For front ends that run the register sequences themselves (drv8305_flow.h) and
+ *          hand the frame to an asynchronous transport.
+ * @param[in] self Pointer to DRV8305 user object
+ * @param[in] array_index Register index (register_manager[] indexing)
+ * @param[in] write true for a write of the programmed control word, false for a read
+ * @return uint16_t SPI command frame
+ */
+DRV8305_PUBLIC uint16_t drv8305_api_frame_create(const drv8305_user_object_t *self, uint16_t array_index, bool write);
+
+/**
+ * @brief Process the response frame of one register access
+ * @details Runs the same path as the state machine: a status read applies the protective
+ *          policy, events, statistics, callbacks and subscribers; a control readback notifies
+ *          the control callback and updates reset detection.
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @param[in] array_index Register index (register_manager[] indexing)
+ * @param[in] frame Command frame that was transmitted (bit 15 clear for a write), traced as sent
+ * @param[in] response Raw response frame
+ * @return uint16_t Status bits raised by a status read, 0 otherwise
+ */
+DRV8305_PUBLIC uint16_t drv8305_api_frame_process(drv8305_user_object_t *self, uint16_t array_index, uint16_t frame, uint16_t response);
+
+/**
+ * @brief Publish a completed status scan (snapshot and status summary)
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_api_scan_complete(drv8305_user_object_t *self);
+
+/**
+ * @brief Publish a completed control pass (snapshot) and arm reset detection
+ * @param[in,out] self Pointer to DRV8305 user object
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_api_control_pass_complete(drv8305_user_object_t *self);
+
 #ifdef __cplusplus
 }
 #endif
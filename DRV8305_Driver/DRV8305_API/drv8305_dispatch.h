@@ -0,0 +1,136 @@
+/**
+ * @file drv8305_dispatch.h
+ * @brief DRV8305 Call Dispatch - Callback Tables or Compile-Time Port Binding
+ * @details Resolves every hardware access and register notification made by drv8305_api.c,
+ *          either through the callback tables of the user object (default) or directly to
+ *          the functions of a port header selected at build time.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * Internal to drv8305_api.c. The state machines only use the DRV8305_DISPATCH_*() macros:
+ *   - DRV8305_DISPATCH_SPI_TRANSFER(self, frame): one 16-bit SPI frame, returns the response
+ *   - DRV8305_DISPATCH_ENABLE_IO / DISABLE_IO / SLEEP_IO / WAKE_UP_IO(self): GPIO
+ *   - DRV8305_DISPATCH_STATUS(self, status_index, data): per-register status notification
+ *   - DRV8305_DISPATCH_CONTROL(self, array_index, data): control register readback notification
+ *
+ * @static_dispatch
+ * Build with -DDRV8305_STATIC_DISPATCH and provide DRV8305_PORT_HEADER (default
+ * "drv8305_port.h") defining the same operations as DRV8305_PORT_*() macros. The calls become
+ * direct calls the compiler can inline into the polling path; hw_callbacks, status_callbacks
+ * and control_callbacks are then ignored and may stay unset. Subscribers, the summary callback
+ * and the emergency hook are registered at run time and stay function pointers.
+ *
+ * @port_header
+ *   #define DRV8305_PORT_SPI_TRANSFER(self, frame)          board_spi_transfer(frame)
+ *   #define DRV8305_PORT_ENABLE_IO(self)                    board_en_gate(true)
+ *   #define DRV8305_PORT_DISABLE_IO(self)                   board_en_gate(false)
+ *   #define DRV8305_PORT_SLEEP_IO(self)                     board_wake(false)
+ *   #define DRV8305_PORT_WAKE_UP_IO(self)                   board_wake(true)
+ *   #define DRV8305_PORT_STATUS_NOTIFY(self, index, data)   board_status(self, index, data)
+ *   #define DRV8305_PORT_CONTROL_NOTIFY(self, index, data)  board_control(self, index, data)
+ */
+
+#ifndef DRV8305_DISPATCH_H_
+#define DRV8305_DISPATCH_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "drv8305_macros.h"
+#include "drv8305_api.h"
+
+#if defined(DRV8305_STATIC_DISPATCH)
+
+#ifndef DRV8305_PORT_HEADER
+#define DRV8305_PORT_HEADER "drv8305_port.h"
+#endif
+
+#include DRV8305_PORT_HEADER
+
+#define DRV8305_DISPATCH_SPI_TRANSFER(self, frame)          DRV8305_PORT_SPI_TRANSFER(self, frame)
+#define DRV8305_DISPATCH_ENABLE_IO(self)                    DRV8305_PORT_ENABLE_IO(self)
+#define DRV8305_DISPATCH_DISABLE_IO(self)                   DRV8305_PORT_DISABLE_IO(self)
+#define DRV8305_DISPATCH_SLEEP_IO(self)                     DRV8305_PORT_SLEEP_IO(self)
+#define DRV8305_DISPATCH_WAKE_UP_IO(self)                   DRV8305_PORT_WAKE_UP_IO(self)
+#define DRV8305_DISPATCH_STATUS(self, status_index, data)   DRV8305_PORT_STATUS_NOTIFY(self, status_index, data)
+#define DRV8305_DISPATCH_CONTROL(self, array_index, data)   DRV8305_PORT_CONTROL_NOTIFY(self, array_index, data)
+
+#else
+
+#define DRV8305_DISPATCH_SPI_TRANSFER(self, frame)          ((self)->hw_callbacks.drv8305_spi_write_and_read_from_register_cb(frame))
+#define DRV8305_DISPATCH_ENABLE_IO(self)                    ((self)->hw_callbacks.drv8305_enable_io())
+#define DRV8305_DISPATCH_DISABLE_IO(self)                   ((self)->hw_callbacks.drv8305_disable_io())
+#define DRV8305_DISPATCH_SLEEP_IO(self)                     ((self)->hw_callbacks.drv8305_sleep_io())
+#define DRV8305_DISPATCH_WAKE_UP_IO(self)                   ((self)->hw_callbacks.drv8305_wake_up_io())
+#define DRV8305_DISPATCH_STATUS(self, status_index, data)   drv8305_dispatch_status_callback(self, status_index, data)
+#define DRV8305_DISPATCH_CONTROL(self, array_index, data)   drv8305_dispatch_control_callback(self, array_index, data)
+
+/**
+ * @brief Call the status_callbacks entry of a status register
+ * @param[in] self Pointer to DRV8305 user object
+ * @param[in] status_index Status register index (DRV8305_STATUS_0x_ARRAY_INDEX)
+ * @param[in] data Raw status frame
+ * @return None
+ */
+DRV8305_INLINE void drv8305_dispatch_status_callback(drv8305_user_object_t *self, uint16_t status_index, uint16_t data)
+{
+    void (*callback)(void *self, uint16_t data) = NULL;
+
+    switch (status_index)
+    {
+        case DRV8305_STATUS_01_ARRAY_INDEX: { callback = self->status_callbacks.drv8305_warning_register_cb;    break; }
+        case DRV8305_STATUS_02_ARRAY_INDEX: { callback = self->status_callbacks.drv8305_ov_vds_register_cb;     break; }
+        case DRV8305_STATUS_03_ARRAY_INDEX: { callback = self->status_callbacks.drv8305_ic_faults_register_cb;  break; }
+        case DRV8305_STATUS_04_ARRAY_INDEX: { callback = self->status_callbacks.drv8305_vgs_faults_register_cb; break; }
+        default:                            { break; }
+    }
+
+    if(callback != NULL)
+    {
+        callback(self, data);
+    }
+}
+
+/**
+ * @brief Call the control_callbacks entry of a control register
+ * @param[in] self Pointer to DRV8305 user object
+ * @param[in] array_index Control register index (DRV8305_CONTROL_xx_ARRAY_INDEX)
+ * @param[in] data Raw readback frame
+ * @return None
+ */
+DRV8305_INLINE void drv8305_dispatch_control_callback(drv8305_user_object_t *self, uint16_t array_index, uint16_t data)
+{
+    void (*callback)(void *self, uint16_t data) = NULL;
+
+    switch (array_index)
+    {
+        case DRV8305_CONTROL_05_ARRAY_INDEX: { callback = self->control_callbacks.drv8305_hs_gate_drive_control_register_cb;     break; }
+        case DRV8305_CONTROL_06_ARRAY_INDEX: { callback = self->control_callbacks.drv8305_ls_gate_drive_control_register_cb;     break; }
+        case DRV8305_CONTROL_07_ARRAY_INDEX: { callback = self->control_callbacks.drv8305_gate_drive_control_register_cb;        break; }
+        case DRV8305_CONTROL_09_ARRAY_INDEX: { callback = self->control_callbacks.drv8305_ic_operation_register_cb;              break; }
+        case DRV8305_CONTROL_0A_ARRAY_INDEX: { callback = self->control_callbacks.drv8305_shunt_amplifier_control_register_cb;   break; }
+        case DRV8305_CONTROL_0B_ARRAY_INDEX: { callback = self->control_callbacks.drv8305_voltage_regulator_control_register_cb; break; }
+        case DRV8305_CONTROL_0C_ARRAY_INDEX: { callback = self->control_callbacks.drv8305_vds_sense_control_register_cb;         break; }
+        default:                             { break; }
+    }
+
+    if(callback != NULL)
+    {
+        callback(self, data);
+    }
+}
+
+#endif /* DRV8305_STATIC_DISPATCH */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRV8305_DISPATCH_H_ */
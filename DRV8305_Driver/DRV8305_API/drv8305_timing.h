@@ -0,0 +1,63 @@
+/**
+ * @file drv8305_timing.h
+ * @brief DRV8305 Timing Policy - Compile-Time Profile or Run-Time Timing Profile
+ * @details Resolves the gaps between the register accesses of a control pass or a status scan,
+ *          either to constants of the build-time DRV8305_TIMING_PROFILE (default) or to the
+ *          drv8305_timing_profile_t of the user object.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * Internal to the driver front ends (drv8305_api.c, drv8305_flow.c). They only use:
+ *   - DRV8305_TIMING_CONTROL_GAP(self): after each control register write or readback
+ *   - DRV8305_TIMING_STATUS_GAP(self): after each status register read of a scan
+ *   - DRV8305_TIMING_RESET_GAP(self): after each access of a reset re-programming pass
+ *   - DRV8305_TIMING_ELIDE_ZERO_DELAY: a zero delay skips the CYCLE_DELAY state
+ *
+ * @compile_time_profile
+ * Default. The gaps are integer constants, so every transition stores an immediate and
+ * drv8305_control_step_delay() folds. With -DDRV8305_TIMING_PROFILE=DRV8305_TIMING_PROFILE_BURST
+ * the gaps are 0 and DRV8305_TIMING_ELIDE_ZERO_DELAY removes the delay state from those
+ * transitions: the next register access runs on the next poll.
+ *
+ * @runtime_profile
+ * Build with -DDRV8305_RUNTIME_TIMING to read the gaps from self->timing
+ * (drv8305_api_set_timing_profile()). Every transition then loads its gap from the object and
+ * a zero gap still passes once through the delay state.
+ */
+
+#ifndef DRV8305_TIMING_H_
+#define DRV8305_TIMING_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#include "drv8305_macros.h"
+#include "drv8305_api.h"
+
+#if defined(DRV8305_RUNTIME_TIMING)
+
+#define DRV8305_TIMING_CONTROL_GAP(self)    ((self)->timing.control_gap_ms)
+#define DRV8305_TIMING_STATUS_GAP(self)     ((self)->timing.status_gap_ms)
+#define DRV8305_TIMING_RESET_GAP(self)      ((self)->timing.reset_gap_ms)
+#define DRV8305_TIMING_ELIDE_ZERO_DELAY     0
+
+#else
+
+#define DRV8305_TIMING_CONTROL_GAP(self)    ((uint32_t)DRV8305_CONTROL_REGISTER_GAP_MS)
+#define DRV8305_TIMING_STATUS_GAP(self)     ((uint32_t)DRV8305_STATUS_REGISTER_GAP_MS)
+#define DRV8305_TIMING_RESET_GAP(self)      ((uint32_t)DRV8305_RESET_REGISTER_GAP_MS)
+#define DRV8305_TIMING_ELIDE_ZERO_DELAY     (DRV8305_TIMING_PROFILE == DRV8305_TIMING_PROFILE_BURST)
+
+#endif /* DRV8305_RUNTIME_TIMING */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRV8305_TIMING_H_ */
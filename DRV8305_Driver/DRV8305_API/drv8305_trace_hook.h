@@ -0,0 +1,68 @@
+/**
+ * @file drv8305_trace_hook.h
+ * @brief DRV8305 SPI Trace Hook - Frame Recording or Nothing
+ * @details Resolves the trace point after every SPI frame of drv8305_api.c, either to a record
+ *          in the user object's trace ring (-DDRV8305_SPI_TRACE) or to an empty statement.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * Internal to drv8305_api.c. The frame paths only use:
+ *   - DRV8305_TRACE_FRAME(self, tx, rx): after DRV8305_DISPATCH_SPI_TRANSFER() returned and in
+ *     drv8305_api_frame_process() for frames completed by an asynchronous transport
+ *
+ * @cost
+ * Enabled: one timestamp read, the state word and five stores (drv8305_trace_ring_record()).
+ * Disabled: no code and no ring in drv8305_user_object_t.
+ */
+
+#ifndef DRV8305_TRACE_HOOK_H_
+#define DRV8305_TRACE_HOOK_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#include "drv8305_macros.h"
+#include "drv8305_api.h"
+#include "DRV8305_Trace/drv8305_trace.h"
+
+#if defined(DRV8305_SPI_TRACE)
+
+#define DRV8305_TRACE_FRAME(self, tx, rx)   drv8305_trace_ring_record(&(self)->trace, DRV8305_TRACE_TIMESTAMP(self), (tx), (rx), drv8305_trace_state(self))
+
+/**
+ * @brief Pack the state machine position of a traced frame
+ * @param[in] self Pointer to DRV8305 user object
+ * @return uint16_t Main state [7:0], sub-state of the status, control or recovery machine [15:8]
+ */
+DRV8305_INLINE uint16_t drv8305_trace_state(const drv8305_user_object_t *self)
+{
+    uint16_t sub_state = 0;
+
+    switch (self->state.main_state)
+    {
+        case DRV8305_STATUS_STATE:   { sub_state = (uint16_t)self->state.status_state;   break; }
+        case DRV8305_CONTROL_STATE:  { sub_state = (uint16_t)self->state.control_state;  break; }
+        case DRV8305_RECOVERY_STATE: { sub_state = (uint16_t)self->state.recovery_state; break; }
+        default:                     { break; }
+    }
+
+    return (uint16_t)((uint16_t)self->state.main_state | (uint16_t)(sub_state << 8));
+}
+
+#else
+
+#define DRV8305_TRACE_FRAME(self, tx, rx)   do { } while(0)
+
+#endif /* DRV8305_SPI_TRACE */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRV8305_TRACE_HOOK_H_ */
@@ -0,0 +1,140 @@
+/**
+ * @file drv8305_config_blob.c
+ * @brief DRV8305 Configuration Blob - Implementation
+ * @details Implements serialization, validation and loading of the configuration blob.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * This implementation file contains:
+ *   - Blob sealing (header + CRC-32 over words 0-10)
+ *   - Ordered validation: magic, version, length, variant, CRC, field ranges
+ *   - Loading of the seven register words into a packed configuration
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "drv8305_macros.h"
+#include "DRV8305_Utils/drv8305_crc.h"
+#include "drv8305_config_blob.h"
+
+/**@brief: The blob is read and CRC-checked as a plain 13-word array **/
+typedef char drv8305_config_blob_size_check[(sizeof(drv8305_config_blob_t) == DRV8305_CONFIG_BLOB_WORDS * sizeof(uint16_t)) ? 1 : -1];
+typedef char drv8305_config_blob_crc_offset_check[(offsetof(drv8305_config_blob_t, crc_low) == (DRV8305_CONFIG_BLOB_WORDS - 2) * sizeof(uint16_t)) ? 1 : -1];
+
+DRV8305_PRIVATE uint32_t drv8305_config_blob_crc   (const drv8305_config_blob_t *blob);
+DRV8305_PRIVATE bool     drv8305_config_blob_fields(const drv8305_config_blob_t *blob);
+
+/* -------------------------------- PUBLIC FUNCTIONS -------------------------------- */
+
+/**
+ * @brief Build a blob (implementation)
+ * @param[out] blob Destination blob
+ * @param[in] cfg Packed configuration
+ * @param[in] variant Device variant tag
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_config_blob_serialize(drv8305_config_blob_t *blob, const drv8305_packed_configuration_t *cfg, drv8305_device_variant_e variant)
+{
+    if(!blob || !cfg) { return; }
+
+    blob->magic      = DRV8305_CONFIG_BLOB_MAGIC;
+    blob->version    = DRV8305_CONFIG_BLOB_VERSION;
+    blob->variant    = (uint16_t)variant;
+    blob->word_count = (uint16_t)DRV8305_NUMBER_OF_CONTROL_REGISTERS;
+
+    for(int index = 0; index < DRV8305_NUMBER_OF_CONTROL_REGISTERS; index++)
+    {
+        blob->registers[index] = cfg->word[index] & DRV8305_REGISTER_DATA_MASK;
+    }
+
+    uint32_t crc = drv8305_config_blob_crc(blob);
+
+    blob->crc_low  = (uint16_t)(crc & 0xFFFFU);
+    blob->crc_high = (uint16_t)(crc >> 16);
+}
+
+/**
+ * @brief Check a blob (implementation)
+ * @param[in] blob Blob to check
+ * @param[in] variant Running device variant
+ * @return drv8305_blob_status_e DRV8305_BLOB_OK or the first failed check
+ */
+DRV8305_PUBLIC drv8305_blob_status_e drv8305_config_blob_validate(const drv8305_config_blob_t *blob, drv8305_device_variant_e variant)
+{
+    if(!blob || blob->magic != DRV8305_CONFIG_BLOB_MAGIC) { return DRV8305_BLOB_BAD_MAGIC; }
+
+    if(blob->version != DRV8305_CONFIG_BLOB_VERSION) { return DRV8305_BLOB_BAD_VERSION; }
+
+    if(blob->word_count != (uint16_t)DRV8305_NUMBER_OF_CONTROL_REGISTERS) { return DRV8305_BLOB_BAD_LENGTH; }
+
+    if(variant != DRV8305_VARIANT_ANY && blob->variant != (uint16_t)DRV8305_VARIANT_ANY && blob->variant != (uint16_t)variant)
+    {
+        return DRV8305_BLOB_BAD_VARIANT;
+    }
+
+    uint32_t crc = ((uint32_t)blob->crc_high << 16) | blob->crc_low;
+
+    if(crc != drv8305_config_blob_crc(blob)) { return DRV8305_BLOB_BAD_CRC; }
+
+    if(!drv8305_config_blob_fields(blob)) { return DRV8305_BLOB_BAD_FIELD; }
+
+    return DRV8305_BLOB_OK;
+}
+
+/**
+ * @brief Validate and load a blob (implementation)
+ * @param[in] blob Blob to load
+ * @param[in] variant Running device variant
+ * @param[out] cfg Destination packed configuration
+ * @return drv8305_blob_status_e DRV8305_BLOB_OK if cfg was loaded
+ */
+DRV8305_PUBLIC drv8305_blob_status_e drv8305_config_blob_deserialize(const drv8305_config_blob_t *blob, drv8305_device_variant_e variant, drv8305_packed_configuration_t *cfg)
+{
+    drv8305_blob_status_e status = drv8305_config_blob_validate(blob, variant);
+
+    if(status != DRV8305_BLOB_OK || !cfg) { return status; }
+
+    for(int index = 0; index < DRV8305_NUMBER_OF_CONTROL_REGISTERS; index++)
+    {
+        cfg->word[index] = blob->registers[index];
+    }
+
+    return DRV8305_BLOB_OK;
+}
+
+/* -------------------------------- PRIVATE FUNCTIONS -------------------------------- */
+
+/**
+ * @brief CRC-32 of the blob words before crc_low (internal)
+ * @param[in] blob Blob
+ * @return uint32_t CRC-32
+ */
+DRV8305_PRIVATE uint32_t drv8305_config_blob_crc(const drv8305_config_blob_t *blob)
+{
+    return drv8305_crc32_words(DRV8305_CRC32_INIT, (const uint16_t *)blob, (uint32_t)(offsetof(drv8305_config_blob_t, crc_low) / sizeof(uint16_t)));
+}
+
+/**
+ * @brief Reject words the IC cannot hold or reserved codes (internal)
+ * @param[in] blob Blob with a valid CRC
+ * @return true if every register word is programmable
+ */
+DRV8305_PRIVATE bool drv8305_config_blob_fields(const drv8305_config_blob_t *blob)
+{
+    drv8305_packed_configuration_t cfg;
+
+    for(int index = 0; index < DRV8305_NUMBER_OF_CONTROL_REGISTERS; index++)
+    {
+        if((blob->registers[index] & ~DRV8305_REGISTER_DATA_MASK) != 0) { return false; }
+
+        cfg.word[index] = blob->registers[index];
+    }
+
+    return drv8305_packed_get_gate_drive_pwm_mode(&cfg) <= (uint16_t)DRV8305_PWM_1_INPUT &&
+           drv8305_packed_get_vds_sense_vds_mode(&cfg)  <= (uint16_t)DRV8305_VDS_MODE_DISABLED;
+}
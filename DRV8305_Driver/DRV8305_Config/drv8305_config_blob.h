@@ -0,0 +1,125 @@
+/**
+ * @file drv8305_config_blob.h
+ * @brief DRV8305 Configuration Blob - Versioned Binary Format for NV Storage
+ * @details Declares a compact, CRC-protected image of the seven control register words for
+ *          storage in flash/EEPROM and allocation-free restore at boot.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * This module provides:
+ *   - drv8305_config_blob_t: header, seven packed register words, device-variant tag, CRC-32
+ *   - drv8305_config_blob_serialize(): packed configuration to blob
+ *   - drv8305_config_blob_validate(): header, variant, field and CRC checks
+ *   - drv8305_config_blob_deserialize(): validated blob straight into a packed configuration
+ *     (the driver's config or staged profile)
+ *
+ * @format
+ * 13 16-bit words, stored in target word order (little-endian octets in files):
+ *   word 0      magic (DRV8305_CONFIG_BLOB_MAGIC)
+ *   word 1      version (DRV8305_CONFIG_BLOB_VERSION)
+ *   word 2      device variant (drv8305_device_variant_e)
+ *   word 3      register word count (7)
+ *   words 4-10  control registers 0x05, 0x06, 0x07, 0x09, 0x0A, 0x0B, 0x0C (bits 10:0)
+ *   words 11-12 CRC-32 of words 0-10 (drv8305_crc32_words), low half first
+ *
+ * @restore_cost
+ * One pass over 11 words plus seven word copies; no allocation, no loops over fields.
+ */
+
+#ifndef DRV8305_CONFIG_BLOB_H_
+#define DRV8305_CONFIG_BLOB_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#include "drv8305_macros.h"
+#include "drv8305_packed_configuration.h"
+
+/** @brief Blob marker */
+#define DRV8305_CONFIG_BLOB_MAGIC    (uint16_t)0x8305
+/** @brief Blob layout version, bump on any change */
+#define DRV8305_CONFIG_BLOB_VERSION  (uint16_t)1
+/** @brief Blob size in 16-bit words */
+#define DRV8305_CONFIG_BLOB_WORDS    (int)13
+
+/**
+ * @brief Device variant the configuration was tuned for
+ */
+typedef enum
+{
+    DRV8305_VARIANT_ANY = 0,  // -> Accepted by / loadable on every variant
+    DRV8305_VARIANT_Q1  = 1,  // -> DRV8305-Q1 (automotive)
+    DRV8305_VARIANT_N   = 2,  // -> DRV8305N
+    DRV8305_VARIANT_E   = 3,  // -> DRV8305xE (FLIP_OTSD disables OTSD)
+} drv8305_device_variant_e;
+
+typedef enum
+{
+    DRV8305_BLOB_OK,
+    DRV8305_BLOB_BAD_MAGIC,    // -> Not a configuration blob (erased flash reads here)
+    DRV8305_BLOB_BAD_VERSION,  // -> Written by an incompatible driver version
+    DRV8305_BLOB_BAD_LENGTH,   // -> Register word count mismatch
+    DRV8305_BLOB_BAD_VARIANT,  // -> Tuned for another device variant
+    DRV8305_BLOB_BAD_CRC,      // -> Corrupted
+    DRV8305_BLOB_BAD_FIELD,    // -> CRC intact but a word has bits above 10 or a reserved code
+} drv8305_blob_status_e;
+
+/**
+ * @brief Configuration blob (13 words, no padding)
+ */
+typedef struct
+{
+    uint16_t magic;                                          // DRV8305_CONFIG_BLOB_MAGIC
+    uint16_t version;                                        // DRV8305_CONFIG_BLOB_VERSION
+    uint16_t variant;                                        // drv8305_device_variant_e
+    uint16_t word_count;                                     // DRV8305_NUMBER_OF_CONTROL_REGISTERS
+    uint16_t registers[DRV8305_NUMBER_OF_CONTROL_REGISTERS]; // Packed control register words
+    uint16_t crc_low;                                        // CRC-32 of the words above, bits 15:0
+    uint16_t crc_high;                                       // CRC-32 of the words above, bits 31:16
+} drv8305_config_blob_t;
+
+/**
+ * @brief Build a blob from a packed configuration
+ * @param[out] blob Destination blob
+ * @param[in] cfg Packed configuration (driver config, staged profile or register image)
+ * @param[in] variant Device variant tag
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_config_blob_serialize(drv8305_config_blob_t *blob, const drv8305_packed_configuration_t *cfg, drv8305_device_variant_e variant);
+
+/**
+ * @brief Check a blob without loading it
+ * @param[in] blob Blob to check (may point straight into memory-mapped flash)
+ * @param[in] variant Running device variant; DRV8305_VARIANT_ANY skips the variant check,
+ *            a blob tagged DRV8305_VARIANT_ANY loads on every variant
+ * @return drv8305_blob_status_e DRV8305_BLOB_OK or the first failed check
+ */
+DRV8305_PUBLIC drv8305_blob_status_e drv8305_config_blob_validate(const drv8305_config_blob_t *blob, drv8305_device_variant_e variant);
+
+/**
+ * @brief Validate a blob and load its register words
+ * @param[in] blob Blob to load
+ * @param[in] variant Running device variant (see drv8305_config_blob_validate())
+ * @param[out] cfg Destination, left untouched unless the blob is valid
+ * @return drv8305_blob_status_e DRV8305_BLOB_OK if cfg was loaded
+ * @usage
+ * @code
+ * if(drv8305_config_blob_deserialize(flash_blob, DRV8305_VARIANT_Q1, &user_drv8305_obj.config) == DRV8305_BLOB_OK)
+ * {
+ *     drv8305_api_confirm_configuration(&user_drv8305_obj);
+ * }
+ * @endcode
+ */
+DRV8305_PUBLIC drv8305_blob_status_e drv8305_config_blob_deserialize(const drv8305_config_blob_t *blob, drv8305_device_variant_e variant, drv8305_packed_configuration_t *cfg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRV8305_CONFIG_BLOB_H_ */
@@ -65,7 +65,7 @@ DRV8305_PUBLIC drv8305_configuration_t default_configuration =
 
     /* -----------------------------------------------------------------------
      * Register 0x07: Gate Drive Control
-     * Default Value: 0x296
+     * Default Value: 0x216
      * ----------------------------------------------------------------------- */
     .gate_drive = 
     {
@@ -112,7 +112,7 @@ DRV8305_PUBLIC drv8305_configuration_t default_configuration =
 
     /* -----------------------------------------------------------------------
      * Register 0x0B: Voltage Regulator Control
-     * Default Value: 0x102
+     * Default Value: 0x10A
      * ----------------------------------------------------------------------- */
     .voltage_regulator = 
     {
@@ -124,7 +124,7 @@ DRV8305_PUBLIC drv8305_configuration_t default_configuration =
 
     /* -----------------------------------------------------------------------
      * Register 0x0C: VDS Sense Control
-     * Default Value: 0x0CA
+     * Default Value: 0x0C8
      * ----------------------------------------------------------------------- */
     .vds_sense = 
     {
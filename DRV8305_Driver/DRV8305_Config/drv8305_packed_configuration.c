@@ -0,0 +1,126 @@
+/**
+ * @file drv8305_packed_configuration.c
+ * @brief DRV8305 Packed Configuration - Implementation
+ * @details Converts between the field-per-word drv8305_configuration_t and the seven-word
+ *          packed working copy.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * This implementation file contains:
+ *   - drv8305_configuration_pack() / drv8305_configuration_unpack(): generated from the
+ *     field table
+ *   - Compile-time field layout checks (width and overlap per control register)
+ *   - drv8305_configuration_diff(): one XOR per register word
+ */
+
+#include <stdint.h>
+
+#include "drv8305_macros.h"
+#include "drv8305_packed_configuration.h"
+
+/**@brief: Packed and image layouts must stay interchangeable **/
+typedef char drv8305_packed_configuration_size_check[(sizeof(drv8305_packed_configuration_t) == DRV8305_NUMBER_OF_CONTROL_REGISTERS * sizeof(uint16_t)) ? 1 : -1];
+
+/**@brief: Every field is non-empty and lies inside data bits 10:0 **/
+#define DRV8305_FIELD_WIDTH_CHECK(group, field, ...) \
+    typedef char drv8305_##group##_##field##_width_check[(DRV8305_FIELD_WIDTH(__VA_ARGS__) > 0 && \
+        (DRV8305_FIELD_MASK(__VA_ARGS__) & ~DRV8305_REGISTER_DATA_MASK) == 0) ? 1 : -1];
+DRV8305_PACKED_CONFIGURATION_FIELDS(DRV8305_FIELD_WIDTH_CHECK)
+#undef DRV8305_FIELD_WIDTH_CHECK
+
+/**@brief: Fields of a register never overlap (the sum of their masks equals their union) **/
+#define DRV8305_FIELD_OVERLAP_CHECK(reg) \
+    typedef char drv8305_##reg##_overlap_check[((0UL DRV8305_##reg##_FIELDS(DRV8305_FIELD_SUM_TERM)) == DRV8305_FIELD_BITS(reg)) ? 1 : -1]
+DRV8305_FIELD_OVERLAP_CHECK(CTRL05);
+DRV8305_FIELD_OVERLAP_CHECK(CTRL06);
+DRV8305_FIELD_OVERLAP_CHECK(CTRL07);
+DRV8305_FIELD_OVERLAP_CHECK(CTRL09);
+DRV8305_FIELD_OVERLAP_CHECK(CTRL0A);
+DRV8305_FIELD_OVERLAP_CHECK(CTRL0B);
+DRV8305_FIELD_OVERLAP_CHECK(CTRL0C);
+#undef DRV8305_FIELD_OVERLAP_CHECK
+
+/**
+ * @brief Pack configuration (implementation)
+ * @param[out] packed Destination packed configuration
+ * @param[in] cfg Source configuration
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_configuration_pack(drv8305_packed_configuration_t *packed, const drv8305_configuration_t *cfg)
+{
+    if(!packed || !cfg) { return; }
+
+    for(int index = 0; index < DRV8305_NUMBER_OF_CONTROL_REGISTERS; index++)
+    {
+        packed->word[index] = 0;
+    }
+
+#define DRV8305_PACK_FIELD(group, field, ...) \
+    packed->word[DRV8305_REGISTER_IMAGE_INDEX(DRV8305_FIELD_INDEX(__VA_ARGS__))] |= (uint16_t)DRV8305_FIELD_PUT(cfg->group.field, __VA_ARGS__);
+    DRV8305_PACKED_CONFIGURATION_FIELDS(DRV8305_PACK_FIELD)
+#undef DRV8305_PACK_FIELD
+}
+
+/**
+ * @brief Unpack configuration (implementation)
+ * @param[out] cfg Destination configuration
+ * @param[in] packed Source packed configuration
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_configuration_unpack(drv8305_configuration_t *cfg, const drv8305_packed_configuration_t *packed)
+{
+    if(!cfg || !packed) { return; }
+
+#define DRV8305_UNPACK_FIELD(group, field, ...)  cfg->group.field = drv8305_packed_get_##group##_##field(packed);
+    DRV8305_PACKED_CONFIGURATION_FIELDS(DRV8305_UNPACK_FIELD)
+#undef DRV8305_UNPACK_FIELD
+}
+
+/**
+ * @brief Compare packed configurations (implementation)
+ * @param[out] diff Changed registers and bits (may be NULL)
+ * @param[in] from Reference configuration
+ * @param[in] to Compared configuration
+ * @return uint16_t Register mask
+ */
+DRV8305_PUBLIC uint16_t drv8305_configuration_diff(drv8305_configuration_diff_t *diff, const drv8305_packed_configuration_t *from, const drv8305_packed_configuration_t *to)
+{
+    uint16_t register_mask = 0;
+
+    if(!from || !to) { return 0; }
+
+    for(int index = 0; index < DRV8305_NUMBER_OF_CONTROL_REGISTERS; index++)
+    {
+        uint16_t changed = (uint16_t)((from->word[index] ^ to->word[index]) & DRV8305_REGISTER_DATA_MASK);
+
+        if(changed != 0) { register_mask |= (uint16_t)(1U << index); }
+        if(diff)         { diff->changed[index] = changed; }
+    }
+
+    if(diff) { diff->register_mask = register_mask; }
+
+    return register_mask;
+}
+
+/**
+ * @brief Compare field-per-word configurations (implementation)
+ * @param[out] diff Changed registers and bits (may be NULL)
+ * @param[in] from Reference configuration
+ * @param[in] to Compared configuration
+ * @return uint16_t Register mask
+ */
+DRV8305_PUBLIC uint16_t drv8305_configuration_diff_fields(drv8305_configuration_diff_t *diff, const drv8305_configuration_t *from, const drv8305_configuration_t *to)
+{
+    drv8305_packed_configuration_t packed_from;
+    drv8305_packed_configuration_t packed_to;
+
+    if(!from || !to) { return 0; }
+
+    drv8305_configuration_pack(&packed_from, from);
+    drv8305_configuration_pack(&packed_to, to);
+
+    return drv8305_configuration_diff(diff, &packed_from, &packed_to);
+}
@@ -0,0 +1,144 @@
+/**
+ * @file drv8305_packed_configuration.h
+ * @brief DRV8305 Packed Configuration - Seven-Word Working Copy
+ * @details Declares the bit-packed configuration (one 11-bit word per control register) and
+ *          generates inline get/set accessors for every named field from one field table.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * This module provides:
+ *   - drv8305_packed_configuration_t: 7 words instead of the 35-field drv8305_configuration_t
+ *   - DRV8305_PACKED_CONFIGURATION_FIELDS(): field table (group, field, descriptor)
+ *   - drv8305_packed_get_<group>_<field>() / drv8305_packed_set_<group>_<field>() inline accessors
+ *   - drv8305_configuration_pack() / drv8305_configuration_unpack() conversions
+ *   - drv8305_configuration_diff(): changed registers and bits, one XOR per register
+ *   - drv8305_diff_<group>_<field>() inline per-field change tests
+ *
+ * @memory
+ * 14 bytes per instance (7 x uint16_t) against 70 bytes for the field structure; copies and
+ * compares are seven-word operations. The layout equals drv8305_register_image_t, so a const
+ * register image is loaded with a plain structure assignment.
+ *
+ * @usage
+ *   drv8305_packed_set_gate_drive_dead_time(&user_drv8305_obj.config, DRV8305_DEADTIME_88NS);
+ *   uint16_t isink = drv8305_packed_get_hs_gate_drive_isink(&user_drv8305_obj.config);
+ */
+
+#ifndef DRV8305_PACKED_CONFIGURATION_H_
+#define DRV8305_PACKED_CONFIGURATION_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "drv8305_macros.h"
+#include "drv8305_configuration.h"
+#include "drv8305_register_image.h"
+
+/**
+ * @brief Packed configuration: control register words in programming order
+ * @note Index with DRV8305_REGISTER_IMAGE_INDEX(DRV8305_CONTROL_xx_ARRAY_INDEX)
+ */
+typedef drv8305_register_image_t drv8305_packed_configuration_t;
+
+/**
+ * @brief Field table: X(group, field, descriptor)
+ * @note Alias of DRV8305_CONTROL_REGISTER_FIELDS() (drv8305_macros.h); X receives the
+ *       descriptor as trailing arguments, see DRV8305_FIELD_GET() / DRV8305_FIELD_PUT()
+ */
+#define DRV8305_PACKED_CONFIGURATION_FIELDS(X)  DRV8305_CONTROL_REGISTER_FIELDS(X)
+
+/**
+ * @brief Generate the inline getter and setter of one field
+ * @note The setter masks value to the field width and leaves the other fields untouched
+ */
+#define DRV8305_PACKED_ACCESSORS(group, field, ...)                                                                   \
+    DRV8305_INLINE uint16_t drv8305_packed_get_##group##_##field(const drv8305_packed_configuration_t *cfg)           \
+    {                                                                                                                 \
+        return (uint16_t)DRV8305_FIELD_GET(cfg->word[DRV8305_REGISTER_IMAGE_INDEX(DRV8305_FIELD_INDEX(__VA_ARGS__))], \
+                                           __VA_ARGS__);                                                              \
+    }                                                                                                                 \
+    DRV8305_INLINE void drv8305_packed_set_##group##_##field(drv8305_packed_configuration_t *cfg, uint16_t value)     \
+    {                                                                                                                 \
+        uint16_t *word = &cfg->word[DRV8305_REGISTER_IMAGE_INDEX(DRV8305_FIELD_INDEX(__VA_ARGS__))];                  \
+        *word = (uint16_t)((*word & ~DRV8305_FIELD_MASK(__VA_ARGS__)) | DRV8305_FIELD_PUT(value, __VA_ARGS__));       \
+    }
+
+DRV8305_PACKED_CONFIGURATION_FIELDS(DRV8305_PACKED_ACCESSORS)
+
+/**
+ * @brief Difference between two packed configurations
+ * @note changed[] is in packed word order; a field differs when any of its bits is set there
+ */
+typedef struct
+{
+    uint16_t register_mask;                                    // Bit n: packed word n differs (DRV8305_CONTROL_REGISTER_BIT)
+    uint16_t changed[DRV8305_NUMBER_OF_CONTROL_REGISTERS];     // Per register: XOR of the two words, bits 10:0
+} drv8305_configuration_diff_t;
+
+/**
+ * @brief Generate the inline change test of one field
+ */
+#define DRV8305_PACKED_DIFF_TEST(group, field, ...)                                                                   \
+    DRV8305_INLINE bool drv8305_diff_##group##_##field(const drv8305_configuration_diff_t *diff)                     \
+    {                                                                                                                 \
+        return (diff->changed[DRV8305_REGISTER_IMAGE_INDEX(DRV8305_FIELD_INDEX(__VA_ARGS__))] &                        \
+                DRV8305_FIELD_MASK(__VA_ARGS__)) != 0;                                                                \
+    }
+
+DRV8305_PACKED_CONFIGURATION_FIELDS(DRV8305_PACKED_DIFF_TEST)
+
+/**
+ * @brief Pack a field-per-word configuration into seven register words
+ * @param[out] packed Destination packed configuration
+ * @param[in] cfg Source configuration (fields are masked to their width)
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_configuration_pack(drv8305_packed_configuration_t *packed, const drv8305_configuration_t *cfg);
+
+/**
+ * @brief Expand a packed configuration into the field-per-word structure
+ * @param[out] cfg Destination configuration
+ * @param[in] packed Source packed configuration
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_configuration_unpack(drv8305_configuration_t *cfg, const drv8305_packed_configuration_t *packed);
+
+/**
+ * @brief Compare two packed configurations
+ * @param[out] diff Changed registers and bits (may be NULL when only the mask is needed)
+ * @param[in] from Reference configuration
+ * @param[in] to Compared configuration
+ * @return uint16_t Register mask, 0 when both program the same words
+ *
+ * @usage
+ * @code
+ * drv8305_configuration_diff_t diff;
+ *
+ * if(drv8305_configuration_diff(&diff, &user_drv8305_obj.config, &tuned) == 0) { return; }  // No-op
+ * if(drv8305_diff_gate_drive_dead_time(&diff)) { ... }
+ * @endcode
+ */
+DRV8305_PUBLIC uint16_t drv8305_configuration_diff(drv8305_configuration_diff_t *diff, const drv8305_packed_configuration_t *from, const drv8305_packed_configuration_t *to);
+
+/**
+ * @brief Compare two field-per-word configurations
+ * @details Packs both and compares the words; see drv8305_configuration_diff()
+ * @param[out] diff Changed registers and bits (may be NULL)
+ * @param[in] from Reference configuration
+ * @param[in] to Compared configuration
+ * @return uint16_t Register mask, 0 when both program the same words
+ */
+DRV8305_PUBLIC uint16_t drv8305_configuration_diff_fields(drv8305_configuration_diff_t *diff, const drv8305_configuration_t *from, const drv8305_configuration_t *to);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRV8305_PACKED_CONFIGURATION_H_ */
@@ -0,0 +1,96 @@
+/**
+ * @file drv8305_register_image.h
+ * @brief DRV8305 Register Image - Compile-Time Control Register Words
+ * @details Declares the seven packed 11-bit control register words as one const object so a
+ *          configuration known at build time is streamed to the IC without runtime packing.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * This module provides:
+ *   - drv8305_register_image_t: control words 0x05, 0x06, 0x07, 0x09, 0x0A, 0x0B, 0x0C
+ *   - DRV8305_REGISTER_IMAGE_DEFINE(): const image from field values, range-checked by the
+ *     compiler (an out-of-range or reserved field value fails the build)
+ *   - DRV8305_REGISTER_IMAGE_INDEX(): register_manager[] index to image word index
+ *   - DRV8305_CONTROL_REGISTER_BIT(): per-register bit of a control register mask
+ *
+ * @usage
+ * Every register argument is the parenthesized field list of its DRV8305_CTRLxx_WORD():
+ *
+ *   DRV8305_REGISTER_IMAGE_DEFINE(product_image,
+ *       (DRV8305_TDRIVE_1780NS, DRV8305_ISINK_60MA, DRV8305_ISOURCE_50MA),
+ *       (DRV8305_TDRIVE_1780NS, DRV8305_ISINK_60MA, DRV8305_ISOURCE_50MA),
+ *       (DRV8305_VCPH_FREQ_518KHZ, DRV8305_COMM_ACTIVE_FREEWHEEL, DRV8305_PWM_6_INPUTS,
+ *        DRV8305_DEADTIME_52NS, DRV8305_TBLANK_1_75US, DRV8305_TVDS_3_5US),
+ *       (0, 0, 0, 0, DRV8305_WD_DLY_20MS, 0, 0, 0, 1, 0),
+ *       (0, 0, 0, DRV8305_CS_BLANK_0NS, DRV8305_GAIN_10V_V, DRV8305_GAIN_10V_V, DRV8305_GAIN_10V_V),
+ *       (DRV8305_VREF_SCALE_DIV2, DRV8305_SLEEP_DLY_10US, 0, DRV8305_VREG_UV_70PCT),
+ *       (DRV8305_VDS_1_175V, DRV8305_VDS_MODE_LATCH_SHUTDOWN));
+ *
+ *   drv8305_api_set_register_image(&user_drv8305_obj, &product_image);
+ *
+ * Prefix with static for file scope. The object is const, so the linker places it in flash.
+ */
+
+#ifndef DRV8305_REGISTER_IMAGE_H_
+#define DRV8305_REGISTER_IMAGE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#include "drv8305_macros.h"
+#include "DRV8305_Control_Registers/drv8305_control_registers_definitions.h"
+
+/** @brief Image word index of a control register (register_manager[] indexing) */
+#define DRV8305_REGISTER_IMAGE_INDEX(array_index)  ((array_index) - DRV8305_CONTROL_05_ARRAY_INDEX)
+/** @brief Control register bit in a register mask (register_manager[] indexing) */
+#define DRV8305_CONTROL_REGISTER_BIT(array_index)  (uint16_t)(1U << DRV8305_REGISTER_IMAGE_INDEX(array_index))
+/** @brief Register mask of all seven control registers */
+#define DRV8305_CONTROL_REGISTER_ALL               (uint16_t)((1U << DRV8305_NUMBER_OF_CONTROL_REGISTERS) - 1U)
+
+/**
+ * @brief Packed control register words, in programming order
+ * @note word[] holds data bits 10:0 only; the SPI frame header is added by the driver
+ */
+typedef struct
+{
+    uint16_t word[DRV8305_NUMBER_OF_CONTROL_REGISTERS];
+} drv8305_register_image_t;
+
+/**
+ * @brief Define a const register image from field values
+ * @details Each ctrlxx argument is a parenthesized field list passed to DRV8305_CTRLxx_WORD()
+ *          and DRV8305_CTRLxx_VALID(); a failed range check is a negative array size error
+ *          naming the register (name_ctrlxx_check).
+ */
+#define DRV8305_REGISTER_IMAGE_DEFINE(name, ctrl05, ctrl06, ctrl07, ctrl09, ctrl0A, ctrl0B, ctrl0C) \
+    const drv8305_register_image_t name =                                                         \
+    {                                                                                             \
+        {                                                                                         \
+            DRV8305_CTRL05_WORD ctrl05,                                                           \
+            DRV8305_CTRL06_WORD ctrl06,                                                           \
+            DRV8305_CTRL07_WORD ctrl07,                                                           \
+            DRV8305_CTRL09_WORD ctrl09,                                                           \
+            DRV8305_CTRL0A_WORD ctrl0A,                                                           \
+            DRV8305_CTRL0B_WORD ctrl0B,                                                           \
+            DRV8305_CTRL0C_WORD ctrl0C                                                            \
+        }                                                                                         \
+    };                                                                                            \
+    typedef char name##_ctrl05_check[(DRV8305_CTRL05_VALID ctrl05) ? 1 : -1];                     \
+    typedef char name##_ctrl06_check[(DRV8305_CTRL06_VALID ctrl06) ? 1 : -1];                     \
+    typedef char name##_ctrl07_check[(DRV8305_CTRL07_VALID ctrl07) ? 1 : -1];                     \
+    typedef char name##_ctrl09_check[(DRV8305_CTRL09_VALID ctrl09) ? 1 : -1];                     \
+    typedef char name##_ctrl0A_check[(DRV8305_CTRL0A_VALID ctrl0A) ? 1 : -1];                     \
+    typedef char name##_ctrl0B_check[(DRV8305_CTRL0B_VALID ctrl0B) ? 1 : -1];                     \
+    typedef char name##_ctrl0C_check[(DRV8305_CTRL0C_VALID ctrl0C) ? 1 : -1]
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRV8305_REGISTER_IMAGE_H_ */
@@ -13,6 +13,9 @@
  *   - Enumerations for each register parameter (drive currents, gate timing, etc.)
  *   - Typedef structures aggregating related parameters
  *   - DRV8305_PACK_CTRLxx macros for SPI packet creation
+ *   - DRV8305_CTRLxx_WORD / DRV8305_CTRLxx_VALID constant-expression packers and range
+ *     checks taking field values (used by DRV8305_REGISTER_IMAGE_DEFINE), built from the
+ *     field descriptors of drv8305_macros.h
  *   - Register bit field definitions with datasheet values
  * 
  * @register_coverage
@@ -40,6 +43,8 @@ extern "C" {
 
 #include <stdint.h>
 
+#include "drv8305_macros.h"
+
 /* ============================================================================
  * CONTROL REGISTERS (Read/Write)
  * Datasheet Reference: Table 14-20, Pages 40-44
@@ -363,10 +368,18 @@ typedef struct
     uint16_t isource;  // Bits 3:0 (drv8305_hs_isource_t)
 } drv8305_ctrl05_hs_gate_t;
 
+#define DRV8305_CTRL05_WORD(tdrive, isink, isource) \
+    (uint16_t)(DRV8305_FIELD_PUT((tdrive),  DRV8305_CTRL05_TDRIVE_FIELD) | \
+               DRV8305_FIELD_PUT((isink),   DRV8305_CTRL05_ISINK_FIELD) | \
+               DRV8305_FIELD_PUT((isource), DRV8305_CTRL05_ISOURCE_FIELD))
+
+#define DRV8305_CTRL05_VALID(tdrive, isink, isource) \
+    ((tdrive)  <= DRV8305_FIELD_MAX(DRV8305_CTRL05_TDRIVE_FIELD) && \
+     (isink)   <= DRV8305_FIELD_MAX(DRV8305_CTRL05_ISINK_FIELD) && \
+     (isource) <= DRV8305_FIELD_MAX(DRV8305_CTRL05_ISOURCE_FIELD))
+
 #define DRV8305_PACK_CTRL05(cfg) \
-    (uint16_t)(((cfg.tdrive  & 0x03U) << 8) | \
-               ((cfg.isink   & 0x0FU) << 4) | \
-               ((cfg.isource & 0x0FU) << 0))
+    DRV8305_CTRL05_WORD(cfg.tdrive, cfg.isink, cfg.isource)
 
 /**
  * @brief Register 0x06: LS Gate Drive Control
@@ -379,10 +392,14 @@ typedef struct
     uint16_t isource;  // Bits 3:0 (drv8305_ls_isource_t)
 } drv8305_ctrl06_ls_gate_t;
 
+#define DRV8305_CTRL06_WORD(tdrive, isink, isource) \
+    DRV8305_CTRL05_WORD(tdrive, isink, isource)
+
+#define DRV8305_CTRL06_VALID(tdrive, isink, isource) \
+    DRV8305_CTRL05_VALID(tdrive, isink, isource)
+
 #define DRV8305_PACK_CTRL06(cfg) \
-    (uint16_t)(((cfg.tdrive  & 0x03U) << 8) | \
-               ((cfg.isink   & 0x0FU) << 4) | \
-               ((cfg.isource & 0x0FU) << 0))
+    DRV8305_CTRL06_WORD(cfg.tdrive, cfg.isink, cfg.isource)
 
 /**
  * @brief Register 0x07: Gate Drive Control
@@ -398,13 +415,24 @@ typedef struct
     uint16_t tvds;           // Bits 1:0 (drv8305_tvds_t)
 } drv8305_ctrl07_gate_t;
 
+#define DRV8305_CTRL07_WORD(vcph_freq, comm_option, pwm_mode, dead_time, tblank, tvds) \
+    (uint16_t)(DRV8305_FIELD_PUT((vcph_freq),   DRV8305_CTRL07_VCPH_FREQ_FIELD) | \
+               DRV8305_FIELD_PUT((comm_option), DRV8305_CTRL07_COMM_OPTION_FIELD) | \
+               DRV8305_FIELD_PUT((pwm_mode),    DRV8305_CTRL07_PWM_MODE_FIELD) | \
+               DRV8305_FIELD_PUT((dead_time),   DRV8305_CTRL07_DEAD_TIME_FIELD) | \
+               DRV8305_FIELD_PUT((tblank),      DRV8305_CTRL07_TBLANK_FIELD) | \
+               DRV8305_FIELD_PUT((tvds),        DRV8305_CTRL07_TVDS_FIELD))
+
+#define DRV8305_CTRL07_VALID(vcph_freq, comm_option, pwm_mode, dead_time, tblank, tvds) \
+    ((vcph_freq)   <= DRV8305_FIELD_MAX(DRV8305_CTRL07_VCPH_FREQ_FIELD) && \
+     (comm_option) <= DRV8305_FIELD_MAX(DRV8305_CTRL07_COMM_OPTION_FIELD) && \
+     (pwm_mode)    <= 0x02U && \
+     (dead_time)   <= DRV8305_FIELD_MAX(DRV8305_CTRL07_DEAD_TIME_FIELD) && \
+     (tblank)      <= DRV8305_FIELD_MAX(DRV8305_CTRL07_TBLANK_FIELD) && \
+     (tvds)        <= DRV8305_FIELD_MAX(DRV8305_CTRL07_TVDS_FIELD))
+
 #define DRV8305_PACK_CTRL07(cfg) \
-    (uint16_t)(((cfg.vcph_freq   & 0x01U) << 10) | \
-               ((cfg.comm_option & 0x01U) << 9)  | \
-               ((cfg.pwm_mode    & 0x03U) << 7)  | \
-               ((cfg.dead_time   & 0x07U) << 4)  | \
-               ((cfg.tblank      & 0x03U) << 2)  | \
-               ((cfg.tvds        & 0x03U) << 0))
+    DRV8305_CTRL07_WORD(cfg.vcph_freq, cfg.comm_option, cfg.pwm_mode, cfg.dead_time, cfg.tblank, cfg.tvds)
 
 /**
  * @brief Register 0x09: IC Operation
@@ -424,17 +452,33 @@ typedef struct
     uint16_t set_vcph_uv;     // Bit 0
 } drv8305_ctrl09_ic_op_t;
 
+#define DRV8305_CTRL09_WORD(flip_otsd, dis_pvdd_uvlo2, dis_gdrv_fault, en_sns_clamp, wd_dly, dis_sns_ocp, wd_en, sleep, clr_flts, set_vcph_uv) \
+    (uint16_t)(DRV8305_FIELD_PUT((flip_otsd),      DRV8305_CTRL09_FLIP_OTSD_FIELD) | \
+               DRV8305_FIELD_PUT((dis_pvdd_uvlo2), DRV8305_CTRL09_DIS_PVDD_UVLO2_FIELD) | \
+               DRV8305_FIELD_PUT((dis_gdrv_fault), DRV8305_CTRL09_DIS_GDRV_FAULT_FIELD) | \
+               DRV8305_FIELD_PUT((en_sns_clamp),   DRV8305_CTRL09_EN_SNS_CLAMP_FIELD) | \
+               DRV8305_FIELD_PUT((wd_dly),         DRV8305_CTRL09_WD_DLY_FIELD) | \
+               DRV8305_FIELD_PUT((dis_sns_ocp),    DRV8305_CTRL09_DIS_SNS_OCP_FIELD) | \
+               DRV8305_FIELD_PUT((wd_en),          DRV8305_CTRL09_WD_EN_FIELD) | \
+               DRV8305_FIELD_PUT((sleep),          DRV8305_CTRL09_SLEEP_FIELD) | \
+               DRV8305_FIELD_PUT((clr_flts),       DRV8305_CTRL09_CLR_FLTS_FIELD) | \
+               DRV8305_FIELD_PUT((set_vcph_uv),    DRV8305_CTRL09_SET_VCPH_UV_FIELD))
+
+#define DRV8305_CTRL09_VALID(flip_otsd, dis_pvdd_uvlo2, dis_gdrv_fault, en_sns_clamp, wd_dly, dis_sns_ocp, wd_en, sleep, clr_flts, set_vcph_uv) \
+    ((flip_otsd)      <= DRV8305_FIELD_MAX(DRV8305_CTRL09_FLIP_OTSD_FIELD) && \
+     (dis_pvdd_uvlo2) <= DRV8305_FIELD_MAX(DRV8305_CTRL09_DIS_PVDD_UVLO2_FIELD) && \
+     (dis_gdrv_fault) <= DRV8305_FIELD_MAX(DRV8305_CTRL09_DIS_GDRV_FAULT_FIELD) && \
+     (en_sns_clamp)   <= DRV8305_FIELD_MAX(DRV8305_CTRL09_EN_SNS_CLAMP_FIELD) && \
+     (wd_dly)         <= DRV8305_FIELD_MAX(DRV8305_CTRL09_WD_DLY_FIELD) && \
+     (dis_sns_ocp)    <= DRV8305_FIELD_MAX(DRV8305_CTRL09_DIS_SNS_OCP_FIELD) && \
+     (wd_en)          <= DRV8305_FIELD_MAX(DRV8305_CTRL09_WD_EN_FIELD) && \
+     (sleep)          <= DRV8305_FIELD_MAX(DRV8305_CTRL09_SLEEP_FIELD) && \
+     (clr_flts)       <= DRV8305_FIELD_MAX(DRV8305_CTRL09_CLR_FLTS_FIELD) && \
+     (set_vcph_uv)    <= DRV8305_FIELD_MAX(DRV8305_CTRL09_SET_VCPH_UV_FIELD))
+
 #define DRV8305_PACK_CTRL09(cfg) \
-    (uint16_t)(((cfg.flip_otsd      & 0x01U) << 10) | \
-               ((cfg.dis_pvdd_uvlo2 & 0x01U) << 9)  | \
-               ((cfg.dis_gdrv_fault & 0x01U) << 8)  | \
-               ((cfg.en_sns_clamp   & 0x01U) << 7)  | \
-               ((cfg.wd_dly         & 0x03U) << 5)  | \
-               ((cfg.dis_sns_ocp    & 0x01U) << 4)  | \
-               ((cfg.wd_en          & 0x01U) << 3)  | \
-               ((cfg.sleep          & 0x01U) << 2)  | \
-               ((cfg.clr_flts       & 0x01U) << 1)  | \
-               ((cfg.set_vcph_uv    & 0x01U) << 0))
+    DRV8305_CTRL09_WORD(cfg.flip_otsd, cfg.dis_pvdd_uvlo2, cfg.dis_gdrv_fault, cfg.en_sns_clamp, cfg.wd_dly, \
+                        cfg.dis_sns_ocp, cfg.wd_en, cfg.sleep, cfg.clr_flts, cfg.set_vcph_uv)
 
 /**
  * @brief Register 0x0A: Shunt Amplifier Control
@@ -451,14 +495,26 @@ typedef struct
     uint16_t gain_cs1;    // Bits 1:0 (drv8305_gain_t)
 } drv8305_ctrl0A_shunt_t;
 
+#define DRV8305_CTRL0A_WORD(dc_cal_ch3, dc_cal_ch2, dc_cal_ch1, cs_blank, gain_cs3, gain_cs2, gain_cs1) \
+    (uint16_t)(DRV8305_FIELD_PUT((dc_cal_ch3), DRV8305_CTRL0A_DC_CAL_CH3_FIELD) | \
+               DRV8305_FIELD_PUT((dc_cal_ch2), DRV8305_CTRL0A_DC_CAL_CH2_FIELD) | \
+               DRV8305_FIELD_PUT((dc_cal_ch1), DRV8305_CTRL0A_DC_CAL_CH1_FIELD) | \
+               DRV8305_FIELD_PUT((cs_blank),   DRV8305_CTRL0A_CS_BLANK_FIELD) | \
+               DRV8305_FIELD_PUT((gain_cs3),   DRV8305_CTRL0A_GAIN_CH3_FIELD) | \
+               DRV8305_FIELD_PUT((gain_cs2),   DRV8305_CTRL0A_GAIN_CH2_FIELD) | \
+               DRV8305_FIELD_PUT((gain_cs1),   DRV8305_CTRL0A_GAIN_CH1_FIELD))
+
+#define DRV8305_CTRL0A_VALID(dc_cal_ch3, dc_cal_ch2, dc_cal_ch1, cs_blank, gain_cs3, gain_cs2, gain_cs1) \
+    ((dc_cal_ch3) <= DRV8305_FIELD_MAX(DRV8305_CTRL0A_DC_CAL_CH3_FIELD) && \
+     (dc_cal_ch2) <= DRV8305_FIELD_MAX(DRV8305_CTRL0A_DC_CAL_CH2_FIELD) && \
+     (dc_cal_ch1) <= DRV8305_FIELD_MAX(DRV8305_CTRL0A_DC_CAL_CH1_FIELD) && \
+     (cs_blank)   <= DRV8305_FIELD_MAX(DRV8305_CTRL0A_CS_BLANK_FIELD) && \
+     (gain_cs3)   <= DRV8305_FIELD_MAX(DRV8305_CTRL0A_GAIN_CH3_FIELD) && \
+     (gain_cs2)   <= DRV8305_FIELD_MAX(DRV8305_CTRL0A_GAIN_CH2_FIELD) && \
+     (gain_cs1)   <= DRV8305_FIELD_MAX(DRV8305_CTRL0A_GAIN_CH1_FIELD))
+
 #define DRV8305_PACK_CTRL0A(cfg) \
-    (uint16_t)(((cfg.dc_cal_ch3 & 0x01U) << 10) | \
-               ((cfg.dc_cal_ch2 & 0x01U) << 9)  | \
-               ((cfg.dc_cal_ch1 & 0x01U) << 8)  | \
-               ((cfg.cs_blank   & 0x03U) << 6)  | \
-               ((cfg.gain_cs3   & 0x03U) << 4)  | \
-               ((cfg.gain_cs2   & 0x03U) << 2)  | \
-               ((cfg.gain_cs1   & 0x03U) << 0))
+    DRV8305_CTRL0A_WORD(cfg.dc_cal_ch3, cfg.dc_cal_ch2, cfg.dc_cal_ch1, cfg.cs_blank, cfg.gain_cs3, cfg.gain_cs2, cfg.gain_cs1)
 
 /**
  * @brief Register 0x0B: Voltage Regulator Control
@@ -472,11 +528,20 @@ typedef struct
     uint16_t vreg_uv_level;   // Bits 1:0 (drv8305_vreg_uv_level_t)
 } drv8305_ctrl0B_vreg_t;
 
+#define DRV8305_CTRL0B_WORD(vref_scale, sleep_dly, dis_vreg_pwrgd, vreg_uv_level) \
+    (uint16_t)(DRV8305_FIELD_PUT((vref_scale),     DRV8305_CTRL0B_VREF_SCALE_FIELD) | \
+               DRV8305_FIELD_PUT((sleep_dly),      DRV8305_CTRL0B_SLEEP_DELAY_FIELD) | \
+               DRV8305_FIELD_PUT((dis_vreg_pwrgd), DRV8305_CTRL0B_DIS_VREG_PWRGD_FIELD) | \
+               DRV8305_FIELD_PUT((vreg_uv_level),  DRV8305_CTRL0B_VREG_UV_LEVEL_FIELD))
+
+#define DRV8305_CTRL0B_VALID(vref_scale, sleep_dly, dis_vreg_pwrgd, vreg_uv_level) \
+    ((vref_scale)     <= DRV8305_FIELD_MAX(DRV8305_CTRL0B_VREF_SCALE_FIELD) && \
+     (sleep_dly)      <= DRV8305_FIELD_MAX(DRV8305_CTRL0B_SLEEP_DELAY_FIELD) && \
+     (dis_vreg_pwrgd) <= DRV8305_FIELD_MAX(DRV8305_CTRL0B_DIS_VREG_PWRGD_FIELD) && \
+     (vreg_uv_level)  <= DRV8305_FIELD_MAX(DRV8305_CTRL0B_VREG_UV_LEVEL_FIELD))
+
 #define DRV8305_PACK_CTRL0B(cfg) \
-    (uint16_t)(((cfg.vref_scale     & 0x03U) << 8) | \
-               ((cfg.sleep_dly      & 0x03U) << 3) | \
-               ((cfg.dis_vreg_pwrgd & 0x01U) << 2) | \
-               ((cfg.vreg_uv_level  & 0x03U) << 0))
+    DRV8305_CTRL0B_WORD(cfg.vref_scale, cfg.sleep_dly, cfg.dis_vreg_pwrgd, cfg.vreg_uv_level)
 
 /**
  * @brief Register 0x0C: VDS Sense Control
@@ -488,9 +553,16 @@ typedef struct
     uint16_t vds_mode;   // Bits 2:0 (drv8305_vds_mode_t)
 } drv8305_ctrl0C_vds_t;
 
+#define DRV8305_CTRL0C_WORD(vds_level, vds_mode) \
+    (uint16_t)(DRV8305_FIELD_PUT((vds_level), DRV8305_CTRL0C_VDS_LEVEL_FIELD) | \
+               DRV8305_FIELD_PUT((vds_mode),  DRV8305_CTRL0C_VDS_MODE_FIELD))
+
+#define DRV8305_CTRL0C_VALID(vds_level, vds_mode) \
+    ((vds_level) <= DRV8305_FIELD_MAX(DRV8305_CTRL0C_VDS_LEVEL_FIELD) && \
+     (vds_mode)  <= 0x02U)
+
 #define DRV8305_PACK_CTRL0C(cfg) \
-    (uint16_t)(((cfg.vds_level & 0x1FU) << 3) | \
-               ((cfg.vds_mode  & 0x07U) << 0))
+    DRV8305_CTRL0C_WORD(cfg.vds_level, cfg.vds_mode)
 
 
 #ifdef __cplusplus
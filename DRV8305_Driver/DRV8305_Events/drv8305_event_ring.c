@@ -0,0 +1,168 @@
+/**
+ * @file drv8305_event_ring.c
+ * @brief DRV8305 Event Ring - Timestamped Status Event Implementation
+ * @details Implements the single-producer / single-consumer status event ring.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * This implementation file contains:
+ *   - Ring reset
+ *   - Producer push with overflow counting
+ *   - Consumer pop, count and overflow accessors
+ *   - Overwrite-oldest event history for the post-mortem capture
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "drv8305_macros.h"
+#include "drv8305_event_ring.h"
+
+/**@brief: Free-running ring indices require a power-of-two depth **/
+typedef char drv8305_event_ring_depth_check[((DRV8305_EVENT_RING_DEPTH & (DRV8305_EVENT_RING_DEPTH - 1)) == 0) ? 1 : -1];
+typedef char drv8305_event_history_depth_check[((DRV8305_POSTMORTEM_EVENT_DEPTH & (DRV8305_POSTMORTEM_EVENT_DEPTH - 1)) == 0) ? 1 : -1];
+
+/* -------------------------------- PUBLIC FUNCTIONS -------------------------------- */
+
+/**
+ * @brief Reset ring (implementation)
+ * @param[out] ring Pointer to event ring
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_event_ring_init(drv8305_event_ring_t *ring)
+{
+    if(!ring) { return; }
+
+    DRV8305_SHARED_STORE(ring->head,      0U);
+    DRV8305_SHARED_STORE(ring->tail,      0U);
+    DRV8305_SHARED_STORE(ring->overflows, 0U);
+}
+
+/**
+ * @brief Append event (implementation)
+ * @param[in,out] ring Pointer to event ring
+ * @param[in] event Event to store
+ * @return true if stored, false on overflow
+ */
+DRV8305_PUBLIC bool drv8305_event_ring_push(drv8305_event_ring_t *ring, const drv8305_event_t *event)
+{
+    if(!ring || !event) { return false; }
+
+    uint32_t head = DRV8305_SHARED_LOAD_RELAXED(ring->head);
+
+    if((uint32_t)(head - DRV8305_SHARED_LOAD(ring->tail)) >= (uint32_t)DRV8305_EVENT_RING_DEPTH)
+    {
+        DRV8305_SHARED_STORE(ring->overflows, DRV8305_SHARED_LOAD_RELAXED(ring->overflows) + 1U);
+        return false;
+    }
+
+    /* A full ring reuses the slot the consumer just freed: its copy must be finished first */
+    DRV8305_MEMORY_BARRIER();
+    ring->entries[head & (DRV8305_EVENT_RING_DEPTH - 1)] = *event;
+    DRV8305_MEMORY_BARRIER();
+
+    DRV8305_SHARED_STORE(ring->head, head + 1U);
+
+    return true;
+}
+
+/**
+ * @brief Remove oldest event (implementation)
+ * @param[in,out] ring Pointer to event ring
+ * @param[out] event Destination of the event
+ * @return true if an event was returned, false if empty
+ */
+DRV8305_PUBLIC bool drv8305_event_ring_pop(drv8305_event_ring_t *ring, drv8305_event_t *event)
+{
+    if(!ring || !event) { return false; }
+
+    uint32_t tail = DRV8305_SHARED_LOAD_RELAXED(ring->tail);
+
+    if(tail == DRV8305_SHARED_LOAD(ring->head)) { return false; }
+
+    DRV8305_MEMORY_BARRIER();
+    *event = ring->entries[tail & (DRV8305_EVENT_RING_DEPTH - 1)];
+    DRV8305_MEMORY_BARRIER();
+
+    DRV8305_SHARED_STORE(ring->tail, tail + 1U);
+
+    return true;
+}
+
+/**
+ * @brief Get number of queued events (implementation)
+ * @param[in] ring Pointer to event ring
+ * @return uint32_t Queued events
+ */
+DRV8305_PUBLIC uint32_t drv8305_event_ring_count(const drv8305_event_ring_t *ring)
+{
+    if(!ring) { return 0; }
+
+    return (uint32_t)(DRV8305_SHARED_LOAD(ring->head) - DRV8305_SHARED_LOAD(ring->tail));
+}
+
+/**
+ * @brief Get dropped event count (implementation)
+ * @param[in] ring Pointer to event ring
+ * @return uint32_t Dropped events
+ */
+DRV8305_PUBLIC uint32_t drv8305_event_ring_overflows(const drv8305_event_ring_t *ring)
+{
+    if(!ring) { return 0; }
+
+    return DRV8305_SHARED_LOAD(ring->overflows);
+}
+
+/**
+ * @brief Reset history (implementation)
+ * @param[out] history Pointer to event history
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_event_history_init(drv8305_event_history_t *history)
+{
+    if(!history) { return; }
+
+    history->head = 0;
+}
+
+/**
+ * @brief Record event (implementation)
+ * @param[in,out] history Pointer to event history
+ * @param[in] event Event to store
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_event_history_record(drv8305_event_history_t *history, const drv8305_event_t *event)
+{
+    if(!history || !event) { return; }
+
+    history->entries[history->head & (DRV8305_POSTMORTEM_EVENT_DEPTH - 1)] = *event;
+    history->head++;
+}
+
+/**
+ * @brief Copy latest events (implementation)
+ * @param[in] history Pointer to event history
+ * @param[out] events Destination array, oldest first
+ * @param[in] max_events Capacity of the destination array
+ * @return uint16_t Number of events copied
+ */
+DRV8305_PUBLIC uint16_t drv8305_event_history_copy(const drv8305_event_history_t *history, drv8305_event_t *events, uint16_t max_events)
+{
+    if(!history || !events) { return 0; }
+
+    uint32_t head  = history->head;
+    uint32_t count = max_events;
+
+    if(count > (uint32_t)DRV8305_POSTMORTEM_EVENT_DEPTH) { count = DRV8305_POSTMORTEM_EVENT_DEPTH; }
+    if(count > head)                                     { count = head; }
+
+    for(uint32_t index = 0; index < count; index++)
+    {
+        events[index] = history->entries[(head - count + index) & (DRV8305_POSTMORTEM_EVENT_DEPTH - 1)];
+    }
+
+    return (uint16_t)count;
+}
@@ -0,0 +1,134 @@
+/**
+ * @file drv8305_event_ring.h
+ * @brief DRV8305 Event Ring - Timestamped Status Event Interface
+ * @details Declares the fixed-size, allocation-free ring of status change events handed
+ *          from the polling context (producer) to a logger task (consumer).
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * This module provides:
+ *   - drv8305_event_t: timestamp, register, raised/cleared masks and driver state
+ *   - drv8305_event_ring_t: single-producer / single-consumer ring with overflow counting
+ *   - Push (producer), pop and count accessors (consumer)
+ *   - drv8305_event_history_t: producer-owned copy of the latest events (post-mortem capture)
+ *
+ * @concurrency_model
+ * Exactly one producer and one consumer. head is written only by the producer, tail only by
+ * the consumer. The indices are shared words (drv8305_macros.h), C11 atomics loaded with
+ * acquire and stored with release where available; payload and index updates are also ordered
+ * with DRV8305_MEMORY_BARRIER(). Both sides fence between reading the other side's index and
+ * touching a slot, so a slot is never refilled before the consumer's copy of it has finished.
+ * When the ring is full the newest event is dropped and counted, the producer never waits.
+ * The history is written and read by the producer only and overwrites its oldest entry, so
+ * it holds the latest events whether or not the consumer keeps up.
+ */
+
+#ifndef DRV8305_EVENT_RING_H_
+#define DRV8305_EVENT_RING_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "drv8305_macros.h"
+
+/**
+ * @brief One status change event
+ */
+typedef struct
+{
+    uint32_t timestamp;         // Driver time (drv8305_api_timer ticks)
+    uint16_t register_address;  // Status register address (0x01 - 0x04)
+    uint16_t data;              // New register data (bits 10:0)
+    uint16_t raised;            // Bits changed 0 -> 1
+    uint16_t cleared;           // Bits changed 1 -> 0
+    uint16_t main_state;        // drv8305_sm_state_e at the time of the event
+} drv8305_event_t;
+
+typedef struct
+{
+    drv8305_shared_u32_t head;       // Written by producer
+    drv8305_shared_u32_t tail;       // Written by consumer
+    drv8305_shared_u32_t overflows;  // Written by producer
+    drv8305_event_t      entries[DRV8305_EVENT_RING_DEPTH];
+} drv8305_event_ring_t;
+
+typedef struct
+{
+    uint32_t        head;     // Events recorded (free-running)
+    drv8305_event_t entries[DRV8305_POSTMORTEM_EVENT_DEPTH];
+} drv8305_event_history_t;
+
+/**
+ * @brief Reset ring to empty
+ * @param[out] ring Pointer to event ring
+ * @return None
+ * @note Must not run concurrently with producer or consumer
+ */
+DRV8305_PUBLIC void     drv8305_event_ring_init      (drv8305_event_ring_t *ring);
+
+/**
+ * @brief Append event (producer)
+ * @param[in,out] ring Pointer to event ring
+ * @param[in] event Event to copy into the ring
+ * @return true if stored, false if the ring was full (overflow counted)
+ */
+DRV8305_PUBLIC bool     drv8305_event_ring_push      (drv8305_event_ring_t *ring, const drv8305_event_t *event);
+
+/**
+ * @brief Remove oldest event (consumer)
+ * @param[in,out] ring Pointer to event ring
+ * @param[out] event Destination of the event
+ * @return true if an event was returned, false if the ring is empty
+ */
+DRV8305_PUBLIC bool     drv8305_event_ring_pop       (drv8305_event_ring_t *ring, drv8305_event_t *event);
+
+/**
+ * @brief Get number of queued events
+ * @param[in] ring Pointer to event ring
+ * @return uint32_t Events waiting for the consumer
+ */
+DRV8305_PUBLIC uint32_t drv8305_event_ring_count     (const drv8305_event_ring_t *ring);
+
+/**
+ * @brief Get number of events dropped because the ring was full
+ * @param[in] ring Pointer to event ring
+ * @return uint32_t Total dropped events
+ */
+DRV8305_PUBLIC uint32_t drv8305_event_ring_overflows (const drv8305_event_ring_t *ring);
+
+/**
+ * @brief Reset history to empty
+ * @param[out] history Pointer to event history
+ * @return None
+ */
+DRV8305_PUBLIC void     drv8305_event_history_init   (drv8305_event_history_t *history);
+
+/**
+ * @brief Record event, overwriting the oldest once full (producer)
+ * @param[in,out] history Pointer to event history
+ * @param[in] event Event to copy into the history
+ * @return None
+ */
+DRV8305_PUBLIC void     drv8305_event_history_record (drv8305_event_history_t *history, const drv8305_event_t *event);
+
+/**
+ * @brief Copy the latest recorded events (producer)
+ * @param[in] history Pointer to event history
+ * @param[out] events Destination array, oldest first
+ * @param[in] max_events Capacity of the destination array
+ * @return uint16_t Number of events copied (at most DRV8305_POSTMORTEM_EVENT_DEPTH)
+ */
+DRV8305_PUBLIC uint16_t drv8305_event_history_copy   (const drv8305_event_history_t *history, drv8305_event_t *events, uint16_t max_events);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRV8305_EVENT_RING_H_ */
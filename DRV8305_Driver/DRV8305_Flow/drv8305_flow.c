@@ -0,0 +1,158 @@
+/**
+ * @file drv8305_flow.c
+ * @brief DRV8305 Flow - Implementation
+ * @details Implements the programming pass and the status scan as one linear flow body.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * This implementation file contains:
+ *   - Flow initialization, transport completion and programming requests
+ *   - drv8305_flow_polling(): the flow body, resumed with a single switch per poll
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "drv8305_macros.h"
+#include "DRV8305_API/drv8305_api.h"
+#include "DRV8305_API/drv8305_timing.h"
+#include "drv8305_flow.h"
+
+/* -------------------------------- PUBLIC FUNCTIONS -------------------------------- */
+
+/**
+ * @brief Initialize the flow (implementation)
+ * @param[out] flow Flow state
+ * @param[in] driver Initialized user object
+ * @param[in] transfer_start Transport start function
+ * @param[in] transfer_context Passed to transfer_start
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_flow_init(drv8305_flow_t *flow, drv8305_user_object_t *driver, drv8305_flow_transfer_start_cb_t transfer_start, void *transfer_context)
+{
+    if(!flow) { return; }
+
+    memset(flow, 0, sizeof(drv8305_flow_t));
+
+    flow->driver           = driver;
+    flow->transfer_start   = transfer_start;
+    flow->transfer_context = transfer_context;
+}
+
+/**
+ * @brief Run the flow until its next await point (implementation)
+ * @details Each register access is frame -> await response -> drv8305_api_frame_process()
+ *          -> await the same gap the state machine uses.
+ * @param[in,out] flow Flow state
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_flow_polling(drv8305_flow_t *flow)
+{
+    if(!flow || !flow->driver || !flow->transfer_start) { return; }
+
+    drv8305_user_object_t *driver = flow->driver;
+
+    DRV8305_FLOW_BEGIN(flow);
+
+    for(;;)
+    {
+        /**@brief: Programming pass - write every control register, then read each one back */
+        /* Cleared before the first write, so a request arriving during the pass runs another one */
+        flow->reprogram = false;
+
+        drv8305_api_ic_enable(driver);
+        drv8305_api_ic_wake_up(driver);
+        DRV8305_FLOW_DELAY(flow, DRV8305_REGISTER_SWITCH_DELAY_MS);
+
+        for(flow->index = DRV8305_CONTROL_05_ARRAY_INDEX; flow->index <= DRV8305_CONTROL_0C_ARRAY_INDEX; flow->index++)
+        {
+            DRV8305_FLOW_TRANSFER(flow, drv8305_api_frame_create(driver, flow->index, true));
+            drv8305_api_frame_process(driver, flow->index, flow->frame, flow->response);
+            DRV8305_FLOW_DELAY(flow, DRV8305_TIMING_CONTROL_GAP(driver));
+        }
+
+        for(flow->index = DRV8305_CONTROL_05_ARRAY_INDEX; flow->index <= DRV8305_CONTROL_0C_ARRAY_INDEX; flow->index++)
+        {
+            DRV8305_FLOW_TRANSFER(flow, drv8305_api_frame_create(driver, flow->index, false));
+            drv8305_api_frame_process(driver, flow->index, flow->frame, flow->response);
+
+            if(flow->index != DRV8305_CONTROL_0C_ARRAY_INDEX)
+            {
+                DRV8305_FLOW_DELAY(flow, DRV8305_TIMING_CONTROL_GAP(driver));
+            }
+        }
+
+        drv8305_api_control_pass_complete(driver);
+        flow->passes++;
+
+        /**@brief: Status scans until a brown-out bit or a request calls for programming */
+        while(!flow->reprogram)
+        {
+            DRV8305_FLOW_DELAY(flow, DRV8305_REGISTER_SWITCH_DELAY_MS);
+
+            flow->raised = 0;
+
+            for(flow->index = DRV8305_STATUS_01_ARRAY_INDEX; flow->index <= DRV8305_STATUS_04_ARRAY_INDEX; flow->index++)
+            {
+                DRV8305_FLOW_TRANSFER(flow, drv8305_api_frame_create(driver, flow->index, false));
+
+                if(flow->index == DRV8305_STATUS_03_ARRAY_INDEX)
+                {
+                    flow->raised = drv8305_api_frame_process(driver, flow->index, flow->frame, flow->response);
+                }
+                else
+                {
+                    drv8305_api_frame_process(driver, flow->index, flow->frame, flow->response);
+                }
+
+                if(flow->index != DRV8305_STATUS_04_ARRAY_INDEX)
+                {
+                    DRV8305_FLOW_DELAY(flow, DRV8305_TIMING_STATUS_GAP(driver));
+                }
+            }
+
+            drv8305_api_scan_complete(driver);
+            flow->scans++;
+
+            if((flow->raised & DRV8305_RESET_DETECT_IC_FAULTS) != 0)
+            {
+                flow->reprogram = true;
+            }
+
+            DRV8305_FLOW_DELAY(flow, DRV8305_STANDARD_TASK_DELAY_TIMEOUT);
+        }
+    }
+
+    DRV8305_FLOW_END(flow);
+}
+
+/**
+ * @brief Report the response of the frame in flight (implementation)
+ * @param[in,out] flow Flow state
+ * @param[in] response 16-bit response frame
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_flow_transfer_complete(drv8305_flow_t *flow, uint16_t response)
+{
+    if(!flow) { return; }
+
+    flow->response         = response;
+    flow->transfers++;
+    flow->transfer_pending = false;
+}
+
+/**
+ * @brief Request a programming pass (implementation)
+ * @param[in,out] flow Flow state
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_flow_request_programming(drv8305_flow_t *flow)
+{
+    if(!flow) { return; }
+
+    flow->reprogram = true;
+}
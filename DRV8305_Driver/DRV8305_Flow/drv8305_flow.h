@@ -0,0 +1,193 @@
+/**
+ * @file drv8305_flow.h
+ * @brief DRV8305 Flow - Linear Programming and Scan Sequences over an Asynchronous Transport
+ * @details Declares a stackless-coroutine front end of the driver: the control programming
+ *          pass and the status scan are written as straight-line code in which every SPI
+ *          frame and every delay is an await point, so a DMA transport completes frames from
+ *          its interrupt instead of blocking the polling context.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * This module provides:
+ *   - DRV8305_FLOW_BEGIN / _AWAIT / _DELAY / _TRANSFER / _END: local-continuation macros
+ *     (a switch on the source line, no stack or heap frame)
+ *   - drv8305_flow_t: the whole coroutine state, allocated statically by the application
+ *   - drv8305_flow_polling(): resumes the flow at its last await point
+ *   - drv8305_flow_transfer_complete(): transport completion, callable from an ISR
+ *
+ * @sequences
+ * Same registers, order and delays as drv8305_api_master_sm_polling():
+ *   - Programming pass: EN_GATE/WAKE high, write 0x05 - 0x0C, read back 0x05 - 0x0C
+ *   - Status scan: read 0x01 - 0x04, publish snapshot and summary, repeat
+ * A brown-out bit in Status 0x03 (DRV8305_RESET_DETECT_IC_FAULTS) or
+ * drv8305_flow_request_programming() runs the programming pass again at the end of a scan, or
+ * right after the pass in progress when it arrives during one.
+ * Every frame goes through drv8305_api_frame_process(), so protection, events, statistics,
+ * callbacks, subscribers and readback confirmation behave as with the state machine.
+ *
+ * @scope
+ * Staged commits, fault recovery, reset re-programming with retry limits and background
+ * scrubbing stay features of drv8305_api_master_sm_polling(); do not run both front ends on
+ * one user object.
+ *
+ * @usage
+ * @code
+ * DRV8305_PRIVATE drv8305_flow_t drv8305_flow;
+ *
+ * drv8305_api_initialize(&user_drv8305_obj);
+ * drv8305_flow_init(&drv8305_flow, &user_drv8305_obj, board_spi_dma_start, NULL);
+ *
+ * for(;;) { drv8305_flow_polling(&drv8305_flow); }              // main loop, 1 ms timer keeps drv8305_api_timer()
+ * void board_spi_dma_isr(void) { drv8305_flow_transfer_complete(&drv8305_flow, SPI_RX); }
+ * @endcode
+ */
+
+#ifndef DRV8305_FLOW_H_
+#define DRV8305_FLOW_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "drv8305_macros.h"
+#include "DRV8305_API/drv8305_api.h"
+
+/**
+ * @brief Start one SPI frame on the transport
+ * @param[in] context Transport context given to drv8305_flow_init()
+ * @param[in] frame 16-bit command frame
+ * @return true if the frame was started, false if the transport is busy (retried next poll)
+ * @note The transport reports the response with drv8305_flow_transfer_complete(), which may
+ *       also be called before this function returns (blocking transport)
+ */
+typedef bool (*drv8305_flow_transfer_start_cb_t)(void *context, uint16_t frame);
+
+/**
+ * @brief Flow state (coroutine frame)
+ * @note Everything that must survive an await point lives here; flow locals do not
+ */
+typedef struct
+{
+    drv8305_user_object_t           *driver;
+    drv8305_flow_transfer_start_cb_t transfer_start;
+    void                            *transfer_context;
+
+    uint16_t                         continuation;      // Resume point (source line), 0 = start
+    uint16_t                         index;             // register_manager[] index of the running loop
+    uint32_t                         wait_start;        // system_time at the start of a delay
+    uint16_t                         raised;            // Status 0x03 bits raised during the scan
+    bool                             reprogram;         // Run the programming pass after this scan or pass
+
+    bool                             transfer_started;  // Transport accepted the frame in flight
+    uint16_t                         frame;             // Command frame of the last transfer
+    volatile bool                    transfer_pending;  // Set before start, cleared by completion
+    volatile uint16_t                response;          // Response frame of the last transfer
+
+    uint32_t                         transfers;         // Completed frames
+    uint32_t                         passes;            // Completed programming passes
+    uint32_t                         scans;             // Completed status scans
+} drv8305_flow_t;
+
+/**
+ * @brief Open the flow body; resumes at the last await point
+ * @note Await points are identified by their source line: at most one await per line
+ */
+#define DRV8305_FLOW_BEGIN(flow)               switch((flow)->continuation) { case 0:
+
+/** @brief Return from the flow body until condition holds (re-evaluated on every poll) */
+#define DRV8305_FLOW_AWAIT(flow, condition)    do { (flow)->continuation = (uint16_t)__LINE__;                        \
+                                                    if(0) { case __LINE__: ; }                                        \
+                                                    if(!(condition)) { return; } } while(0)
+
+/** @brief Await delay_ms ticks of drv8305_api_timer() */
+#define DRV8305_FLOW_DELAY(flow, delay_ms)     do { (flow)->wait_start = (flow)->driver->state.system_time;          \
+                                                    DRV8305_FLOW_AWAIT(flow, drv8305_flow_delay_elapsed(flow, (uint32_t)(delay_ms))); } while(0)
+
+/** @brief Start one frame (retried while the transport is busy) and await its response in flow->response, the frame sent in flow->frame */
+#define DRV8305_FLOW_TRANSFER(flow, frame)     do { (flow)->transfer_started = false;                                 \
+                                                    DRV8305_FLOW_AWAIT(flow, drv8305_flow_transfer_step(flow, frame)); } while(0)
+
+/** @brief Close the flow body; a flow that runs off its end restarts */
+#define DRV8305_FLOW_END(flow)                 } (flow)->continuation = 0
+
+/**
+ * @brief Check whether a delay has elapsed (used by DRV8305_FLOW_DELAY)
+ * @param[in] flow Flow state
+ * @param[in] delay_ms Delay in drv8305_api_timer() ticks, 0 never waits
+ * @return true once delay_ms ticks have passed since flow->wait_start
+ */
+DRV8305_INLINE bool drv8305_flow_delay_elapsed(const drv8305_flow_t *flow, uint32_t delay_ms)
+{
+    return (flow->driver->state.system_time - flow->wait_start) >= delay_ms;
+}
+
+/**
+ * @brief Advance the frame in flight (used by DRV8305_FLOW_TRANSFER)
+ * @param[in,out] flow Flow state
+ * @param[in] frame Command frame, started once the transport accepts it
+ * @return true once the response has arrived
+ */
+DRV8305_INLINE bool drv8305_flow_transfer_step(drv8305_flow_t *flow, uint16_t frame)
+{
+    if(!flow->transfer_started)
+    {
+        flow->transfer_pending = true;
+        flow->transfer_started = flow->transfer_start(flow->transfer_context, frame);
+
+        if(!flow->transfer_started) { return false; }
+
+        flow->frame = frame;
+    }
+
+    return !flow->transfer_pending;
+}
+
+/**
+ * @brief Initialize the flow
+ * @param[out] flow Flow state
+ * @param[in] driver Initialized user object (drv8305_api_initialize())
+ * @param[in] transfer_start Transport start function
+ * @param[in] transfer_context Passed to transfer_start
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_flow_init(drv8305_flow_t *flow, drv8305_user_object_t *driver, drv8305_flow_transfer_start_cb_t transfer_start, void *transfer_context);
+
+/**
+ * @brief Run the flow until its next await point
+ * @param[in,out] flow Flow state
+ * @return None
+ * @note Replaces drv8305_api_master_sm_polling(); drv8305_api_timer() stays the time base
+ */
+DRV8305_PUBLIC void drv8305_flow_polling(drv8305_flow_t *flow);
+
+/**
+ * @brief Report the response of the frame in flight
+ * @param[in,out] flow Flow state
+ * @param[in] response 16-bit response frame
+ * @return None
+ * @note Callable from the transport interrupt; the response is processed on the next poll
+ */
+DRV8305_PUBLIC void drv8305_flow_transfer_complete(drv8305_flow_t *flow, uint16_t response);
+
+/**
+ * @brief Run the programming pass again at the end of the current status scan
+ * @details E.g. after drv8305_api_set_register_image() or an edit of the working copy
+ *          (user_drv8305_obj.config); the pass writes drv8305_api_get_control_word(). A request
+ *          made during a programming pass is not lost: registers that pass has already written
+ *          may hold the old words, so another pass follows it.
+ * @param[in,out] flow Flow state
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_flow_request_programming(drv8305_flow_t *flow);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRV8305_FLOW_H_ */
@@ -0,0 +1,324 @@
+/**
+ * @file drv8305_mailbox.c
+ * @brief DRV8305 Mailbox - Split-Execution (Dual-Core) Implementation
+ * @details Implements the server and client sides of the shared-memory mailbox.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * This implementation file contains:
+ *   - Mailbox and server initialization
+ *   - Server polling: command drain, state machine step, event forwarding, snapshot publication
+ *   - Client accessors: status snapshot, event pop, overflow counter, commit state, command post
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "drv8305_macros.h"
+#include "DRV8305_API/drv8305_api.h"
+#include "DRV8305_Snapshot/drv8305_snapshot.h"
+#include "DRV8305_Events/drv8305_event_ring.h"
+#include "drv8305_mailbox.h"
+
+/**@brief: Server and client run on different CPUs, an empty barrier would reorder the rings **/
+#if defined(DRV8305_MEMORY_BARRIER_NONE)
+#error "drv8305_mailbox.c needs a real fence: define DRV8305_MEMORY_BARRIER() for the target before drv8305_macros.h, or build as C11"
+#endif
+
+/**@brief: Free-running ring indices require a power-of-two depth **/
+typedef char drv8305_mailbox_command_depth_check[((DRV8305_MAILBOX_COMMAND_DEPTH & (DRV8305_MAILBOX_COMMAND_DEPTH - 1)) == 0) ? 1 : -1];
+
+/**@brief: Commit result word: commit state in the low bits, ticket of its command above **/
+#define DRV8305_MAILBOX_STATUS_BITS              4U
+#define DRV8305_MAILBOX_STATUS_MASK              ((1UL << DRV8305_MAILBOX_STATUS_BITS) - 1U)
+#define DRV8305_MAILBOX_TICKET_MASK              (0xFFFFFFFFUL >> DRV8305_MAILBOX_STATUS_BITS)
+#define DRV8305_MAILBOX_RESULT(ticket, status)   ((uint32_t)(((ticket) & DRV8305_MAILBOX_TICKET_MASK) << DRV8305_MAILBOX_STATUS_BITS) | (uint32_t)(status))
+#define DRV8305_MAILBOX_RESULT_SLOT(ticket)      (((ticket) - 1U) & (uint32_t)(DRV8305_MAILBOX_COMMAND_DEPTH - 1))
+
+typedef char drv8305_mailbox_status_bits_check[(DRV8305_COMMIT_FAILED <= DRV8305_MAILBOX_STATUS_MASK) ? 1 : -1];
+
+/* -------------------------------- FUNCTION PROTOTYPES -------------------------------- */
+DRV8305_PRIVATE bool drv8305_mailbox_server_apply_command  (drv8305_mailbox_server_t *server, const drv8305_mailbox_command_t *command, uint32_t ticket);
+DRV8305_PRIVATE void drv8305_mailbox_server_forward_events (drv8305_mailbox_server_t *server);
+DRV8305_PRIVATE void drv8305_mailbox_server_publish        (drv8305_mailbox_server_t *server);
+
+/* -------------------------------- PUBLIC FUNCTIONS -------------------------------- */
+
+/**
+ * @brief Initialize shared mailbox (implementation)
+ * @param[out] mailbox Pointer to shared mailbox
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_mailbox_init(drv8305_mailbox_t *mailbox)
+{
+    if(!mailbox) { return; }
+
+    drv8305_snapshot_init(&mailbox->status);
+    drv8305_event_ring_init(&mailbox->events);
+
+    DRV8305_SHARED_STORE(mailbox->command_head,  0U);
+    DRV8305_SHARED_STORE(mailbox->command_tail,  0U);
+
+    for(int slot = 0; slot < DRV8305_MAILBOX_COMMAND_DEPTH; slot++)
+    {
+        DRV8305_SHARED_STORE(mailbox->commit_results[slot], DRV8305_MAILBOX_RESULT(0U, DRV8305_COMMIT_IDLE));
+    }
+}
+
+/**
+ * @brief Bind server to mailbox and driver (implementation)
+ * @param[out] server Pointer to server bookkeeping
+ * @param[in] mailbox Pointer to shared mailbox
+ * @param[in] driver Pointer to DRV8305 user object
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_mailbox_server_init(drv8305_mailbox_server_t *server, drv8305_mailbox_t *mailbox, drv8305_user_object_t *driver)
+{
+    if(!server) { return; }
+
+    server->mailbox         = mailbox;
+    server->driver          = driver;
+    server->published_count = 0;
+    server->commit_ticket   = 0;
+    server->committing      = false;
+}
+
+/**
+ * @brief Server polling step (implementation)
+ * @details Commands are applied before the state machine step so that they always land
+ *          between two register operations, never in the middle of one.
+ * @param[in,out] server Pointer to server bookkeeping
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_mailbox_server_polling(drv8305_mailbox_server_t *server)
+{
+    if(!server || !server->mailbox || !server->driver) { return; }
+
+    drv8305_mailbox_t *mailbox = server->mailbox;
+    uint32_t           tail    = DRV8305_SHARED_LOAD_RELAXED(mailbox->command_tail);
+
+    while(tail != DRV8305_SHARED_LOAD(mailbox->command_head))
+    {
+        DRV8305_MEMORY_BARRIER();
+
+        /* A command the driver cannot take yet stays queued, later ones wait behind it */
+        if(!drv8305_mailbox_server_apply_command(server, &mailbox->commands[tail & (DRV8305_MAILBOX_COMMAND_DEPTH - 1)], tail + 1U)) { break; }
+
+        DRV8305_MEMORY_BARRIER();
+        tail = tail + 1;
+        DRV8305_SHARED_STORE(mailbox->command_tail, tail);
+    }
+
+    drv8305_api_master_sm_polling(server->driver);
+
+    drv8305_mailbox_server_forward_events(server);
+
+    if(server->committing)
+    {
+        drv8305_commit_status_e status = drv8305_api_get_commit_status(server->driver);
+
+        DRV8305_SHARED_STORE(mailbox->commit_results[DRV8305_MAILBOX_RESULT_SLOT(server->commit_ticket)],
+                             DRV8305_MAILBOX_RESULT(server->commit_ticket, status));
+
+        /* Final: the slot belongs to the client again */
+        if(status == DRV8305_COMMIT_DONE || status == DRV8305_COMMIT_ROLLED_BACK || status == DRV8305_COMMIT_FAILED) { server->committing = false; }
+    }
+
+    if(server->driver->snapshot.publication_count != server->published_count)
+    {
+        drv8305_mailbox_server_publish(server);
+    }
+}
+
+/**
+ * @brief Read latest status snapshot (implementation)
+ * @param[in] mailbox Pointer to shared mailbox
+ * @param[out] snapshot Destination of the coherent register image
+ * @return true if a coherent copy was taken
+ */
+DRV8305_PUBLIC bool drv8305_mailbox_client_get_status(const drv8305_mailbox_t *mailbox, drv8305_snapshot_t *snapshot)
+{
+    if(!mailbox) { return false; }
+
+    return drv8305_snapshot_read(&mailbox->status, snapshot);
+}
+
+/**
+ * @brief Pop oldest status change event (implementation)
+ * @param[in,out] mailbox Pointer to shared mailbox
+ * @param[out] event Destination of the event
+ * @return true if an event was returned, false if the ring is empty
+ */
+DRV8305_PUBLIC bool drv8305_mailbox_client_pop_event(drv8305_mailbox_t *mailbox, drv8305_event_t *event)
+{
+    if(!mailbox) { return false; }
+
+    return drv8305_event_ring_pop(&mailbox->events, event);
+}
+
+/**
+ * @brief Get dropped event count (implementation)
+ * @param[in] mailbox Pointer to shared mailbox
+ * @return uint32_t Total dropped events
+ */
+DRV8305_PUBLIC uint32_t drv8305_mailbox_client_get_event_overflows(const drv8305_mailbox_t *mailbox)
+{
+    if(!mailbox) { return 0; }
+
+    return drv8305_event_ring_overflows(&mailbox->events);
+}
+
+/**
+ * @brief Get commit state of a posted configuration (implementation)
+ * @details The result slot still holds an older ticket until the server has taken the command.
+ * @param[in] mailbox Pointer to shared mailbox
+ * @param[in] ticket Ticket of a SET_CONFIGURATION command
+ * @return drv8305_commit_status_e Commit state of that ticket, DRV8305_COMMIT_PENDING until it is taken
+ */
+DRV8305_PUBLIC drv8305_commit_status_e drv8305_mailbox_client_get_commit_status(const drv8305_mailbox_t *mailbox, uint32_t ticket)
+{
+    if(!mailbox) { return DRV8305_COMMIT_IDLE; }
+
+    uint32_t result = DRV8305_SHARED_LOAD(mailbox->commit_results[DRV8305_MAILBOX_RESULT_SLOT(ticket)]);
+
+    if(result >> DRV8305_MAILBOX_STATUS_BITS != (ticket & DRV8305_MAILBOX_TICKET_MASK)) { return DRV8305_COMMIT_PENDING; }
+
+    return (drv8305_commit_status_e)(result & DRV8305_MAILBOX_STATUS_MASK);
+}
+
+/**
+ * @brief Post command to server (implementation)
+ * @param[in,out] mailbox Pointer to shared mailbox
+ * @param[in] command Command to queue
+ * @param[out] ticket Queue position of the command plus one, may be NULL
+ * @return true if queued, false if the command queue is full
+ */
+DRV8305_PUBLIC bool drv8305_mailbox_client_post_command(drv8305_mailbox_t *mailbox, const drv8305_mailbox_command_t *command, uint32_t *ticket)
+{
+    if(!mailbox || !command) { return false; }
+
+    uint32_t head = DRV8305_SHARED_LOAD_RELAXED(mailbox->command_head);
+
+    if((uint32_t)(head - DRV8305_SHARED_LOAD(mailbox->command_tail)) >= (uint32_t)DRV8305_MAILBOX_COMMAND_DEPTH) { return false; }
+
+    DRV8305_MEMORY_BARRIER();
+    mailbox->commands[head & (DRV8305_MAILBOX_COMMAND_DEPTH - 1)] = *command;
+    DRV8305_MEMORY_BARRIER();
+
+    DRV8305_SHARED_STORE(mailbox->command_head, head + 1U);
+
+    if(ticket) { *ticket = head + 1U; }
+
+    return true;
+}
+
+/* -------------------------------- PRIVATE FUNCTIONS -------------------------------- */
+
+/**
+ * @brief Apply one client command on the server CPU (internal)
+ * @details A configuration goes through the staged profile and the verified commit with
+ *          rollback, like a local drv8305_api_commit_configuration(). While a previous
+ *          commit is still pending or writing the staged profile must not change, so the
+ *          command is left in the queue.
+ * @param[in,out] server Pointer to server bookkeeping
+ * @param[in] command Command at the head of the queue
+ * @param[in] ticket Ticket the client got for the command
+ * @return true if applied, false if it has to stay queued
+ */
+DRV8305_PRIVATE bool drv8305_mailbox_server_apply_command(drv8305_mailbox_server_t *server, const drv8305_mailbox_command_t *command, uint32_t ticket)
+{
+    drv8305_user_object_t *driver = server->driver;
+
+    switch (command->command)
+    {
+        case DRV8305_MAILBOX_CMD_SET_CONFIGURATION:
+        {
+            drv8305_commit_status_e status = drv8305_api_get_commit_status(driver);
+
+            if(status == DRV8305_COMMIT_PENDING || status == DRV8305_COMMIT_WRITING || status == DRV8305_COMMIT_ROLLING_BACK)
+            {
+                return false;
+            }
+
+            drv8305_configuration_pack(drv8305_api_get_staged_configuration(driver), &command->config);
+            drv8305_api_commit_configuration(driver);
+            server->commit_ticket = ticket;
+            server->committing    = true;
+
+            break;
+        }
+
+        case DRV8305_MAILBOX_CMD_CONFIRM_CONFIGURATION:
+        {
+            drv8305_api_confirm_configuration(driver);
+
+            break;
+        }
+
+        case DRV8305_MAILBOX_CMD_IC_ENABLE:
+        {
+            drv8305_api_ic_enable(driver);
+
+            break;
+        }
+
+        case DRV8305_MAILBOX_CMD_IC_DISABLE:
+        {
+            drv8305_api_ic_disable(driver);
+
+            break;
+        }
+
+        case DRV8305_MAILBOX_CMD_IC_SLEEP:
+        {
+            drv8305_api_ic_sleep(driver);
+
+            break;
+        }
+
+        case DRV8305_MAILBOX_CMD_IC_WAKE_UP:
+        {
+            drv8305_api_ic_wake_up(driver);
+
+            break;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Move driver status events into the shared ring (internal)
+ * @details The server is the only consumer of the driver ring and the only producer of the
+ *          shared ring. Events the client has no room for are counted as shared overflows.
+ * @param[in,out] server Pointer to server bookkeeping
+ * @return None
+ */
+DRV8305_PRIVATE void drv8305_mailbox_server_forward_events(drv8305_mailbox_server_t *server)
+{
+    drv8305_event_t event;
+
+    while(drv8305_event_ring_pop(&server->driver->events, &event))
+    {
+        drv8305_event_ring_push(&server->mailbox->events, &event);
+    }
+}
+
+/**
+ * @brief Forward driver snapshot into shared memory (internal)
+ * @param[in,out] server Pointer to server bookkeeping
+ * @return None
+ */
+DRV8305_PRIVATE void drv8305_mailbox_server_publish(drv8305_mailbox_server_t *server)
+{
+    drv8305_snapshot_t snapshot;
+
+    if(!drv8305_api_get_register_snapshot(server->driver, &snapshot)) { return; }
+
+    server->published_count = server->driver->snapshot.publication_count;
+
+    drv8305_snapshot_publish(&server->mailbox->status, snapshot.registers, snapshot.timestamp);
+}
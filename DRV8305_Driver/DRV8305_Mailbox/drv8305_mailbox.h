@@ -0,0 +1,184 @@
+/**
+ * @file drv8305_mailbox.h
+ * @brief DRV8305 Mailbox - Split-Execution (Dual-Core) Interface
+ * @details Declares the shared-memory mailbox used to run the DRV8305 state machine on
+ *          one CPU (server) while another CPU (client) reads status and posts commands.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * This module provides split-execution support for dual-core / co-processor targets:
+ *   - drv8305_mailbox_t: shared-memory block (status snapshot, fault event ring, command queue)
+ *   - Server API: owns the drv8305_user_object_t, runs drv8305_api_master_sm_polling(),
+ *     publishes snapshots and fault events, applies queued commands between polls
+ *   - Client API: read-only status access, event consumption and command posting
+ *
+ * @shared_memory
+ * Place the drv8305_mailbox_t instance in memory visible to both CPUs (e.g. C2000 MSGRAM or
+ * a GSx RAM block owned by the server). The drv8305_mailbox_server_t and the user object stay
+ * private to the server CPU.
+ *
+ * @concurrency_model
+ * Every channel has exactly one producer and one consumer:
+ *   - Status snapshot: server writes, client reads (double-buffered seqlock, drv8305_snapshot.h)
+ *   - Event ring:      server pushes, client pops (drv8305_event_ring.h, overflow counted by the server)
+ *   - Command queue:   client posts, server drains (SPSC ring, post fails when full)
+ *   - Commit state:    server writes after every polling step, client reads
+ * Ring indices are free-running counters; each index is written by one side only. Ordering
+ * between payload and index updates uses DRV8305_MEMORY_BARRIER(). drv8305_mailbox.c does not
+ * build when that hook is empty (DRV8305_MEMORY_BARRIER_NONE): compilers without C11 atomics or
+ * GNU builtins, such as TI cl2000, must define it as the target's inter-core fence.
+ * Every word both sides touch (snapshot seqlock, ring indices, commit state) is a shared word
+ * (drv8305_macros.h): a C11 atomic where the compiler has them, a volatile word otherwise.
+ * Both sides must include this header with the same language standard.
+ *
+ * @configuration
+ * DRV8305_MAILBOX_CMD_SET_CONFIGURATION is applied through the staged profile and the verified
+ * commit with rollback (drv8305_api_commit_configuration()). drv8305_mailbox_client_post_command()
+ * returns a ticket for the command, and drv8305_mailbox_client_get_commit_status() reports the
+ * commit of that ticket only, never the result a previous configuration left behind. The result
+ * is kept per command slot, so it stays readable until DRV8305_MAILBOX_COMMAND_DEPTH more
+ * commands have been posted. A configuration posted while a commit is still in progress stays
+ * queued, and the commands behind it wait, until that commit has finished.
+ */
+
+#ifndef DRV8305_MAILBOX_H_
+#define DRV8305_MAILBOX_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "drv8305_macros.h"
+#include "DRV8305_API/drv8305_api.h"
+#include "DRV8305_Snapshot/drv8305_snapshot.h"
+#include "DRV8305_Events/drv8305_event_ring.h"
+
+/**
+ * @brief Commands the client may post to the server
+ */
+typedef enum
+{
+    DRV8305_MAILBOX_CMD_CONFIRM_CONFIGURATION, // -> drv8305_api_confirm_configuration()
+    DRV8305_MAILBOX_CMD_SET_CONFIGURATION,     // -> Copy into the staged profile, drv8305_api_commit_configuration()
+    DRV8305_MAILBOX_CMD_IC_ENABLE,             // -> drv8305_api_ic_enable()
+    DRV8305_MAILBOX_CMD_IC_DISABLE,            // -> drv8305_api_ic_disable()
+    DRV8305_MAILBOX_CMD_IC_SLEEP,              // -> drv8305_api_ic_sleep()
+    DRV8305_MAILBOX_CMD_IC_WAKE_UP,            // -> drv8305_api_ic_wake_up()
+} drv8305_mailbox_command_e;
+
+typedef struct
+{
+    drv8305_mailbox_command_e command;
+    drv8305_configuration_t   config;  // Payload of DRV8305_MAILBOX_CMD_SET_CONFIGURATION
+} drv8305_mailbox_command_t;
+
+/**
+ * @brief Shared-memory block between server and client
+ */
+typedef struct
+{
+    drv8305_snapshot_publisher_t status;
+
+    drv8305_event_ring_t         events;           // Server pushes, client pops
+
+    drv8305_shared_u32_t         command_head;     // Written by client
+    drv8305_shared_u32_t         command_tail;     // Written by server
+    drv8305_mailbox_command_t    commands[DRV8305_MAILBOX_COMMAND_DEPTH];
+
+    drv8305_shared_u32_t         commit_results[DRV8305_MAILBOX_COMMAND_DEPTH];  // Ticket and commit state per command slot, written by server
+} drv8305_mailbox_t;
+
+/**
+ * @brief Server-private bookkeeping (not shared)
+ */
+typedef struct
+{
+    drv8305_mailbox_t     *mailbox;
+    drv8305_user_object_t *driver;
+    uint32_t               published_count;
+    uint32_t               commit_ticket;  // Ticket of the configuration being committed
+    bool                   committing;     // commit_ticket has not reached a final state yet
+} drv8305_mailbox_server_t;
+
+/**
+ * @brief Initialize shared mailbox
+ * @param[out] mailbox Pointer to shared mailbox
+ * @return None
+ * @note Call once, before either side starts using the mailbox
+ */
+DRV8305_PUBLIC void drv8305_mailbox_init                 (drv8305_mailbox_t *mailbox);
+
+/**
+ * @brief Bind server to its mailbox and driver instance
+ * @param[out] server Pointer to server bookkeeping
+ * @param[in] mailbox Pointer to shared mailbox
+ * @param[in] driver Pointer to initialized DRV8305 user object
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_mailbox_server_init          (drv8305_mailbox_server_t *server, drv8305_mailbox_t *mailbox, drv8305_user_object_t *driver);
+
+/**
+ * @brief Server polling step
+ * @details Applies queued commands, runs one drv8305_api_master_sm_polling() iteration,
+ *          forwards the driver's status events and publishes a new status snapshot when a
+ *          scan has completed.
+ * @param[in,out] server Pointer to server bookkeeping
+ * @return None
+ * @note Replaces drv8305_api_master_sm_polling() on the server CPU; drv8305_api_timer()
+ *       is still called from the server's timer interrupt
+ */
+DRV8305_PUBLIC void drv8305_mailbox_server_polling       (drv8305_mailbox_server_t *server);
+
+/**
+ * @brief Read latest status snapshot (client)
+ * @param[in] mailbox Pointer to shared mailbox
+ * @param[out] snapshot Destination of the coherent register image
+ * @return true if a coherent copy was taken
+ */
+DRV8305_PUBLIC bool drv8305_mailbox_client_get_status    (const drv8305_mailbox_t *mailbox, drv8305_snapshot_t *snapshot);
+
+/**
+ * @brief Pop oldest status change event (client)
+ * @param[in,out] mailbox Pointer to shared mailbox
+ * @param[out] event Destination of the event
+ * @return true if an event was returned, false if the ring is empty
+ */
+DRV8305_PUBLIC bool drv8305_mailbox_client_pop_event     (drv8305_mailbox_t *mailbox, drv8305_event_t *event);
+
+/**
+ * @brief Get number of events dropped because the ring was full (client)
+ * @param[in] mailbox Pointer to shared mailbox
+ * @return uint32_t Total dropped events
+ */
+DRV8305_PUBLIC uint32_t drv8305_mailbox_client_get_event_overflows(const drv8305_mailbox_t *mailbox);
+
+/**
+ * @brief Get the commit state of a posted configuration (client)
+ * @param[in] mailbox Pointer to shared mailbox
+ * @param[in] ticket Ticket drv8305_mailbox_client_post_command() returned for a SET_CONFIGURATION
+ * @return drv8305_commit_status_e State after the last server polling step, DRV8305_COMMIT_PENDING
+ *         while the server has not taken the command yet, DRV8305_COMMIT_IDLE if mailbox is NULL
+ * @note Valid until DRV8305_MAILBOX_COMMAND_DEPTH more commands have been posted
+ */
+DRV8305_PUBLIC drv8305_commit_status_e drv8305_mailbox_client_get_commit_status(const drv8305_mailbox_t *mailbox, uint32_t ticket);
+
+/**
+ * @brief Post a command to the server (client)
+ * @param[in,out] mailbox Pointer to shared mailbox
+ * @param[in] command Command to queue (copied)
+ * @param[out] ticket Ticket of the command for drv8305_mailbox_client_get_commit_status(), may be NULL
+ * @return true if queued, false if the command queue is full
+ */
+DRV8305_PUBLIC bool drv8305_mailbox_client_post_command  (drv8305_mailbox_t *mailbox, const drv8305_mailbox_command_t *command, uint32_t *ticket);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRV8305_MAILBOX_H_ */
@@ -0,0 +1,85 @@
+/**
+ * @file drv8305_postmortem.c
+ * @brief DRV8305 Post-Mortem - Fault Capture Preserved Across Reset Implementation
+ * @details Implements sealing and validation of the post-mortem record.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * This implementation file contains:
+ *   - CRC-32 coverage of the record (all words before the crc field)
+ *   - Seal, validity check and invalidation
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "drv8305_macros.h"
+#include "DRV8305_Utils/drv8305_crc.h"
+#include "drv8305_postmortem.h"
+
+/**@brief: The CRC covers the record as 16-bit words **/
+typedef char drv8305_postmortem_crc_alignment_check[((offsetof(drv8305_postmortem_record_t, crc) % sizeof(uint16_t)) == 0) ? 1 : -1];
+
+DRV8305_PRIVATE uint32_t drv8305_postmortem_crc(const drv8305_postmortem_record_t *record);
+
+/* -------------------------------- PUBLIC FUNCTIONS -------------------------------- */
+
+/**
+ * @brief Seal a filled record (implementation)
+ * @param[in,out] record Record to seal
+ * @return None
+ * @note Clear the record (memset) before filling it so padding is deterministic
+ */
+DRV8305_PUBLIC void drv8305_postmortem_seal(drv8305_postmortem_record_t *record)
+{
+    if(!record) { return; }
+
+    record->magic   = DRV8305_POSTMORTEM_MAGIC;
+    record->version = DRV8305_POSTMORTEM_VERSION;
+    record->crc     = drv8305_postmortem_crc(record);
+}
+
+/**
+ * @brief Check a record (implementation)
+ * @param[in] record Record to check
+ * @return true if marker, version and CRC match
+ */
+DRV8305_PUBLIC bool drv8305_postmortem_is_valid(const drv8305_postmortem_record_t *record)
+{
+    if(!record) { return false; }
+
+    if(record->magic != DRV8305_POSTMORTEM_MAGIC || record->version != DRV8305_POSTMORTEM_VERSION) { return false; }
+
+    if(record->event_count > (uint16_t)DRV8305_POSTMORTEM_EVENT_DEPTH) { return false; }
+
+    return record->crc == drv8305_postmortem_crc(record);
+}
+
+/**
+ * @brief Mark record empty (implementation)
+ * @param[out] record Record to invalidate
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_postmortem_invalidate(drv8305_postmortem_record_t *record)
+{
+    if(!record) { return; }
+
+    record->magic = 0;
+    record->crc   = 0;
+}
+
+/* -------------------------------- PRIVATE FUNCTIONS -------------------------------- */
+
+/**
+ * @brief CRC-32 of all record words before the crc field (internal)
+ * @param[in] record Record
+ * @return uint32_t CRC-32
+ */
+DRV8305_PRIVATE uint32_t drv8305_postmortem_crc(const drv8305_postmortem_record_t *record)
+{
+    return drv8305_crc32_words(DRV8305_CRC32_INIT, (const uint16_t *)record, (uint32_t)(offsetof(drv8305_postmortem_record_t, crc) / sizeof(uint16_t)));
+}
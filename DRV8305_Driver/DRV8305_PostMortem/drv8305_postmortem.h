@@ -0,0 +1,119 @@
+/**
+ * @file drv8305_postmortem.h
+ * @brief DRV8305 Post-Mortem - Fault Capture Preserved Across Reset Interface
+ * @details Declares the CRC-protected post-mortem record that freezes the driver state at
+ *          the first serious fault so it can be uploaded after the next boot.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * This module provides:
+ *   - drv8305_postmortem_record_t: register image, state machine states, confirmation flags,
+ *     pin states, recent status events and timestamps, sealed with CRC-32
+ *   - DRV8305_POSTMORTEM_DEFINE(): record definition with configurable placement
+ *   - Seal / validate / invalidate helpers
+ *
+ * @placement
+ * The record must live in RAM that the startup code does not clear, e.g. a no-init section:
+ *   GCC:    #define DRV8305_POSTMORTEM_PLACEMENT __attribute__((section(".noinit")))
+ *   TI CGT: #pragma DATA_SECTION(drv8305_postmortem, ".noinit") before the definition
+ * Without placement the record is ordinary zero-initialized data and only survives until
+ * the next reset (never reported as valid after boot).
+ *
+ * @freeze_policy
+ * The first capture freezes the record: later captures are ignored while a valid record is
+ * held, so the root cause is not overwritten by follow-up faults or a reset loop. Release
+ * the record after upload to re-arm the capture.
+ */
+
+#ifndef DRV8305_POSTMORTEM_H_
+#define DRV8305_POSTMORTEM_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "drv8305_macros.h"
+#include "DRV8305_Events/drv8305_event_ring.h"
+
+/** @brief Record marker of a sealed post-mortem record */
+#define DRV8305_POSTMORTEM_MAGIC    0x504DU
+/** @brief Layout version, increment when drv8305_postmortem_record_t changes */
+#define DRV8305_POSTMORTEM_VERSION  1U
+
+#ifndef DRV8305_POSTMORTEM_PLACEMENT
+#define DRV8305_POSTMORTEM_PLACEMENT
+#endif
+
+/** @brief Define a post-mortem record with the configured placement */
+#define DRV8305_POSTMORTEM_DEFINE(name)  DRV8305_POSTMORTEM_PLACEMENT drv8305_postmortem_record_t name
+
+/* Flags of drv8305_postmortem_record_t.flags */
+#define DRV8305_POSTMORTEM_FLAG_ENABLE_PIN    (1U << 0)   // EN_GATE high at capture
+#define DRV8305_POSTMORTEM_FLAG_WAKE_PIN      (1U << 1)   // DRV_WAKE high at capture
+#define DRV8305_POSTMORTEM_FLAG_CONFIRMED     (1U << 2)   // All control registers confirmed
+
+/**
+ * @brief Reason of a post-mortem capture
+ */
+typedef enum
+{
+    DRV8305_POSTMORTEM_REASON_APPLICATION,          // drv8305_api_postmortem_capture()
+    DRV8305_POSTMORTEM_REASON_PROTECTIVE_SHUTDOWN,  // Protective policy drove EN_GATE low
+    DRV8305_POSTMORTEM_REASON_RECOVERY_LATCHED,     // Fault recovery latched out
+} drv8305_postmortem_reason_e;
+
+typedef struct
+{
+    uint16_t        magic;               // DRV8305_POSTMORTEM_MAGIC when sealed
+    uint16_t        version;             // DRV8305_POSTMORTEM_VERSION
+    uint32_t        timestamp;           // Driver time of capture
+    uint32_t        shutdown_count;      // Protective shutdowns before capture
+    uint32_t        event_overflows;     // Dropped status events before capture
+    uint16_t        reason;              // drv8305_postmortem_reason_e
+    uint16_t        flags;               // DRV8305_POSTMORTEM_FLAG_xxx
+    uint16_t        confirmation_flags;  // Bit n = control register n confirmed (0x05 ... 0x0C order)
+    uint16_t        main_state;          // drv8305_sm_state_e
+    uint16_t        next_main_state;
+    uint16_t        status_state;        // drv8305_status_sm_state_e
+    uint16_t        control_state;       // drv8305_control_sm_state_e
+    uint16_t        recovery_state;      // drv8305_recovery_sm_state_e
+    uint16_t        recovery_status;     // drv8305_recovery_status_e
+    uint16_t        recovery_attempts;
+    uint16_t        registers[DRV8305_NUMBER_OF_REGISTERS];  // register_manager[] frames
+    uint16_t        event_count;         // Valid entries in events[]
+    drv8305_event_t events[DRV8305_POSTMORTEM_EVENT_DEPTH];  // Most recent status events, oldest first
+    uint32_t        crc;                 // CRC-32 of all words before this field
+} drv8305_postmortem_record_t;
+
+/**
+ * @brief Set marker and version and compute the CRC of a filled record
+ * @param[in,out] record Record to seal
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_postmortem_seal        (drv8305_postmortem_record_t *record);
+
+/**
+ * @brief Check marker, version and CRC of a record
+ * @param[in] record Record to check
+ * @return true if the record holds a sealed capture
+ */
+DRV8305_PUBLIC bool drv8305_postmortem_is_valid    (const drv8305_postmortem_record_t *record);
+
+/**
+ * @brief Mark a record as empty
+ * @param[out] record Record to invalidate
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_postmortem_invalidate  (drv8305_postmortem_record_t *record);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRV8305_POSTMORTEM_H_ */
@@ -0,0 +1,129 @@
+/**
+ * @file drv8305_snapshot.c
+ * @brief DRV8305 Register Snapshot - Lock-Free Publication Implementation
+ * @details Implements the double-buffered seqlock used to publish the register image
+ *          from the polling context to readers in higher-priority contexts.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * This implementation file contains:
+ *   - Publisher reset
+ *   - Writer: fill inactive buffer under its sequence counter, then flip published index
+ *   - Reader: bounded retry copy validated against the buffer sequence counter
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "drv8305_macros.h"
+#include "drv8305_snapshot.h"
+
+/* -------------------------------- PUBLIC FUNCTIONS -------------------------------- */
+
+/**
+ * @brief Reset snapshot publisher (implementation)
+ * @param[out] publisher Pointer to snapshot publisher
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_snapshot_init(drv8305_snapshot_publisher_t *publisher)
+{
+    if(!publisher) { return; }
+
+    for(int buffer = 0; buffer < 2; buffer++)
+    {
+        DRV8305_SHARED_STORE_RELAXED(publisher->buffers[buffer].lock_sequence, 0U);
+        DRV8305_SHARED_STORE_RELAXED(publisher->buffers[buffer].sequence,      0U);
+        DRV8305_SHARED_STORE_RELAXED(publisher->buffers[buffer].timestamp,     0U);
+
+        for(int index = 0; index < DRV8305_NUMBER_OF_REGISTERS; index++)
+        {
+            DRV8305_SHARED_STORE_RELAXED(publisher->buffers[buffer].registers[index], 0U);
+        }
+    }
+
+    DRV8305_SHARED_STORE(publisher->published_index, 0U);
+    publisher->publication_count = 0;
+}
+
+/**
+ * @brief Publish register image into the inactive buffer (implementation)
+ * @details The buffer sequence is made odd before and even after the payload update,
+ *          and the published index is switched only once the buffer is complete. The
+ *          release fence after the odd increment keeps a reader that sees any new payload
+ *          word from missing the odd sequence on its re-check.
+ * @param[in,out] publisher Pointer to snapshot publisher
+ * @param[in] registers Register image (DRV8305_NUMBER_OF_REGISTERS entries)
+ * @param[in] timestamp Driver time of the publication
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_snapshot_publish(drv8305_snapshot_publisher_t *publisher, const uint16_t *registers, uint32_t timestamp)
+{
+    if(!publisher || !registers) { return; }
+
+    uint32_t                   target = DRV8305_SHARED_LOAD_RELAXED(publisher->published_index) ^ 1U;
+    drv8305_snapshot_buffer_t *buffer = &publisher->buffers[target];
+    uint32_t                   lock   = DRV8305_SHARED_LOAD_RELAXED(buffer->lock_sequence);
+
+    DRV8305_SHARED_STORE_RELAXED(buffer->lock_sequence, lock + 1U);
+    DRV8305_RELEASE_FENCE();
+
+    DRV8305_SHARED_STORE_RELAXED(buffer->sequence,  ++publisher->publication_count);
+    DRV8305_SHARED_STORE_RELAXED(buffer->timestamp, timestamp);
+
+    for(int index = 0; index < DRV8305_NUMBER_OF_REGISTERS; index++)
+    {
+        DRV8305_SHARED_STORE_RELAXED(buffer->registers[index], registers[index]);
+    }
+
+    DRV8305_RELEASE_FENCE();
+    DRV8305_SHARED_STORE(buffer->lock_sequence, lock + 2U);
+
+    DRV8305_RELEASE_FENCE();
+    DRV8305_SHARED_STORE(publisher->published_index, target);
+}
+
+/**
+ * @brief Copy latest complete register image (implementation)
+ * @details Each attempt samples the published index and its buffer sequence, copies the
+ *          payload and re-checks the sequence. A changed or odd sequence means the copy
+ *          overlapped a publication and is discarded. The published index is re-checked as
+ *          well: a writer preempted between completing a buffer and switching the index
+ *          leaves a complete but unpublished image, and accepting it would let the next
+ *          read return an older sequence.
+ * @param[in] publisher Pointer to snapshot publisher
+ * @param[out] snapshot Destination of the coherent copy
+ * @return true on coherent copy, false if all attempts raced with the writer
+ */
+DRV8305_PUBLIC bool drv8305_snapshot_read(const drv8305_snapshot_publisher_t *publisher, drv8305_snapshot_t *snapshot)
+{
+    if(!publisher || !snapshot) { return false; }
+
+    for(int attempt = 0; attempt < DRV8305_SNAPSHOT_READ_ATTEMPTS; attempt++)
+    {
+        uint32_t                         source = DRV8305_SHARED_LOAD(publisher->published_index);
+        const drv8305_snapshot_buffer_t *buffer = &publisher->buffers[source & 1U];
+
+        DRV8305_ACQUIRE_FENCE();
+        uint32_t begin_sequence = DRV8305_SHARED_LOAD(buffer->lock_sequence);
+        if(begin_sequence & 1U) { continue; }
+        DRV8305_ACQUIRE_FENCE();
+
+        snapshot->sequence  = DRV8305_SHARED_LOAD_RELAXED(buffer->sequence);
+        snapshot->timestamp = DRV8305_SHARED_LOAD_RELAXED(buffer->timestamp);
+
+        for(int index = 0; index < DRV8305_NUMBER_OF_REGISTERS; index++)
+        {
+            snapshot->registers[index] = DRV8305_SHARED_LOAD_RELAXED(buffer->registers[index]);
+        }
+
+        /* Orders the payload loads before the re-check: a new payload word implies a new sequence */
+        DRV8305_ACQUIRE_FENCE();
+        if(DRV8305_SHARED_LOAD_RELAXED(buffer->lock_sequence) == begin_sequence &&
+           DRV8305_SHARED_LOAD_RELAXED(publisher->published_index) == source) { return true; }
+    }
+
+    return false;
+}
@@ -0,0 +1,109 @@
+/**
+ * @file drv8305_snapshot.h
+ * @brief DRV8305 Register Snapshot - Lock-Free Publication Interface
+ * @details Declares the double-buffered, sequence-counted register snapshot used to
+ *          hand a coherent copy of all 11 registers to readers running in other
+ *          execution contexts (ISRs, RTOS tasks) without disabling interrupts.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * This module provides:
+ *   - drv8305_snapshot_t: coherent register image with sequence number and timestamp
+ *   - drv8305_snapshot_publisher_t: two seqlock-protected buffers plus a published index
+ *   - Writer function (never blocks) and bounded-retry reader function
+ *
+ * @concurrency_model
+ * Single writer (the context calling drv8305_api_master_sm_polling()), any number of readers.
+ *   - The writer always fills the buffer that is NOT currently published, so a reader that
+ *     preempts the writer copies the previous complete image without waiting.
+ *   - Each buffer carries its own sequence counter (odd while being written). A reader that is
+ *     itself preempted by two consecutive publications detects the change and retries.
+ *   - A copy is only accepted while its buffer is still the published one, so successive reads
+ *     never return an older sequence.
+ *   - Counters and payload are shared words (drv8305_macros.h). Built as C11 they are atomics:
+ *     the payload is copied with relaxed accesses between a release fence after the odd
+ *     increment and an acquire fence before the re-check, so the seqlock has no data race.
+ *     Other builds use volatile words ordered by DRV8305_MEMORY_BARRIER().
+ */
+
+#ifndef DRV8305_SNAPSHOT_H_
+#define DRV8305_SNAPSHOT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "drv8305_macros.h"
+
+/**
+ * @brief Coherent copy of the DRV8305 register image
+ * @note registers[] uses the register_manager[] indexing (DRV8305_xxx_ARRAY_INDEX)
+ */
+typedef struct
+{
+    uint32_t sequence;                                // Publication number (0 = nothing published yet)
+    uint32_t timestamp;                               // Driver time (drv8305_api_timer ticks) of publication
+    uint16_t registers[DRV8305_NUMBER_OF_REGISTERS];  // Raw register frames
+} drv8305_snapshot_t;
+
+/**
+ * @brief One seqlock-protected snapshot buffer
+ * @note The payload mirrors drv8305_snapshot_t word by word
+ */
+typedef struct
+{
+    drv8305_shared_u32_t lock_sequence;                          // Odd while the writer is filling this buffer
+    drv8305_shared_u32_t sequence;
+    drv8305_shared_u32_t timestamp;
+    drv8305_shared_u16_t registers[DRV8305_NUMBER_OF_REGISTERS];
+} drv8305_snapshot_buffer_t;
+
+/**
+ * @brief Double-buffered snapshot publisher (one per driver instance)
+ */
+typedef struct
+{
+    drv8305_snapshot_buffer_t buffers[2];
+    drv8305_shared_u32_t      published_index;    // Buffer holding the latest complete snapshot
+    uint32_t                  publication_count;  // Writer-private publication counter
+} drv8305_snapshot_publisher_t;
+
+/**
+ * @brief Reset publisher to the "nothing published" state
+ * @param[out] publisher Pointer to snapshot publisher
+ * @return None
+ * @note Must not run concurrently with readers
+ */
+DRV8305_PUBLIC void drv8305_snapshot_init    (drv8305_snapshot_publisher_t *publisher);
+
+/**
+ * @brief Publish a new register image (writer side, never blocks)
+ * @param[in,out] publisher Pointer to snapshot publisher
+ * @param[in] registers Register image with DRV8305_NUMBER_OF_REGISTERS entries
+ * @param[in] timestamp Driver time of the publication
+ * @return None
+ * @note Only one context may publish into a given publisher
+ */
+DRV8305_PUBLIC void drv8305_snapshot_publish (drv8305_snapshot_publisher_t *publisher, const uint16_t *registers, uint32_t timestamp);
+
+/**
+ * @brief Copy the latest complete register image (reader side, any context)
+ * @param[in] publisher Pointer to snapshot publisher
+ * @param[out] snapshot Destination of the coherent copy
+ * @return true if a coherent copy was taken, false if every attempt raced with the writer
+ * @note Performs at most DRV8305_SNAPSHOT_READ_ATTEMPTS copies; snapshot->sequence is 0
+ *       until the first publication
+ */
+DRV8305_PUBLIC bool drv8305_snapshot_read    (const drv8305_snapshot_publisher_t *publisher, drv8305_snapshot_t *snapshot);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRV8305_SNAPSHOT_H_ */
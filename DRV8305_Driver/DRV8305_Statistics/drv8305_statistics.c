@@ -0,0 +1,150 @@
+/**
+ * @file drv8305_statistics.c
+ * @brief DRV8305 Status Statistics - Per-Bit Counters and Durations Implementation
+ * @details Implements the incremental per-bit statistics fed from the status scan.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * This implementation file contains:
+ *   - Reset of all counters
+ *   - Incremental update from raised/cleared masks
+ *   - Export with running durations of active bits
+ */
+
+#include <stdint.h>
+
+#include "drv8305_macros.h"
+#include "DRV8305_Status_Registers/drv8305_status_registers_decoder.h"
+#include "drv8305_statistics.h"
+
+/* -------------------------------- FUNCTION PROTOTYPES -------------------------------- */
+DRV8305_PRIVATE uint32_t drv8305_statistics_add_saturated (uint32_t value, uint32_t addend);
+DRV8305_PRIVATE void     drv8305_statistics_close_interval(drv8305_status_bit_statistics_t *bit, uint32_t duration);
+
+/* -------------------------------- PUBLIC FUNCTIONS -------------------------------- */
+
+/**
+ * @brief Clear all counters and durations (implementation)
+ * @param[out] statistics Pointer to statistics
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_statistics_reset(drv8305_statistics_t *statistics)
+{
+    if(!statistics) { return; }
+
+    for(int index = 0; index < DRV8305_NUMBER_OF_STATUS_REGISTERS; index++)
+    {
+        statistics->active[index] = 0;
+
+        for(int bit = 0; bit < DRV8305_STATUS_BITS_PER_REGISTER; bit++)
+        {
+            statistics->active_since[index][bit]     = 0;
+            statistics->bits[index][bit].occurrences = 0;
+            statistics->bits[index][bit].total_time  = 0;
+            statistics->bits[index][bit].max_time    = 0;
+        }
+    }
+}
+
+/**
+ * @brief Account one status register change (implementation)
+ * @details Cleared bits close their active interval, raised bits open a new one and count
+ *          an occurrence. Only the changed bits are visited.
+ * @param[in,out] statistics Pointer to statistics
+ * @param[in] status_index Status register index (0-3)
+ * @param[in] raised Bits that changed 0 -> 1
+ * @param[in] cleared Bits that changed 1 -> 0
+ * @param[in] now Driver time of the scan
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_statistics_update(drv8305_statistics_t *statistics, uint16_t status_index, uint16_t raised, uint16_t cleared, uint32_t now)
+{
+    if(!statistics || status_index >= DRV8305_NUMBER_OF_STATUS_REGISTERS) { return; }
+
+    uint16_t closing = cleared & statistics->active[status_index] & DRV8305_REGISTER_DATA_MASK;
+    uint16_t opening = raised  & (uint16_t)~statistics->active[status_index] & DRV8305_REGISTER_DATA_MASK;
+
+    while(closing != 0)
+    {
+        uint16_t bit = DRV8305_CTZ16(closing);
+
+        drv8305_statistics_close_interval(&statistics->bits[status_index][bit], now - statistics->active_since[status_index][bit]);
+
+        closing &= (uint16_t)(closing - 1U);
+    }
+
+    while(opening != 0)
+    {
+        uint16_t bit = DRV8305_CTZ16(opening);
+
+        statistics->active_since[status_index][bit]     = now;
+        statistics->bits[status_index][bit].occurrences = drv8305_statistics_add_saturated(statistics->bits[status_index][bit].occurrences, 1);
+
+        opening &= (uint16_t)(opening - 1U);
+    }
+
+    statistics->active[status_index] = (uint16_t)((statistics->active[status_index] & ~cleared) | raised) & DRV8305_REGISTER_DATA_MASK;
+}
+
+/**
+ * @brief Copy statistics into an export image (implementation)
+ * @param[in] statistics Pointer to statistics
+ * @param[in] now Driver time of the export
+ * @param[out] image Destination export image
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_statistics_export(const drv8305_statistics_t *statistics, uint32_t now, drv8305_statistics_export_t *image)
+{
+    if(!statistics || !image) { return; }
+
+    image->timestamp = now;
+
+    for(int index = 0; index < DRV8305_NUMBER_OF_STATUS_REGISTERS; index++)
+    {
+        image->active[index] = statistics->active[index];
+
+        for(int bit = 0; bit < DRV8305_STATUS_BITS_PER_REGISTER; bit++)
+        {
+            image->bits[index][bit] = statistics->bits[index][bit];
+
+            if(statistics->active[index] & (1U << bit))
+            {
+                drv8305_statistics_close_interval(&image->bits[index][bit], now - statistics->active_since[index][bit]);
+            }
+        }
+    }
+}
+
+/* -------------------------------- PRIVATE FUNCTIONS -------------------------------- */
+
+/**
+ * @brief Saturating 32-bit addition (internal)
+ * @param[in] value Current value
+ * @param[in] addend Value to add
+ * @return uint32_t Sum, clamped to 0xFFFFFFFF
+ */
+DRV8305_PRIVATE uint32_t drv8305_statistics_add_saturated(uint32_t value, uint32_t addend)
+{
+    uint32_t sum = value + addend;
+
+    return (sum < value) ? 0xFFFFFFFFUL : sum;
+}
+
+/**
+ * @brief Fold one finished active interval into a bit's durations (internal)
+ * @param[in,out] bit Statistics of the bit
+ * @param[in] duration Length of the interval (ticks)
+ * @return None
+ */
+DRV8305_PRIVATE void drv8305_statistics_close_interval(drv8305_status_bit_statistics_t *bit, uint32_t duration)
+{
+    bit->total_time = drv8305_statistics_add_saturated(bit->total_time, duration);
+
+    if(duration > bit->max_time)
+    {
+        bit->max_time = duration;
+    }
+}
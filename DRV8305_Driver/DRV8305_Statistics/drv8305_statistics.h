@@ -0,0 +1,98 @@
+/**
+ * @file drv8305_statistics.h
+ * @brief DRV8305 Status Statistics - Per-Bit Counters and Durations Interface
+ * @details Declares the per-bit occurrence counters, cumulative active time and longest
+ *          continuous active time for the 44 status bits of registers 0x01 - 0x04.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * This module provides fleet diagnostic data (e.g. how often DRV8305_VDS_HA fired, how long
+ * DRV8305_WARN_TEMP_FLAG2 was active):
+ *   - drv8305_statistics_update(): fed with the raised/cleared masks of the status scan
+ *   - drv8305_statistics_export(): self-contained copy including bits that are still active
+ *   - drv8305_statistics_reset(): clear all counters
+ *
+ * @update_cost
+ * Nothing is done for a scan without changes. Otherwise the cost is one short loop per
+ * raised or cleared bit (count-trailing-zeros walk), independent of how long bits stay set.
+ *
+ * @time_base
+ * Durations are in drv8305_api_timer() ticks and saturate instead of wrapping.
+ */
+
+#ifndef DRV8305_STATISTICS_H_
+#define DRV8305_STATISTICS_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#include "drv8305_macros.h"
+#include "DRV8305_Status_Registers/drv8305_status_registers_decoder.h"
+
+/**
+ * @brief Statistics of one status bit
+ */
+typedef struct
+{
+    uint32_t occurrences;   // Number of 0 -> 1 transitions
+    uint32_t total_time;    // Cumulative active time (ticks)
+    uint32_t max_time;      // Longest continuous active time (ticks)
+} drv8305_status_bit_statistics_t;
+
+/**
+ * @brief Exported statistics image, [status_index][bit]
+ */
+typedef struct
+{
+    uint32_t                        timestamp;  // Driver time of the export
+    uint16_t                        active[DRV8305_NUMBER_OF_STATUS_REGISTERS];
+    drv8305_status_bit_statistics_t bits[DRV8305_NUMBER_OF_STATUS_REGISTERS][DRV8305_STATUS_BITS_PER_REGISTER];
+} drv8305_statistics_export_t;
+
+typedef struct
+{
+    uint16_t                        active[DRV8305_NUMBER_OF_STATUS_REGISTERS];  // Bits currently set
+    uint32_t                        active_since[DRV8305_NUMBER_OF_STATUS_REGISTERS][DRV8305_STATUS_BITS_PER_REGISTER];
+    drv8305_status_bit_statistics_t bits[DRV8305_NUMBER_OF_STATUS_REGISTERS][DRV8305_STATUS_BITS_PER_REGISTER];
+} drv8305_statistics_t;
+
+/**
+ * @brief Clear all counters and durations
+ * @param[out] statistics Pointer to statistics
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_statistics_reset  (drv8305_statistics_t *statistics);
+
+/**
+ * @brief Account one status register change
+ * @param[in,out] statistics Pointer to statistics
+ * @param[in] status_index Status register index (0-3)
+ * @param[in] raised Bits that changed 0 -> 1
+ * @param[in] cleared Bits that changed 1 -> 0
+ * @param[in] now Driver time of the scan
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_statistics_update (drv8305_statistics_t *statistics, uint16_t status_index, uint16_t raised, uint16_t cleared, uint32_t now);
+
+/**
+ * @brief Copy statistics into an export image
+ * @details Bits still active at 'now' contribute their running duration to total_time and
+ *          max_time of the export; the internal counters are not modified.
+ * @param[in] statistics Pointer to statistics
+ * @param[in] now Driver time of the export
+ * @param[out] image Destination export image
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_statistics_export (const drv8305_statistics_t *statistics, uint32_t now, drv8305_statistics_export_t *image);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRV8305_STATISTICS_H_ */
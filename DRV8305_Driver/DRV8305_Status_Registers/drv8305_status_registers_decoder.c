@@ -0,0 +1,218 @@
+/**
+ * @file drv8305_status_registers_decoder.c
+ * @brief DRV8305 Status Register Decoder - Table-Driven Implementation
+ * @details Defines the constant status bit descriptor tables and the set-bit decoder.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * This implementation file contains:
+ *   - Descriptor tables for registers 0x01-0x04 (default severity and action per bit)
+ *   - Decoder walking only set bits using count-trailing-zeros
+ *   - Portable count-trailing-zeros fallback
+ *
+ * @default_actions
+ * Follow the fault response strategy of drv8305_status_registers_handlers.c:
+ *   - Temperature warnings: Decrease motor performance
+ *   - Supply warnings/faults (PVDD, VCPH, AVDD, VREG): Stop the motor
+ *   - VDS/VGS and sense overcurrent faults: Stop the motor immediately
+ *   - Watchdog fault: Log for diagnostics
+ *
+ * @datasheet_reference
+ * DRV8305-Q1 Status Registers (Pages 38-39, Table 10-13)
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "drv8305_macros.h"
+#include "drv8305_status_registers_definitions.h"
+#include "drv8305_status_registers_decoder.h"
+
+/**
+ * @brief Status bit lists, X(bit, bit_mask, severity, phase, mosfet, action) per bit
+ * @details The bit number is written out so the table is checked against the bit macros at
+ *          compile time: mask == 1U << bit, and every bit 10:0 exactly once.
+ */
+
+/* Register 0x01: Warning & Watchdog Reset */
+#define DRV8305_STATUS_01_BITS(X) \
+    X( 0, DRV8305_WARN_OTW,        DRV8305_SEVERITY_WARNING, DRV8305_PHASE_NONE, DRV8305_MOSFET_NONE, DRV8305_ACTION_DERATE)     \
+    X( 1, DRV8305_WARN_TEMP_FLAG3, DRV8305_SEVERITY_WARNING, DRV8305_PHASE_NONE, DRV8305_MOSFET_NONE, DRV8305_ACTION_DERATE)     \
+    X( 2, DRV8305_WARN_TEMP_FLAG2, DRV8305_SEVERITY_INFO,    DRV8305_PHASE_NONE, DRV8305_MOSFET_NONE, DRV8305_ACTION_LOG)        \
+    X( 3, DRV8305_WARN_TEMP_FLAG1, DRV8305_SEVERITY_INFO,    DRV8305_PHASE_NONE, DRV8305_MOSFET_NONE, DRV8305_ACTION_LOG)        \
+    X( 4, DRV8305_WARN_VCPH_UVFL,  DRV8305_SEVERITY_WARNING, DRV8305_PHASE_NONE, DRV8305_MOSFET_NONE, DRV8305_ACTION_STOP_MOTOR) \
+    X( 5, DRV8305_WARN_VDS_STATUS, DRV8305_SEVERITY_WARNING, DRV8305_PHASE_NONE, DRV8305_MOSFET_NONE, DRV8305_ACTION_LOG)        \
+    X( 6, DRV8305_WARN_PVDD_OVFL,  DRV8305_SEVERITY_WARNING, DRV8305_PHASE_NONE, DRV8305_MOSFET_NONE, DRV8305_ACTION_STOP_MOTOR) \
+    X( 7, DRV8305_WARN_PVDD_UVFL,  DRV8305_SEVERITY_WARNING, DRV8305_PHASE_NONE, DRV8305_MOSFET_NONE, DRV8305_ACTION_STOP_MOTOR) \
+    X( 8, DRV8305_WARN_TEMP_FLAG4, DRV8305_SEVERITY_WARNING, DRV8305_PHASE_NONE, DRV8305_MOSFET_NONE, DRV8305_ACTION_DERATE)     \
+    X( 9, DRV8305_WARN_RSVD,       DRV8305_SEVERITY_NONE,    DRV8305_PHASE_NONE, DRV8305_MOSFET_NONE, DRV8305_ACTION_NONE)       \
+    X(10, DRV8305_WARN_FAULT,      DRV8305_SEVERITY_FAULT,   DRV8305_PHASE_NONE, DRV8305_MOSFET_NONE, DRV8305_ACTION_NONE)
+
+/* Register 0x02: OV/VDS Faults */
+#define DRV8305_STATUS_02_BITS(X) \
+    X( 0, DRV8305_VDS_SNS_A_OCP, DRV8305_SEVERITY_CRITICAL, DRV8305_PHASE_A,    DRV8305_MOSFET_NONE,      DRV8305_ACTION_STOP_MOTOR) \
+    X( 1, DRV8305_VDS_SNS_B_OCP, DRV8305_SEVERITY_CRITICAL, DRV8305_PHASE_B,    DRV8305_MOSFET_NONE,      DRV8305_ACTION_STOP_MOTOR) \
+    X( 2, DRV8305_VDS_SNS_C_OCP, DRV8305_SEVERITY_CRITICAL, DRV8305_PHASE_C,    DRV8305_MOSFET_NONE,      DRV8305_ACTION_STOP_MOTOR) \
+    X( 3, DRV8305_VDS_RSVD_3,    DRV8305_SEVERITY_NONE,     DRV8305_PHASE_NONE, DRV8305_MOSFET_NONE,      DRV8305_ACTION_NONE)       \
+    X( 4, DRV8305_VDS_RSVD_4,    DRV8305_SEVERITY_NONE,     DRV8305_PHASE_NONE, DRV8305_MOSFET_NONE,      DRV8305_ACTION_NONE)       \
+    X( 5, DRV8305_VDS_LC,        DRV8305_SEVERITY_CRITICAL, DRV8305_PHASE_C,    DRV8305_MOSFET_LOW_SIDE,  DRV8305_ACTION_STOP_MOTOR) \
+    X( 6, DRV8305_VDS_HC,        DRV8305_SEVERITY_CRITICAL, DRV8305_PHASE_C,    DRV8305_MOSFET_HIGH_SIDE, DRV8305_ACTION_STOP_MOTOR) \
+    X( 7, DRV8305_VDS_LB,        DRV8305_SEVERITY_CRITICAL, DRV8305_PHASE_B,    DRV8305_MOSFET_LOW_SIDE,  DRV8305_ACTION_STOP_MOTOR) \
+    X( 8, DRV8305_VDS_HB,        DRV8305_SEVERITY_CRITICAL, DRV8305_PHASE_B,    DRV8305_MOSFET_HIGH_SIDE, DRV8305_ACTION_STOP_MOTOR) \
+    X( 9, DRV8305_VDS_LA,        DRV8305_SEVERITY_CRITICAL, DRV8305_PHASE_A,    DRV8305_MOSFET_LOW_SIDE,  DRV8305_ACTION_STOP_MOTOR) \
+    X(10, DRV8305_VDS_HA,        DRV8305_SEVERITY_CRITICAL, DRV8305_PHASE_A,    DRV8305_MOSFET_HIGH_SIDE, DRV8305_ACTION_STOP_MOTOR)
+
+/* Register 0x03: IC Faults */
+#define DRV8305_STATUS_03_BITS(X) \
+    X( 0, DRV8305_IC_VCPH_OVLO_ABS, DRV8305_SEVERITY_FAULT,    DRV8305_PHASE_NONE, DRV8305_MOSFET_NONE, DRV8305_ACTION_STOP_MOTOR) \
+    X( 1, DRV8305_IC_VCPH_OVLO,     DRV8305_SEVERITY_FAULT,    DRV8305_PHASE_NONE, DRV8305_MOSFET_NONE, DRV8305_ACTION_STOP_MOTOR) \
+    X( 2, DRV8305_IC_VCPH_UVLO2,    DRV8305_SEVERITY_FAULT,    DRV8305_PHASE_NONE, DRV8305_MOSFET_NONE, DRV8305_ACTION_STOP_MOTOR) \
+    X( 3, DRV8305_IC_RSVD_3,        DRV8305_SEVERITY_NONE,     DRV8305_PHASE_NONE, DRV8305_MOSFET_NONE, DRV8305_ACTION_NONE)       \
+    X( 4, DRV8305_IC_VCP_LSD_UVLO2, DRV8305_SEVERITY_FAULT,    DRV8305_PHASE_NONE, DRV8305_MOSFET_NONE, DRV8305_ACTION_STOP_MOTOR) \
+    X( 5, DRV8305_IC_AVDD_UVLO,     DRV8305_SEVERITY_FAULT,    DRV8305_PHASE_NONE, DRV8305_MOSFET_NONE, DRV8305_ACTION_STOP_MOTOR) \
+    X( 6, DRV8305_IC_VREG_UV,       DRV8305_SEVERITY_FAULT,    DRV8305_PHASE_NONE, DRV8305_MOSFET_NONE, DRV8305_ACTION_STOP_MOTOR) \
+    X( 7, DRV8305_IC_RSVD_7,        DRV8305_SEVERITY_NONE,     DRV8305_PHASE_NONE, DRV8305_MOSFET_NONE, DRV8305_ACTION_NONE)       \
+    X( 8, DRV8305_IC_OTSD,          DRV8305_SEVERITY_CRITICAL, DRV8305_PHASE_NONE, DRV8305_MOSFET_NONE, DRV8305_ACTION_STOP_MOTOR) \
+    X( 9, DRV8305_IC_WD_FAULT,      DRV8305_SEVERITY_FAULT,    DRV8305_PHASE_NONE, DRV8305_MOSFET_NONE, DRV8305_ACTION_LOG)        \
+    X(10, DRV8305_IC_PVDD_UVLO2,    DRV8305_SEVERITY_FAULT,    DRV8305_PHASE_NONE, DRV8305_MOSFET_NONE, DRV8305_ACTION_STOP_MOTOR)
+
+/* Register 0x04: VGS Faults */
+#define DRV8305_STATUS_04_BITS(X) \
+    X( 0, DRV8305_VGS_RSVD_0, DRV8305_SEVERITY_NONE,     DRV8305_PHASE_NONE, DRV8305_MOSFET_NONE,      DRV8305_ACTION_NONE)       \
+    X( 1, DRV8305_VGS_RSVD_1, DRV8305_SEVERITY_NONE,     DRV8305_PHASE_NONE, DRV8305_MOSFET_NONE,      DRV8305_ACTION_NONE)       \
+    X( 2, DRV8305_VGS_RSVD_2, DRV8305_SEVERITY_NONE,     DRV8305_PHASE_NONE, DRV8305_MOSFET_NONE,      DRV8305_ACTION_NONE)       \
+    X( 3, DRV8305_VGS_RSVD_3, DRV8305_SEVERITY_NONE,     DRV8305_PHASE_NONE, DRV8305_MOSFET_NONE,      DRV8305_ACTION_NONE)       \
+    X( 4, DRV8305_VGS_RSVD_4, DRV8305_SEVERITY_NONE,     DRV8305_PHASE_NONE, DRV8305_MOSFET_NONE,      DRV8305_ACTION_NONE)       \
+    X( 5, DRV8305_VGS_LC,     DRV8305_SEVERITY_CRITICAL, DRV8305_PHASE_C,    DRV8305_MOSFET_LOW_SIDE,  DRV8305_ACTION_STOP_MOTOR) \
+    X( 6, DRV8305_VGS_HC,     DRV8305_SEVERITY_CRITICAL, DRV8305_PHASE_C,    DRV8305_MOSFET_HIGH_SIDE, DRV8305_ACTION_STOP_MOTOR) \
+    X( 7, DRV8305_VGS_LB,     DRV8305_SEVERITY_CRITICAL, DRV8305_PHASE_B,    DRV8305_MOSFET_LOW_SIDE,  DRV8305_ACTION_STOP_MOTOR) \
+    X( 8, DRV8305_VGS_HB,     DRV8305_SEVERITY_CRITICAL, DRV8305_PHASE_B,    DRV8305_MOSFET_HIGH_SIDE, DRV8305_ACTION_STOP_MOTOR) \
+    X( 9, DRV8305_VGS_LA,     DRV8305_SEVERITY_CRITICAL, DRV8305_PHASE_A,    DRV8305_MOSFET_LOW_SIDE,  DRV8305_ACTION_STOP_MOTOR) \
+    X(10, DRV8305_VGS_HA,     DRV8305_SEVERITY_CRITICAL, DRV8305_PHASE_A,    DRV8305_MOSFET_HIGH_SIDE, DRV8305_ACTION_STOP_MOTOR)
+
+/**@brief: Descriptor entry, name is taken from the bit macro **/
+#define DRV8305_STATUS_BIT(bit, bit_mask, severity, phase, mosfet, action)        [bit] = { (uint16_t)(bit_mask), #bit_mask, severity, phase, mosfet, action },
+
+/**@brief: Descriptor [reg][n] must carry mask 1U << n **/
+#define DRV8305_STATUS_BIT_CHECK(bit, bit_mask, severity, phase, mosfet, action)  typedef char drv8305_status_bit_check_##bit_mask[((bit_mask) == (1U << (bit))) ? 1 : -1];
+
+/**@brief: Eleven single-bit masks add up to 0x7FF only if each bit occurs once **/
+#define DRV8305_STATUS_BIT_SUM(bit, bit_mask, severity, phase, mosfet, action)    + (bit_mask)
+
+DRV8305_STATUS_01_BITS(DRV8305_STATUS_BIT_CHECK)
+DRV8305_STATUS_02_BITS(DRV8305_STATUS_BIT_CHECK)
+DRV8305_STATUS_03_BITS(DRV8305_STATUS_BIT_CHECK)
+DRV8305_STATUS_04_BITS(DRV8305_STATUS_BIT_CHECK)
+
+typedef char drv8305_status_01_bits_check[((0U DRV8305_STATUS_01_BITS(DRV8305_STATUS_BIT_SUM)) == DRV8305_REGISTER_DATA_MASK) ? 1 : -1];
+typedef char drv8305_status_02_bits_check[((0U DRV8305_STATUS_02_BITS(DRV8305_STATUS_BIT_SUM)) == DRV8305_REGISTER_DATA_MASK) ? 1 : -1];
+typedef char drv8305_status_03_bits_check[((0U DRV8305_STATUS_03_BITS(DRV8305_STATUS_BIT_SUM)) == DRV8305_REGISTER_DATA_MASK) ? 1 : -1];
+typedef char drv8305_status_04_bits_check[((0U DRV8305_STATUS_04_BITS(DRV8305_STATUS_BIT_SUM)) == DRV8305_REGISTER_DATA_MASK) ? 1 : -1];
+
+/* --------------------------- STATUS BIT DESCRIPTOR TABLES --------------------------- */
+
+DRV8305_PUBLIC const drv8305_status_bit_descriptor_t drv8305_status_descriptors[DRV8305_NUMBER_OF_STATUS_REGISTERS][DRV8305_STATUS_BITS_PER_REGISTER] =
+{
+    { DRV8305_STATUS_01_BITS(DRV8305_STATUS_BIT) },
+    { DRV8305_STATUS_02_BITS(DRV8305_STATUS_BIT) },
+    { DRV8305_STATUS_03_BITS(DRV8305_STATUS_BIT) },
+    { DRV8305_STATUS_04_BITS(DRV8305_STATUS_BIT) }
+};
+
+/* -------------------------------- PUBLIC FUNCTIONS -------------------------------- */
+
+/**
+ * @brief Decode status word visiting only set bits (implementation)
+ * @details Clears the lowest set bit on every iteration (bits &= bits - 1), so the loop
+ *          runs once per set bit; a clean word returns after a single compare.
+ * @param[in] self User context forwarded to the visitor
+ * @param[in] status_index Status register index (0-3)
+ * @param[in] data Raw status frame
+ * @param[in] visitor Set-bit visitor (may be NULL)
+ * @return uint16_t Bitmask of actions found
+ */
+DRV8305_PUBLIC uint16_t drv8305_status_register_decode(void *self, uint16_t status_index, uint16_t data, drv8305_status_bit_visitor_t visitor)
+{
+    uint16_t bits    = data & DRV8305_REGISTER_DATA_MASK;
+    uint16_t actions = 0;
+
+    if(bits == 0 || status_index >= (uint16_t)DRV8305_NUMBER_OF_STATUS_REGISTERS) { return 0; }
+
+    const drv8305_status_bit_descriptor_t *table = drv8305_status_descriptors[status_index];
+
+    do
+    {
+        const drv8305_status_bit_descriptor_t *descriptor = &table[DRV8305_CTZ16(bits)];
+
+        actions |= (uint16_t)(1U << descriptor->action);
+
+        if(visitor != NULL)
+        {
+            visitor(self, status_index, descriptor);
+        }
+
+        bits &= (uint16_t)(bits - 1U);
+    } while(bits != 0);
+
+    return actions;
+}
+
+/**
+ * @brief Get descriptor of a single status bit (implementation)
+ * @param[in] status_index Status register index (0-3)
+ * @param[in] bit Bit position (0-10)
+ * @return Pointer to descriptor or NULL
+ */
+DRV8305_PUBLIC const drv8305_status_bit_descriptor_t* drv8305_status_descriptor_get(uint16_t status_index, uint16_t bit)
+{
+    if(status_index >= (uint16_t)DRV8305_NUMBER_OF_STATUS_REGISTERS || bit >= (uint16_t)DRV8305_STATUS_BITS_PER_REGISTER) { return NULL; }
+
+    return &drv8305_status_descriptors[status_index][bit];
+}
+
+/**
+ * @brief Collect bits mapped to one action (implementation)
+ * @param[in] status_index Status register index (0-3)
+ * @param[in] action Action to look for
+ * @return uint16_t Mask of the bits whose descriptor carries 'action'
+ */
+DRV8305_PUBLIC uint16_t drv8305_status_action_mask(uint16_t status_index, drv8305_status_action_e action)
+{
+    uint16_t mask = 0;
+
+    if(status_index >= (uint16_t)DRV8305_NUMBER_OF_STATUS_REGISTERS) { return 0; }
+
+    for(int bit = 0; bit < DRV8305_STATUS_BITS_PER_REGISTER; bit++)
+    {
+        if(drv8305_status_descriptors[status_index][bit].action == action)
+        {
+            mask |= drv8305_status_descriptors[status_index][bit].mask;
+        }
+    }
+
+    return mask;
+}
+
+/**
+ * @brief Portable count-trailing-zeros (implementation)
+ * @details Binary search over the isolated lowest set bit; used when no compiler
+ *          intrinsic is available.
+ * @param[in] value Non-zero value
+ * @return uint16_t Index of the lowest set bit
+ */
+DRV8305_PUBLIC uint16_t drv8305_ctz16(uint16_t value)
+{
+    uint16_t count = 0;
+
+    value &= (uint16_t)(0U - value);
+
+    if((value & 0xFF00U) != 0) { count += 8; }
+    if((value & 0xF0F0U) != 0) { count += 4; }
+    if((value & 0xCCCCU) != 0) { count += 2; }
+    if((value & 0xAAAAU) != 0) { count += 1; }
+
+    return count;
+}
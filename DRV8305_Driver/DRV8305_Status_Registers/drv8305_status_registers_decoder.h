@@ -0,0 +1,104 @@
+/**
+ * @file drv8305_status_registers_decoder.h
+ * @brief DRV8305 Status Register Decoder - Table-Driven Interface
+ * @details Declares the constant per-register bit descriptor tables and the decoder that
+ *          visits only the set bits of a status word.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * This module provides:
+ *   - One const descriptor table per status register (bit, name, severity, phase, MOSFET, action)
+ *   - drv8305_status_register_decode(): walks set bits with count-trailing-zeros
+ *   - drv8305_status_action_mask(): bits of a register mapped to one action
+ *   - DRV8305_CTZ16(): count-trailing-zeros (compiler builtin or portable fallback)
+ *
+ * @decode_cost
+ * A clean status word costs a single compare. Otherwise the decoder executes one loop
+ * iteration per set bit instead of testing all 11 flags.
+ *
+ * @table_indexing
+ * status_index uses the register_manager[] indexing (DRV8305_STATUS_0x_ARRAY_INDEX),
+ * bit is the bit position 0-10 inside the register data field.
+ */
+
+#ifndef DRV8305_STATUS_REGISTERS_DECODER_H_
+#define DRV8305_STATUS_REGISTERS_DECODER_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#include "drv8305_macros.h"
+#include "drv8305_status_registers_definitions.h"
+
+/** @brief Number of decoded bits per status register (data field bits 10:0) */
+#define DRV8305_STATUS_BITS_PER_REGISTER  (int)11
+
+/**
+ * @brief Count trailing zeros of a non-zero 16-bit value
+ * @note Define before including this header to use a target intrinsic
+ */
+#ifndef DRV8305_CTZ16
+#if defined(__GNUC__)
+#define DRV8305_CTZ16(value)  ((uint16_t)__builtin_ctz((unsigned int)(value)))
+#else
+#define DRV8305_CTZ16(value)  drv8305_ctz16((uint16_t)(value))
+#endif
+#endif
+
+/**
+ * @brief Visitor invoked for every set bit
+ * @param[in] self User context passed to the decoder
+ * @param[in] status_index Status register index (0-3)
+ * @param[in] descriptor Descriptor of the set bit
+ */
+typedef void (*drv8305_status_bit_visitor_t)(void *self, uint16_t status_index, const drv8305_status_bit_descriptor_t *descriptor);
+
+/**
+ * @brief Status bit descriptor tables, [status_index][bit]
+ */
+extern const drv8305_status_bit_descriptor_t drv8305_status_descriptors[DRV8305_NUMBER_OF_STATUS_REGISTERS][DRV8305_STATUS_BITS_PER_REGISTER];
+
+/**
+ * @brief Decode a status word, visiting only set bits
+ * @param[in] self User context forwarded to the visitor
+ * @param[in] status_index Status register index (0-3)
+ * @param[in] data Raw status frame (bits 15:11 are ignored)
+ * @param[in] visitor Called once per set bit, lowest bit first (may be NULL)
+ * @return uint16_t Bitmask of actions found, (1U << drv8305_status_action_e)
+ */
+DRV8305_PUBLIC uint16_t drv8305_status_register_decode(void *self, uint16_t status_index, uint16_t data, drv8305_status_bit_visitor_t visitor);
+
+/**
+ * @brief Get descriptor of a single status bit
+ * @param[in] status_index Status register index (0-3)
+ * @param[in] bit Bit position (0-10)
+ * @return Pointer to constant descriptor, NULL if out of range
+ */
+DRV8305_PUBLIC const drv8305_status_bit_descriptor_t* drv8305_status_descriptor_get(uint16_t status_index, uint16_t bit);
+
+/**
+ * @brief Collect the bits of a status register mapped to one action
+ * @param[in] status_index Status register index (0-3)
+ * @param[in] action Action to look for
+ * @return uint16_t Bit mask (bits 10:0), 0 if out of range
+ */
+DRV8305_PUBLIC uint16_t drv8305_status_action_mask(uint16_t status_index, drv8305_status_action_e action);
+
+/**
+ * @brief Portable count-trailing-zeros fallback
+ * @param[in] value Non-zero value
+ * @return uint16_t Index of the lowest set bit
+ */
+DRV8305_PUBLIC uint16_t drv8305_ctz16(uint16_t value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRV8305_STATUS_REGISTERS_DECODER_H_ */
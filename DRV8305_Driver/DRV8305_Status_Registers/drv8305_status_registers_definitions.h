@@ -14,6 +14,7 @@
  *   - Register 0x02: OV/VDS Faults (11 bits: shunt OCP, MOSFET VDS overcurrent)
  *   - Register 0x03: IC Faults (11 bits: charge pump, supply, thermal, watchdog)
  *   - Register 0x04: VGS Faults (11 bits: gate drive faults on 6 MOSFETs)
+ *   - Status bit descriptor type (severity, affected phase/MOSFET, default action)
  * 
  * @naming_convention
  * DRV8305_[REGISTER_NAME]_[BIT_DESCRIPTION]
@@ -31,6 +32,8 @@
 extern "C" {
 #endif
 
+#include <stdint.h>
+
 /* ============================================================================
  * STATUS REGISTERS (Read-Only)
  * Datasheet Reference: Table 10-13, Pages 38-39
@@ -97,6 +100,67 @@ extern "C" {
 #define DRV8305_VGS_LA              (1U << 9)   // VGS gate drive fault for low-side MOSFET A
 #define DRV8305_VGS_HA              (1U << 10)  // VGS gate drive fault for high-side MOSFET A
 
+/* ============================================================================
+ * STATUS BIT DESCRIPTORS
+ * ============================================================================ */
+
+/**
+ * @brief Status bit severity (ordered, higher value = more severe)
+ */
+typedef enum
+{
+    DRV8305_SEVERITY_NONE,      // Reserved bit / no meaning
+    DRV8305_SEVERITY_INFO,      // Informational (e.g. low temperature flags)
+    DRV8305_SEVERITY_WARNING,   // Warning, motor may keep running
+    DRV8305_SEVERITY_FAULT,     // Fault, IC or supply out of range
+    DRV8305_SEVERITY_CRITICAL,  // Power stage fault, stop immediately
+} drv8305_status_severity_e;
+
+/**
+ * @brief Motor phase affected by a status bit
+ */
+typedef enum
+{
+    DRV8305_PHASE_NONE,
+    DRV8305_PHASE_A,
+    DRV8305_PHASE_B,
+    DRV8305_PHASE_C,
+} drv8305_phase_e;
+
+/**
+ * @brief MOSFET position affected by a status bit
+ */
+typedef enum
+{
+    DRV8305_MOSFET_NONE,
+    DRV8305_MOSFET_HIGH_SIDE,
+    DRV8305_MOSFET_LOW_SIDE,
+} drv8305_mosfet_e;
+
+/**
+ * @brief Default application action for a status bit
+ */
+typedef enum
+{
+    DRV8305_ACTION_NONE,        // No action
+    DRV8305_ACTION_LOG,         // Record for diagnostics
+    DRV8305_ACTION_DERATE,      // Decrease motor performance
+    DRV8305_ACTION_STOP_MOTOR,  // Stop the motor
+} drv8305_status_action_e;
+
+/**
+ * @brief Constant description of one status register bit
+ */
+typedef struct
+{
+    uint16_t                  mask;      // Bit mask inside the register (DRV8305_WARN_xxx, ...)
+    const char               *name;      // Symbolic name
+    drv8305_status_severity_e severity;
+    drv8305_phase_e           phase;
+    drv8305_mosfet_e          mosfet;
+    drv8305_status_action_e   action;
+} drv8305_status_bit_descriptor_t;
+
 #ifdef __cplusplus
 }
 #endif
@@ -26,14 +26,23 @@
  * Temperature Thresholds (Page 38):
  *   FLAG1: ~105°C, FLAG2: ~125°C, FLAG3: ~135°C, FLAG4/OTW: ~150°C
  * Fault Priority: VDS/VGS > IC Faults > OV/VDS Faults > Warnings
+ * 
+ * @decoding
+ * Handlers use the table-driven decoder (drv8305_status_registers_decoder.h): only set bits
+ * are visited and each bit's default action comes from its descriptor. Change the
+ * descriptor tables to re-map actions; extend drv8305_status_bit_action_handler() to
+ * implement them.
  */
 
 #include <stdint.h>
 
 #include "drv8305_macros.h"
 #include "drv8305_status_registers_definitions.h"
+#include "drv8305_status_registers_decoder.h"
 #include "drv8305_status_registers_handlers.h"
 
+DRV8305_PRIVATE void drv8305_status_bit_action_handler(void *self, uint16_t status_index, const drv8305_status_bit_descriptor_t *descriptor);
+
 /* --------------------------- STATUS REGISTERS HANDLERS --------------------------- */
 
 /**
@@ -49,67 +58,7 @@
 DRV8305_PUBLIC void drv8305_warning_register_handler(void *self, uint16_t data)
 {
     // Register 0x01: Warning & Watchdog Reset
-    (void)self;  // Unused parameter
-    
-    // Overtemperature warning (~150°C)
-    if (data & DRV8305_WARN_OTW) 
-    {
-        // Action: Decrease motor performance
-    }
-
-    // Temperature flag 3 (~135°C)
-    if (data & DRV8305_WARN_TEMP_FLAG3) 
-    {
-        
-    }
-
-    // Temperature flag 2 (~125°C)
-    if (data & DRV8305_WARN_TEMP_FLAG2) 
-    {
-        
-    }
-
-    // Temperature flag 1 (~105°C)
-    if (data & DRV8305_WARN_TEMP_FLAG1) 
-    {
-    
-    }
-
-    // Charge pump undervoltage flag warning
-    if (data & DRV8305_WARN_VCPH_UVFL) 
-    {
-    
-    }
-
-    // VDS overcurrent monitor (OR of all VDS monitors)
-    if (data & DRV8305_WARN_VDS_STATUS) 
-    {
-    
-    }
-
-    // PVDD overvoltage flag warning
-    if (data & DRV8305_WARN_PVDD_OVFL) 
-    {
-        
-    }
-
-    // PVDD undervoltage flag warning
-    if (data & DRV8305_WARN_PVDD_UVFL) 
-    {
-    
-    }
-
-    // Temperature flag 4 (~175°C)
-    if (data & DRV8305_WARN_TEMP_FLAG4) 
-    {
-    
-    }
-    
-    // Global fault indication
-    if (data & DRV8305_WARN_FAULT) 
-    {
-        // Action: This bit being set indicates an IC Fault or VGS Fault
-    }
+    drv8305_status_register_decode(self, DRV8305_STATUS_01_ARRAY_INDEX, data, drv8305_status_bit_action_handler);
 }
 
 /**
@@ -125,61 +74,7 @@ DRV8305_PUBLIC void drv8305_warning_register_handler(void *self, uint16_t data)
 DRV8305_PUBLIC void drv8305_ov_vds_register_handler(void *self, uint16_t data)
 {
     // Register 0x02: OV/VDS Faults
-    (void)self;  // Unused parameter
-    
-    // Sense A overcurrent fault
-    if (data & DRV8305_VDS_SNS_A_OCP) 
-    {
-        // Action: Immediately stop the motor, check the FAULT pin
-    }
-
-    // Sense B overcurrent fault
-    if (data & DRV8305_VDS_SNS_B_OCP) 
-    {
-    
-    }
-
-    // Sense C overcurrent fault
-    if (data & DRV8305_VDS_SNS_C_OCP) 
-    {
-    
-    }
-    
-    // VDS overcurrent fault for low-side MOSFET C
-    if (data & DRV8305_VDS_LC) 
-    {
-    
-    }
-
-    // VDS overcurrent fault for high-side MOSFET C
-    if (data & DRV8305_VDS_HC) 
-    {
-    
-    }
-
-    // VDS overcurrent fault for low-side MOSFET B
-    if (data & DRV8305_VDS_LB) 
-    {
-    
-    }
-
-    // VDS overcurrent fault for high-side MOSFET B
-    if (data & DRV8305_VDS_HB) 
-    {
-    
-    }
-
-    // VDS overcurrent fault for low-side MOSFET A
-    if (data & DRV8305_VDS_LA) 
-    {
-    
-    }
-
-    // VDS overcurrent fault for high-side MOSFET A
-    if (data & DRV8305_VDS_HA) 
-    {
-    
-    }
+    drv8305_status_register_decode(self, DRV8305_STATUS_02_ARRAY_INDEX, data, drv8305_status_bit_action_handler);
 }
 
 /**
@@ -195,61 +90,7 @@ DRV8305_PUBLIC void drv8305_ov_vds_register_handler(void *self, uint16_t data)
 DRV8305_PUBLIC void drv8305_ic_faults_register_handler(void *self, uint16_t data)
 {
     // Register 0x03: IC Faults
-    (void)self;  // Unused parameter
-    
-    // Charge pump absolute overvoltage fault
-    if (data & DRV8305_IC_VCPH_OVLO_ABS) 
-    {
-        // Action: Stop the motor. These bits indicate the internal health of the DRV8305.
-    }
-
-    // Charge pump overvoltage fault (relative to PVDD)
-    if (data & DRV8305_IC_VCPH_OVLO) 
-    {
-    
-    }
-
-    // Charge pump undervoltage 2 fault
-    if (data & DRV8305_IC_VCPH_UVLO2) 
-    {
-    
-    }
-    
-    // Low-side gate supply undervoltage fault
-    if (data & DRV8305_IC_VCP_LSD_UVLO2) 
-    {
-    
-    }
-
-    // AVDD undervoltage fault
-    if (data & DRV8305_IC_AVDD_UVLO) 
-    {
-    
-    }
-
-    // VREG undervoltage fault
-    if (data & DRV8305_IC_VREG_UV) 
-    {
-    
-    }
-
-    // Overtemperature shutdown fault (~175°C)
-    if (data & DRV8305_IC_OTSD) 
-    {
-    
-    }
-
-    // Watchdog fault
-    if (data & DRV8305_IC_WD_FAULT) 
-    {
-    
-    }
-
-    // PVDD undervoltage 2 fault
-    if (data & DRV8305_IC_PVDD_UVLO2) 
-    {
-    
-    }
+    drv8305_status_register_decode(self, DRV8305_STATUS_03_ARRAY_INDEX, data, drv8305_status_bit_action_handler);
 }
 
 /**
@@ -265,41 +106,51 @@ DRV8305_PUBLIC void drv8305_ic_faults_register_handler(void *self, uint16_t data
 DRV8305_PUBLIC void drv8305_vgs_faults_register_handler(void *self, uint16_t data)
 {
     // Register 0x04: VGS Faults
-    (void)self;  // Unused parameter
-    
-    // VGS gate drive fault for low-side MOSFET C
-    if (data & DRV8305_VGS_LC) 
-    {
-        // Action: Immediately stop the motor, log that the relevant MOSFET is faulty.        
-    }
-
-    // VGS gate drive fault for high-side MOSFET C
-    if (data & DRV8305_VGS_HC) 
-    {
-    
-    }
-
-    // VGS gate drive fault for low-side MOSFET B
-    if (data & DRV8305_VGS_LB) 
-    {
-    
-    }
-
-    // VGS gate drive fault for high-side MOSFET B
-    if (data & DRV8305_VGS_HB) 
-    {
-    
-    }
+    drv8305_status_register_decode(self, DRV8305_STATUS_04_ARRAY_INDEX, data, drv8305_status_bit_action_handler);
+}
 
-    // VGS gate drive fault for low-side MOSFET A
-    if (data & DRV8305_VGS_LA) 
-    {
-    
-    }
+/* --------------------------- STATUS BIT ACTIONS --------------------------- */
 
-    // VGS gate drive fault for high-side MOSFET A
-    if (data & DRV8305_VGS_HA) 
-    {
-        
+/**
+ * @brief Execute the default action of one set status bit (internal)
+ * @details Visitor passed to drv8305_status_register_decode(); called only for bits that
+ *          are set, lowest bit first.
+ * @param[in] self Pointer to DRV8305 user object context
+ * @param[in] status_index Status register index (0-3)
+ * @param[in] descriptor Descriptor of the set bit (severity, phase, MOSFET, action)
+ * @return None
+ * @note Implement application-specific behaviour per action here
+ */
+DRV8305_PRIVATE void drv8305_status_bit_action_handler(void *self, uint16_t status_index, const drv8305_status_bit_descriptor_t *descriptor)
+{
+    (void)self;          // Unused parameter
+    (void)status_index;  // Unused parameter
+
+    switch (descriptor->action)
+    {
+        case DRV8305_ACTION_NONE:
+        {
+            break;
+        }
+
+        case DRV8305_ACTION_LOG:
+        {
+            // Action: Record descriptor->name for diagnostics
+            break;
+        }
+
+        case DRV8305_ACTION_DERATE:
+        {
+            // Action: Decrease motor performance
+            break;
+        }
+
+        case DRV8305_ACTION_STOP_MOTOR:
+        {
+            // Action: EN_GATE is already low when the bit is in the protective shutdown mask
+            //         (drv8305_api_set_protection_policy); stop the control loop, log
+            //         descriptor->phase / descriptor->mosfet when set
+            break;
+        }
     }
-}
\ No newline at end of file
+}
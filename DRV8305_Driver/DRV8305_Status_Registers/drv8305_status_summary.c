@@ -0,0 +1,123 @@
+/**
+ * @file drv8305_status_summary.c
+ * @brief DRV8305 Status Summary - Consolidated Per-Scan Status Implementation
+ * @details Builds the per-scan summary from the status register data and the constant
+ *          bit descriptor tables.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * This implementation file contains:
+ *   - Severity and phase/MOSFET aggregation over the set bits (descriptor driven)
+ *   - Thermal level and supply state mapping
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "drv8305_macros.h"
+#include "drv8305_status_registers_definitions.h"
+#include "drv8305_status_registers_decoder.h"
+#include "drv8305_status_summary.h"
+
+/* -------------------------------- FUNCTION PROTOTYPES -------------------------------- */
+DRV8305_PRIVATE drv8305_thermal_level_e drv8305_status_summary_thermal (const uint16_t *status);
+DRV8305_PRIVATE uint16_t                drv8305_status_summary_supply  (const uint16_t *status);
+
+/* -------------------------------- PUBLIC FUNCTIONS -------------------------------- */
+
+/**
+ * @brief Derive summary fields from status register data (implementation)
+ * @details Worst severity and the per-phase masks come from the descriptors of the set
+ *          bits, visited with count-trailing-zeros (a clean register costs one compare).
+ * @param[in,out] summary Summary to fill
+ * @param[in] status Status register data
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_status_summary_build(drv8305_status_summary_t *summary, const uint16_t *status)
+{
+    if(!summary || !status) { return; }
+
+    summary->worst_severity = DRV8305_SEVERITY_NONE;
+    summary->high_side      = 0;
+    summary->low_side       = 0;
+    summary->sense_ocp      = 0;
+
+    for(int index = 0; index < DRV8305_NUMBER_OF_STATUS_REGISTERS; index++)
+    {
+        uint16_t bits = status[index] & DRV8305_REGISTER_DATA_MASK;
+
+        summary->status[index] = bits;
+
+        while(bits != 0)
+        {
+            const drv8305_status_bit_descriptor_t *descriptor = &drv8305_status_descriptors[index][DRV8305_CTZ16(bits)];
+
+            if(descriptor->severity > summary->worst_severity)
+            {
+                summary->worst_severity = descriptor->severity;
+            }
+
+            if(descriptor->phase != DRV8305_PHASE_NONE)
+            {
+                switch (descriptor->mosfet)
+                {
+                    case DRV8305_MOSFET_HIGH_SIDE: { summary->high_side |= DRV8305_SUMMARY_PHASE_BIT(descriptor->phase); break; }
+                    case DRV8305_MOSFET_LOW_SIDE:  { summary->low_side  |= DRV8305_SUMMARY_PHASE_BIT(descriptor->phase); break; }
+                    case DRV8305_MOSFET_NONE:      { summary->sense_ocp |= DRV8305_SUMMARY_PHASE_BIT(descriptor->phase); break; }
+                }
+            }
+
+            bits &= (uint16_t)(bits - 1U);
+        }
+    }
+
+    summary->thermal        = drv8305_status_summary_thermal(summary->status);
+    summary->supply         = drv8305_status_summary_supply(summary->status);
+    summary->watchdog_fault = (summary->status[DRV8305_STATUS_03_ARRAY_INDEX] & DRV8305_IC_WD_FAULT) != 0;
+}
+
+/* -------------------------------- PRIVATE FUNCTIONS -------------------------------- */
+
+/**
+ * @brief Map temperature flags to the highest thermal level (internal)
+ * @param[in] status Status register data (bits 10:0)
+ * @return drv8305_thermal_level_e Highest active level
+ */
+DRV8305_PRIVATE drv8305_thermal_level_e drv8305_status_summary_thermal(const uint16_t *status)
+{
+    uint16_t warning = status[DRV8305_STATUS_01_ARRAY_INDEX];
+
+    if(status[DRV8305_STATUS_03_ARRAY_INDEX] & DRV8305_IC_OTSD) { return DRV8305_THERMAL_SHUTDOWN; }
+    if(warning & DRV8305_WARN_TEMP_FLAG4)                       { return DRV8305_THERMAL_FLAG4;    }
+    if(warning & DRV8305_WARN_OTW)                              { return DRV8305_THERMAL_OTW;      }
+    if(warning & DRV8305_WARN_TEMP_FLAG3)                       { return DRV8305_THERMAL_FLAG3;    }
+    if(warning & DRV8305_WARN_TEMP_FLAG2)                       { return DRV8305_THERMAL_FLAG2;    }
+    if(warning & DRV8305_WARN_TEMP_FLAG1)                       { return DRV8305_THERMAL_FLAG1;    }
+
+    return DRV8305_THERMAL_NORMAL;
+}
+
+/**
+ * @brief Fold supply warnings and faults into DRV8305_SUPPLY_xxx flags (internal)
+ * @param[in] status Status register data (bits 10:0)
+ * @return uint16_t Supply flags, 0 = all supplies in range
+ */
+DRV8305_PRIVATE uint16_t drv8305_status_summary_supply(const uint16_t *status)
+{
+    uint16_t warning   = status[DRV8305_STATUS_01_ARRAY_INDEX];
+    uint16_t ic_faults = status[DRV8305_STATUS_03_ARRAY_INDEX];
+    uint16_t supply    = 0;
+
+    if((warning & DRV8305_WARN_PVDD_UVFL) || (ic_faults & DRV8305_IC_PVDD_UVLO2))                  { supply |= DRV8305_SUPPLY_PVDD_UV;    }
+    if(warning & DRV8305_WARN_PVDD_OVFL)                                                           { supply |= DRV8305_SUPPLY_PVDD_OV;    }
+    if((warning & DRV8305_WARN_VCPH_UVFL) || (ic_faults & DRV8305_IC_VCPH_UVLO2))                  { supply |= DRV8305_SUPPLY_VCPH_UV;    }
+    if(ic_faults & (DRV8305_IC_VCPH_OVLO | DRV8305_IC_VCPH_OVLO_ABS))                              { supply |= DRV8305_SUPPLY_VCPH_OV;    }
+    if(ic_faults & DRV8305_IC_VCP_LSD_UVLO2)                                                       { supply |= DRV8305_SUPPLY_VCP_LSD_UV; }
+    if(ic_faults & DRV8305_IC_AVDD_UVLO)                                                           { supply |= DRV8305_SUPPLY_AVDD_UV;    }
+    if(ic_faults & DRV8305_IC_VREG_UV)                                                             { supply |= DRV8305_SUPPLY_VREG_UV;    }
+
+    return supply;
+}
@@ -0,0 +1,90 @@
+/**
+ * @file drv8305_status_summary.h
+ * @brief DRV8305 Status Summary - Consolidated Per-Scan Status Interface
+ * @details Declares the summary built once per completed status scan from the four status
+ *          registers, so a supervisor can run its policy once on a coherent picture.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * This module provides:
+ *   - drv8305_status_summary_t: worst severity, per-phase HS/LS/sense faults, thermal level,
+ *     supply state, scan sequence number and age
+ *   - drv8305_status_summary_build(): derive the summary from the status register data
+ *
+ * @phase_masks
+ * high_side, low_side and sense_ocp hold one bit per phase, DRV8305_SUMMARY_PHASE_BIT(phase):
+ *   bit 0 = phase A, bit 1 = phase B, bit 2 = phase C
+ */
+
+#ifndef DRV8305_STATUS_SUMMARY_H_
+#define DRV8305_STATUS_SUMMARY_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "drv8305_macros.h"
+#include "drv8305_status_registers_definitions.h"
+
+/** @brief Phase bit inside the high_side / low_side / sense_ocp masks */
+#define DRV8305_SUMMARY_PHASE_BIT(phase)  ((uint16_t)(1U << ((phase) - DRV8305_PHASE_A)))
+
+/* Supply state flags (drv8305_status_summary_t.supply) */
+#define DRV8305_SUPPLY_PVDD_UV      (1U << 0)   // PVDD undervoltage (warning or UVLO2)
+#define DRV8305_SUPPLY_PVDD_OV      (1U << 1)   // PVDD overvoltage warning
+#define DRV8305_SUPPLY_VCPH_UV      (1U << 2)   // Charge pump undervoltage (warning or UVLO2)
+#define DRV8305_SUPPLY_VCPH_OV      (1U << 3)   // Charge pump overvoltage (relative or absolute)
+#define DRV8305_SUPPLY_VCP_LSD_UV   (1U << 4)   // Low-side gate supply undervoltage
+#define DRV8305_SUPPLY_AVDD_UV      (1U << 5)   // AVDD undervoltage
+#define DRV8305_SUPPLY_VREG_UV      (1U << 6)   // VREG undervoltage
+
+/**
+ * @brief Highest active temperature indication (ordered, higher value = hotter)
+ */
+typedef enum
+{
+    DRV8305_THERMAL_NORMAL,     // No temperature flag
+    DRV8305_THERMAL_FLAG1,      // ~105°C
+    DRV8305_THERMAL_FLAG2,      // ~125°C
+    DRV8305_THERMAL_FLAG3,      // ~135°C
+    DRV8305_THERMAL_OTW,        // Overtemperature warning
+    DRV8305_THERMAL_FLAG4,      // ~175°C
+    DRV8305_THERMAL_SHUTDOWN,   // Overtemperature shutdown (IC fault)
+} drv8305_thermal_level_e;
+
+typedef struct
+{
+    uint32_t                  sequence;        // Completed status scans since initialization
+    uint32_t                  timestamp;       // Driver time of scan completion
+    uint32_t                  age;             // Ticks since completion (set by the getter)
+
+    uint16_t                  status[DRV8305_NUMBER_OF_STATUS_REGISTERS];  // Register data (bits 10:0)
+
+    drv8305_status_severity_e worst_severity;
+    drv8305_thermal_level_e   thermal;
+    uint16_t                  supply;          // DRV8305_SUPPLY_xxx flags
+    uint16_t                  high_side;       // Phases with a high-side VDS/VGS fault
+    uint16_t                  low_side;        // Phases with a low-side VDS/VGS fault
+    uint16_t                  sense_ocp;       // Phases with a shunt sense overcurrent
+    bool                      watchdog_fault;
+} drv8305_status_summary_t;
+
+/**
+ * @brief Derive the summary fields from status register data
+ * @param[in,out] summary Summary to fill (sequence, timestamp and age are left unchanged)
+ * @param[in] status Status register data, DRV8305_NUMBER_OF_STATUS_REGISTERS entries
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_status_summary_build(drv8305_status_summary_t *summary, const uint16_t *status);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRV8305_STATUS_SUMMARY_H_ */
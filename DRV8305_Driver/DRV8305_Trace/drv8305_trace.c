@@ -0,0 +1,141 @@
+/**
+ * @file drv8305_trace.c
+ * @brief DRV8305 SPI Trace - Implementation
+ * @details Implements ring reset, copy and the word dump used by the host trace exporter.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * This implementation file contains:
+ *   - Ring reset and oldest-first copy
+ *   - Dump export (target side) and dump header/record decoding (host side)
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "drv8305_macros.h"
+#include "drv8305_trace.h"
+
+/**@brief: Free-running ring index requires a power-of-two depth **/
+typedef char drv8305_trace_depth_check[((DRV8305_TRACE_DEPTH & (DRV8305_TRACE_DEPTH - 1)) == 0) ? 1 : -1];
+
+/* -------------------------------- PUBLIC FUNCTIONS -------------------------------- */
+
+/**
+ * @brief Reset ring (implementation)
+ * @param[out] ring Pointer to trace ring
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_trace_ring_init(drv8305_trace_ring_t *ring)
+{
+    if(!ring) { return; }
+
+    ring->head = 0;
+}
+
+/**
+ * @brief Copy the most recent records (implementation)
+ * @param[in] ring Pointer to trace ring
+ * @param[out] records Destination array, oldest first
+ * @param[in] max_records Capacity of the destination array
+ * @return uint16_t Number of records copied
+ */
+DRV8305_PUBLIC uint16_t drv8305_trace_ring_copy(const drv8305_trace_ring_t *ring, drv8305_trace_record_t *records, uint16_t max_records)
+{
+    if(!ring || !records) { return 0; }
+
+    uint32_t head  = ring->head;
+    uint32_t count = (head < (uint32_t)DRV8305_TRACE_DEPTH) ? head : (uint32_t)DRV8305_TRACE_DEPTH;
+
+    if(count > max_records) { count = max_records; }
+
+    for(uint32_t index = 0; index < count; index++)
+    {
+        records[index] = ring->records[(head - count + index) & (DRV8305_TRACE_DEPTH - 1)];
+    }
+
+    return (uint16_t)count;
+}
+
+/**
+ * @brief Write the most recent records as a dump (implementation)
+ * @param[in] ring Pointer to trace ring
+ * @param[out] words Destination words
+ * @param[in] max_words Capacity of words
+ * @param[in] timestamp_hz Timestamp ticks per second
+ * @return uint32_t Words written, 0 if the header does not fit
+ */
+DRV8305_PUBLIC uint32_t drv8305_trace_ring_export(const drv8305_trace_ring_t *ring, uint16_t *words, uint32_t max_words, uint32_t timestamp_hz)
+{
+    if(!ring || !words || max_words < DRV8305_TRACE_DUMP_HEADER_WORDS) { return 0; }
+
+    uint32_t head  = ring->head;
+    uint32_t count = (head < (uint32_t)DRV8305_TRACE_DEPTH) ? head : (uint32_t)DRV8305_TRACE_DEPTH;
+    uint32_t fit   = (max_words - DRV8305_TRACE_DUMP_HEADER_WORDS) / DRV8305_TRACE_DUMP_RECORD_WORDS;
+
+    if(count > fit) { count = fit; }
+
+    words[0] = DRV8305_TRACE_DUMP_MAGIC;
+    words[1] = DRV8305_TRACE_DUMP_VERSION;
+    words[2] = (uint16_t)count;
+    words[3] = (uint16_t)(timestamp_hz & 0xFFFFU);
+    words[4] = (uint16_t)(timestamp_hz >> 16);
+
+    uint16_t *out = &words[DRV8305_TRACE_DUMP_HEADER_WORDS];
+
+    for(uint32_t index = 0; index < count; index++)
+    {
+        const drv8305_trace_record_t *record = &ring->records[(head - count + index) & (DRV8305_TRACE_DEPTH - 1)];
+
+        *out++ = (uint16_t)(record->timestamp & 0xFFFFU);
+        *out++ = (uint16_t)(record->timestamp >> 16);
+        *out++ = record->tx;
+        *out++ = record->rx;
+        *out++ = record->state;
+    }
+
+    return DRV8305_TRACE_DUMP_WORDS(count);
+}
+
+/**
+ * @brief Validate a dump and decode its header (implementation)
+ * @param[in] words Dump words
+ * @param[in] word_count Words available
+ * @param[out] header Decoded header
+ * @return true if the dump is well-formed
+ */
+DRV8305_PUBLIC bool drv8305_trace_dump_header(const uint16_t *words, uint32_t word_count, drv8305_trace_dump_header_t *header)
+{
+    if(!words || !header || word_count < DRV8305_TRACE_DUMP_HEADER_WORDS) { return false; }
+
+    if(words[0] != DRV8305_TRACE_DUMP_MAGIC || words[1] != DRV8305_TRACE_DUMP_VERSION) { return false; }
+
+    header->version      = words[1];
+    header->count        = words[2];
+    header->timestamp_hz = (uint32_t)words[3] | ((uint32_t)words[4] << 16);
+
+    return header->timestamp_hz != 0 && word_count >= DRV8305_TRACE_DUMP_WORDS(header->count);
+}
+
+/**
+ * @brief Decode one record of a validated dump (implementation)
+ * @param[in] words Dump words
+ * @param[in] index Record index, 0 = oldest
+ * @param[out] record Decoded record
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_trace_dump_record(const uint16_t *words, uint16_t index, drv8305_trace_record_t *record)
+{
+    if(!words || !record) { return; }
+
+    const uint16_t *in = &words[DRV8305_TRACE_DUMP_WORDS(index)];
+
+    record->timestamp = (uint32_t)in[0] | ((uint32_t)in[1] << 16);
+    record->tx        = in[2];
+    record->rx        = in[3];
+    record->state     = in[4];
+}
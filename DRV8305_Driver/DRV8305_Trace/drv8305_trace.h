@@ -0,0 +1,168 @@
+/**
+ * @file drv8305_trace.h
+ * @brief DRV8305 SPI Trace - Frame Ring and Dump Format
+ * @details Declares the preallocated ring of SPI frames recorded between the state machines and
+ *          drv8305_spi_write_and_read_from_register_cb, and the word dump a host tool reads.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * This module provides:
+ *   - drv8305_trace_record_t: timestamp, TX frame, RX frame and driver state of one frame
+ *   - drv8305_trace_ring_t: overwriting ring of the last DRV8305_TRACE_DEPTH frames
+ *   - drv8305_trace_ring_record(): inline producer, five stores per frame
+ *   - Dump export (target) and dump decoding (host, Tools/drv8305_trace)
+ *
+ * @enable
+ * The driver records only when built with -DDRV8305_SPI_TRACE (drv8305_user_object_t.trace);
+ * without it the hook compiles to nothing and the object carries no ring. Timestamps come from
+ * DRV8305_TRACE_TIMESTAMP(self) at DRV8305_TRACE_TIMESTAMP_HZ (drv8305_macros.h), by default
+ * the 1 ms driver time; define both to a free-running up-counter to resolve frame gaps.
+ *
+ * @decoding
+ * Register and operation are not stored separately: they are bits of the TX frame
+ * ([15] 1 = read, [14:11] address), see DRV8305_TRACE_FRAME_ADDRESS / DRV8305_TRACE_FRAME_IS_READ.
+ * The state word holds drv8305_sm_state_e in bits 7:0 and the status, control or recovery
+ * sub-state of that main state in bits 15:8.
+ *
+ * @dump_format
+ * 16-bit words (two octets, low octet first, when written to a file):
+ *   magic, version, record count, timestamp Hz low, timestamp Hz high,
+ *   then per record, oldest first: timestamp low, timestamp high, tx, rx, state
+ *
+ * @concurrency_model
+ * One producer (the polling context). The ring overwrites its oldest record and never waits;
+ * copy or export it from the producer context.
+ */
+
+#ifndef DRV8305_TRACE_H_
+#define DRV8305_TRACE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "drv8305_macros.h"
+
+/** @brief First word of a trace dump */
+#define DRV8305_TRACE_DUMP_MAGIC          (uint16_t)0x7E05U
+/** @brief Dump layout version */
+#define DRV8305_TRACE_DUMP_VERSION        (uint16_t)1U
+/** @brief Words before the first record of a dump */
+#define DRV8305_TRACE_DUMP_HEADER_WORDS   (uint32_t)5U
+/** @brief Words per record of a dump */
+#define DRV8305_TRACE_DUMP_RECORD_WORDS   (uint32_t)5U
+/** @brief Dump size in words for a number of records */
+#define DRV8305_TRACE_DUMP_WORDS(records) (DRV8305_TRACE_DUMP_HEADER_WORDS + (uint32_t)(records) * DRV8305_TRACE_DUMP_RECORD_WORDS)
+
+/** @brief Register address of a traced TX frame */
+#define DRV8305_TRACE_FRAME_ADDRESS(tx)   (uint16_t)(((tx) >> 11) & 0x0FU)
+/** @brief Whether a traced TX frame is a read */
+#define DRV8305_TRACE_FRAME_IS_READ(tx)   (((tx) & 0x8000U) != 0)
+/** @brief Main state (drv8305_sm_state_e) of a traced state word */
+#define DRV8305_TRACE_MAIN_STATE(state)   (uint16_t)((state) & 0xFFU)
+/** @brief Sub-state of a traced state word */
+#define DRV8305_TRACE_SUB_STATE(state)    (uint16_t)(((state) >> 8) & 0xFFU)
+
+/**
+ * @brief One traced SPI frame
+ */
+typedef struct
+{
+    uint32_t timestamp; // DRV8305_TRACE_TIMESTAMP(self) after the response returned
+    uint16_t tx;        // Command frame sent
+    uint16_t rx;        // Response frame received
+    uint16_t state;     // Main state [7:0], sub-state [15:8]
+} drv8305_trace_record_t;
+
+typedef struct
+{
+    uint32_t               head;    // Records written since initialization (free-running)
+    drv8305_trace_record_t records[DRV8305_TRACE_DEPTH];
+} drv8305_trace_ring_t;
+
+/**
+ * @brief Decoded dump header
+ */
+typedef struct
+{
+    uint16_t version;
+    uint16_t count;        // Records in the dump
+    uint32_t timestamp_hz; // Timestamp ticks per second
+} drv8305_trace_dump_header_t;
+
+/**
+ * @brief Reset ring to empty
+ * @param[out] ring Pointer to trace ring
+ * @return None
+ */
+DRV8305_PUBLIC void     drv8305_trace_ring_init   (drv8305_trace_ring_t *ring);
+
+/**
+ * @brief Copy the most recent records, oldest first
+ * @param[in] ring Pointer to trace ring
+ * @param[out] records Destination array
+ * @param[in] max_records Capacity of the destination array
+ * @return uint16_t Number of records copied
+ */
+DRV8305_PUBLIC uint16_t drv8305_trace_ring_copy   (const drv8305_trace_ring_t *ring, drv8305_trace_record_t *records, uint16_t max_records);
+
+/**
+ * @brief Write the most recent records as a dump
+ * @param[in] ring Pointer to trace ring
+ * @param[out] words Destination, DRV8305_TRACE_DUMP_WORDS(records) words
+ * @param[in] max_words Capacity of words
+ * @param[in] timestamp_hz Timestamp ticks per second (DRV8305_TRACE_TIMESTAMP_HZ)
+ * @return uint32_t Words written, 0 if not even the header fits
+ */
+DRV8305_PUBLIC uint32_t drv8305_trace_ring_export (const drv8305_trace_ring_t *ring, uint16_t *words, uint32_t max_words, uint32_t timestamp_hz);
+
+/**
+ * @brief Validate a dump and decode its header
+ * @param[in] words Dump words
+ * @param[in] word_count Words available
+ * @param[out] header Decoded header
+ * @return true if magic, version and size match
+ */
+DRV8305_PUBLIC bool     drv8305_trace_dump_header (const uint16_t *words, uint32_t word_count, drv8305_trace_dump_header_t *header);
+
+/**
+ * @brief Decode one record of a validated dump
+ * @param[in] words Dump words
+ * @param[in] index Record index, 0 = oldest
+ * @param[out] record Decoded record
+ * @return None
+ */
+DRV8305_PUBLIC void     drv8305_trace_dump_record (const uint16_t *words, uint16_t index, drv8305_trace_record_t *record);
+
+/**
+ * @brief Record one frame (producer)
+ * @param[in,out] ring Pointer to trace ring
+ * @param[in] timestamp Timestamp of the frame
+ * @param[in] tx Command frame
+ * @param[in] rx Response frame
+ * @param[in] state Main state [7:0], sub-state [15:8]
+ * @return None
+ * @note Overwrites the oldest record once the ring is full
+ */
+DRV8305_INLINE void drv8305_trace_ring_record(drv8305_trace_ring_t *ring, uint32_t timestamp, uint16_t tx, uint16_t rx, uint16_t state)
+{
+    drv8305_trace_record_t *record = &ring->records[ring->head & (DRV8305_TRACE_DEPTH - 1)];
+
+    record->timestamp = timestamp;
+    record->tx        = tx;
+    record->rx        = rx;
+    record->state     = state;
+    ring->head++;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRV8305_TRACE_H_ */
@@ -0,0 +1,59 @@
+/**
+ * @file drv8305_crc.c
+ * @brief DRV8305 Utilities - CRC-32 Implementation
+ * @details Implements the nibble-table CRC-32 over 16-bit words.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * This implementation file contains:
+ *   - Constant 16-entry CRC-32 nibble table
+ *   - Word-wise update (low octet first)
+ */
+
+#include <stdint.h>
+
+#include "drv8305_macros.h"
+#include "drv8305_crc.h"
+
+/**@brief: CRC-32 (0xEDB88320) of every 4-bit value **/
+DRV8305_PRIVATE const uint32_t drv8305_crc32_nibble_table[16] =
+{
+    0x00000000UL, 0x1DB71064UL, 0x3B6E20C8UL, 0x26D930ACUL,
+    0x76DC4190UL, 0x6B6B51F4UL, 0x4DB26158UL, 0x5005713CUL,
+    0xEDB88320UL, 0xF00F9344UL, 0xD6D6A3E8UL, 0xCB61B38CUL,
+    0x9B64C2B0UL, 0x86D3D2D4UL, 0xA00AE278UL, 0xBDBDF21CUL
+};
+
+/* -------------------------------- PUBLIC FUNCTIONS -------------------------------- */
+
+/**
+ * @brief Update CRC-32 with 16-bit words (implementation)
+ * @details The final XOR of the previous call is undone first, so results can be chained.
+ * @param[in] crc Running CRC or DRV8305_CRC32_INIT
+ * @param[in] words Data words
+ * @param[in] count Number of words
+ * @return uint32_t CRC-32
+ */
+DRV8305_PUBLIC uint32_t drv8305_crc32_words(uint32_t crc, const uint16_t *words, uint32_t count)
+{
+    if(!words) { return crc; }
+
+    crc = ~crc;
+
+    for(uint32_t index = 0; index < count; index++)
+    {
+        uint16_t word = words[index];
+
+        for(int octet = 0; octet < 2; octet++)
+        {
+            crc ^= (uint32_t)((word >> (8 * octet)) & 0xFFU);
+            crc  = (crc >> 4) ^ drv8305_crc32_nibble_table[crc & 0x0FU];
+            crc  = (crc >> 4) ^ drv8305_crc32_nibble_table[crc & 0x0FU];
+        }
+    }
+
+    return ~crc;
+}
@@ -0,0 +1,52 @@
+/**
+ * @file drv8305_crc.h
+ * @brief DRV8305 Utilities - CRC-32 Interface
+ * @details Declares the CRC-32 (IEEE 802.3, reflected, polynomial 0xEDB88320) used to
+ *          protect persisted driver data.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * This module provides:
+ *   - drv8305_crc32_words(): CRC-32 over 16-bit words
+ *
+ * @word_order
+ * Every 16-bit word is processed as two octets, low octet first. The result therefore
+ * matches a byte-wise CRC-32 of the same data on little-endian targets, and is identical on
+ * targets where char is 16 bits wide (TI C2000).
+ *
+ * @footprint
+ * Nibble-wise table (16 x 32-bit entries), two table look-ups per octet.
+ */
+
+#ifndef DRV8305_CRC_H_
+#define DRV8305_CRC_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#include "drv8305_macros.h"
+
+/** @brief Start value of a CRC-32 computation (CRC-32 of no data) */
+#define DRV8305_CRC32_INIT  0x00000000UL
+
+/**
+ * @brief Update CRC-32 with 16-bit words
+ * @param[in] crc Running CRC (DRV8305_CRC32_INIT for a new computation, or a
+ *            previous result to continue it)
+ * @param[in] words Data words
+ * @param[in] count Number of 16-bit words
+ * @return uint32_t CRC-32 of all data processed so far (final XOR applied)
+ */
+DRV8305_PUBLIC uint32_t drv8305_crc32_words(uint32_t crc, const uint16_t *words, uint32_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRV8305_CRC_H_ */
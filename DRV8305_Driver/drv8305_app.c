@@ -42,14 +42,9 @@
 #include "DRV8305_Control_Registers/drv8305_control_registers_handlers.h"
 #include "DRV8305_API/drv8305_api.h"
 #include "drv8305_app.h"
+#include "drv8305_port.h"
 
-DRV8305_PRIVATE void     hardware_drv8305_io_disable_callback               (void);
-DRV8305_PRIVATE void     hardware_drv8305_io_enable_callback                (void);
-DRV8305_PRIVATE void     hardware_drv8305_sleep_io_enable_callback          (void);
-DRV8305_PRIVATE void     hardware_drv8305_sleep_io_disable_callback         (void);
-DRV8305_PRIVATE bool     hardware_drv8305_get_fault_pin_status_callback     (void);
-DRV8305_PRIVATE uint16_t hardware_spi_write_and_read_from_register_callback (uint16_t data);
-
+#if !defined(DRV8305_STATIC_DISPATCH)
 DRV8305_PRIVATE void     drv8305_warning_callback                           (void *self, uint16_t data);
 DRV8305_PRIVATE void     drv8305_ov_vds_callback                            (void *self, uint16_t data);
 DRV8305_PRIVATE void     drv8305_ic_faults_callback                         (void *self, uint16_t data);
@@ -94,6 +89,10 @@ DRV8305_PRIVATE drv8305_user_object_t user_drv8305_obj =
         .drv8305_vds_sense_control_register_cb         = drv8305_vds_sense_callback
     }
 };
+#else
+/* Hardware I/O and register handlers are bound at compile time through drv8305_port.h */
+DRV8305_PRIVATE drv8305_user_object_t user_drv8305_obj;
+#endif /* DRV8305_STATIC_DISPATCH */
 
 
 /**
@@ -199,102 +198,7 @@ DRV8305_PUBLIC void drv8305_reset(void)
     drv8305_api_initialize(&user_drv8305_obj);
 }
 
-// ============================================================================
-// HARDWARE I/O CALLBACKS - Implementation-specific GPIO and SPI control
-// ============================================================================
-
-/**
- * @brief Disable DRV8305 gate drivers via GPIO (hardware callback)
- * @details Sets EN_GATE GPIO to low, disabling all gate driver outputs.
- *          Uses processor-specific GPIO function: GPIO_writePin()
- * @return None
- * @note Internal callback - mapped to hw_callbacks.drv8305_disable_io
- * @processor_specific Uses GPIO_writePin() from TI C2000 DSP GPIO library
- * @see GPIO_writePin(), EN_GATE (pin definition in board.h)
- */
-DRV8305_PRIVATE void hardware_drv8305_io_disable_callback(void)
-{
-    EN_GATE_DISABLE
-}
-
-/**
- * @brief Enable DRV8305 gate drivers via GPIO (hardware callback)
- * @details Sets EN_GATE GPIO to high, enabling all gate driver outputs.
- *          Uses processor-specific GPIO function: GPIO_writePin()
- * @return None
- * @note Internal callback - mapped to hw_callbacks.drv8305_enable_io
- * @processor_specific Uses GPIO_writePin() from TI C2000 DSP GPIO library
- * @see GPIO_writePin(), EN_GATE (pin definition in board.h)
- */
-DRV8305_PRIVATE void hardware_drv8305_io_enable_callback(void)
-{
-    EN_GATE_ENABLE
-}
-
-/**
- * @brief Wake up DRV8305 from sleep mode (hardware callback)
- * @details Sets DRV_WAKE GPIO to high, releasing sleep mode and enabling normal operation.
- *          Uses processor-specific GPIO function: GPIO_writePin()
- * @return None
- * @note Internal callback - mapped to hw_callbacks.drv8305_wake_up_io
- * @processor_specific Uses GPIO_writePin() from TI C2000 DSP GPIO library
- * @see GPIO_writePin(), DRV_WAKE (pin definition in board.h)
- */
-DRV8305_PRIVATE void hardware_drv8305_sleep_io_enable_callback(void)
-{
-    DRV_WAKE_ENABLE
-}
-
-/**
- * @brief Put DRV8305 into sleep mode (hardware callback)
- * @details Sets DRV_WAKE GPIO to low, placing IC into low-power sleep state.
- *          Uses processor-specific GPIO function: GPIO_writePin()
- * @return None
- * @note Internal callback - mapped to hw_callbacks.drv8305_sleep_io
- * @processor_specific Uses GPIO_writePin() from TI C2000 DSP GPIO library
- * @see GPIO_writePin(), DRV_WAKE (pin definition in board.h)
- */
-DRV8305_PRIVATE void hardware_drv8305_sleep_io_disable_callback(void)
-{    
-    DRV_WAKE_DISABLE
-}
-
-/**
- * @brief Get DRV8305 FAULT pin status (hardware callback)
- * @details Reads the FAULT pin GPIO status to determine if a fault condition exists.
- *          Uses processor-specific GPIO function: GPIO_readPin()
- * @return bool True if FAULT pin is high (no fault), False if low (fault present)
- * @note Internal callback - mapped to hw_callbacks.drv8305_get_fault_pin_status
- * @processor_specific Uses GPIO_readPin() from TI C2000 DSP GPIO library
- * @see GPIO_readPin(), FAULT_PIN_STATUS (pin definition in board.h)
- */
-DRV8305_PRIVATE bool hardware_drv8305_get_fault_pin_status_callback(void)
-{
-    return FAULT_PIN_STATUS
-}
-
-/**
- * @brief Transmit SPI command packet (hardware callback)
- * @details Sends 16-bit command packet to DRV8305 via SPI in blocking mode.
- *          Uses processor-specific SPI function: SPI_transmit16Bits()
- * @param[in] data SPI packet data to transmit
- * @return None
- * @note Internal callback - mapped to hw_callbacks.drv8305_spi_transmit_cb
- * @processor_specific Uses SPI_transmit16Bits() from TI C2000 DSP SPI library
- *                     SPI bus: SPIA (16-bit blocking FIFO mode)
- * @see SPI_transmit16Bits(), SPIA_BASE (SPI configuration in device.h)
- */
-DRV8305_PRIVATE uint16_t hardware_spi_write_and_read_from_register_callback(uint16_t data)
-{
-    uint16_t read_data = 0;
-
-    CS_LOW
-    read_data = SPI_transmit16Bits(SPIA_BASE, data);
-    CS_HIGH
-
-    return read_data;
-}
-
+#if !defined(DRV8305_STATIC_DISPATCH)
 // ============================================================================
 // STATUS REGISTER CALLBACKS - Wrapper functions called during status polling
 // ============================================================================
@@ -435,3 +339,4 @@ DRV8305_PRIVATE void drv8305_vds_sense_callback(void *self, uint16_t data)
 {
     drv8305_vds_sense_register_handler(self, data);
 }
+#endif /* DRV8305_STATIC_DISPATCH */
@@ -10,15 +10,18 @@
  * 
  * @purpose
  * This module provides:
- *   - Visibility control: DRV8305_PRIVATE (static), DRV8305_PUBLIC
+ *   - Visibility control: DRV8305_PRIVATE (static), DRV8305_PUBLIC, DRV8305_INLINE (static inline)
  *   - Timing constants: Register switching delay, status polling interval
  *   - Array indexing: Status/control register array positions
- *   - Utility macros: Callback safety checks
+ *   - Control register field descriptors and tables, with the masks derived from them
+ *   - Utility macros: Callback safety checks, memory barrier hook, shared word access
  * 
  * @timing_constants
  * DRV8305_REGISTER_SWITCH_DELAY_MS: Delay between consecutive SPI register operations (50ms)
  * DRV8305_STANDARD_TASK_DELAY_TIMEOUT: Standard task delay timeout for state machine transitions (50ms)
  * DRV8305_STATUS_POLLING_INTERVAL_MS: Interval for periodic status register polling (250ms)
+ * DRV8305_RECOVERY_BACKOFF_MIN_MS / _MAX_MS: Fault recovery backoff bounds (10ms - 5000ms)
+ * DRV8305_TIMING_PROFILE: STANDARD (gaps above) or BURST (no per-register gaps), fixed at build time
  * DRV8305_NUMBER_OF_REGISTERS: Total registers managed (11: 4 status + 7 control)
  * 
  * @array_indexing
@@ -36,15 +39,88 @@ extern "C" {
 
 #define DRV8305_PUBLIC
 #define DRV8305_PRIVATE static
+#define DRV8305_INLINE  static inline
 
 /** @brief Total number of managed registers (4 status + 7 control)                  */
 #define DRV8305_NUMBER_OF_REGISTERS         (int)11
+/** @brief Number of status registers (0x01 - 0x04)                                   */
+#define DRV8305_NUMBER_OF_STATUS_REGISTERS  (int)4
+/** @brief Number of control registers (0x05, 0x06, 0x07, 0x09, 0x0A, 0x0B, 0x0C)     */
+#define DRV8305_NUMBER_OF_CONTROL_REGISTERS (int)7
+/** @brief Data field of an SPI response frame (bits 10:0)                            */
+#define DRV8305_REGISTER_DATA_MASK          0x07FFU
 /** @brief Interval for periodic status register polling in milliseconds             */
 #define DRV8305_STATUS_POLLING_INTERVAL_MS  (int)250
 /** @brief Standard task delay timeout for state machine transitions in milliseconds */
 #define DRV8305_STANDARD_TASK_DELAY_TIMEOUT (int)500
 /** @brief Delay between consecutive SPI register operations in milliseconds         */
 #define DRV8305_REGISTER_SWITCH_DELAY_MS    (int)50
+/** @brief Maximum copy attempts of a lock-free snapshot read before giving up      */
+#define DRV8305_SNAPSHOT_READ_ATTEMPTS      (int)4
+/** @brief Maximum number of status change subscribers per driver instance          */
+#define DRV8305_STATUS_MAX_SUBSCRIBERS      (int)4
+/** @brief Depth of the status event ring (power of two)                             */
+#ifndef DRV8305_EVENT_RING_DEPTH
+#define DRV8305_EVENT_RING_DEPTH            (int)32
+#endif
+/** @brief Depth of the shared-memory command queue (power of two)                   */
+#define DRV8305_MAILBOX_COMMAND_DEPTH       (int)4
+/** @brief Recent status events in a post-mortem record (power of two, -DDRV8305_POSTMORTEM_EVENTS) */
+#ifndef DRV8305_POSTMORTEM_EVENT_DEPTH
+#define DRV8305_POSTMORTEM_EVENT_DEPTH      (int)8
+#endif
+/** @brief Depth of the SPI trace ring (power of two, -DDRV8305_SPI_TRACE builds)   */
+#ifndef DRV8305_TRACE_DEPTH
+#define DRV8305_TRACE_DEPTH                 (int)64
+#endif
+/** @brief Timestamp of a traced SPI frame (free-running, counting up)              */
+#ifndef DRV8305_TRACE_TIMESTAMP
+#define DRV8305_TRACE_TIMESTAMP(self)       ((self)->state.system_time)
+#endif
+/** @brief Ticks per second of DRV8305_TRACE_TIMESTAMP                              */
+#ifndef DRV8305_TRACE_TIMESTAMP_HZ
+#define DRV8305_TRACE_TIMESTAMP_HZ          (uint32_t)1000
+#endif
+/** @brief Delay between fault recovery steps (clear, verify) in milliseconds        */
+#define DRV8305_RECOVERY_STEP_DELAY_MS      (int)5
+/** @brief First fault recovery backoff in milliseconds (doubled per failed attempt) */
+#define DRV8305_RECOVERY_BACKOFF_MIN_MS     (int)10
+/** @brief Upper bound of the fault recovery backoff in milliseconds                 */
+#define DRV8305_RECOVERY_BACKOFF_MAX_MS     (int)5000
+/** @brief Failed recovery attempts before the recovery latches out                  */
+#define DRV8305_RECOVERY_MAX_ATTEMPTS       (int)5
+/** @brief Delay between SPI operations of a reset re-programming pass in milliseconds */
+#define DRV8305_RESET_STEP_DELAY_MS         (int)1
+/** @brief Re-programming passes after a device reset before giving up              */
+#define DRV8305_RESET_REPROGRAM_ATTEMPTS    (int)3
+/** @brief Default share of SPI frames used by the background scrubber in percent    */
+#define DRV8305_SCRUB_BUDGET_PERCENT        (int)10
+
+/** @brief Timing profile: gaps between the register accesses of a pass or scan      */
+#define DRV8305_TIMING_PROFILE_STANDARD     0
+/** @brief Timing profile: no gaps between the register accesses of a pass or scan   */
+#define DRV8305_TIMING_PROFILE_BURST        1
+
+#ifndef DRV8305_TIMING_PROFILE
+#define DRV8305_TIMING_PROFILE              DRV8305_TIMING_PROFILE_STANDARD
+#endif
+
+#if DRV8305_TIMING_PROFILE == DRV8305_TIMING_PROFILE_BURST
+/** @brief Gap after each control register write/readback in milliseconds           */
+#define DRV8305_CONTROL_REGISTER_GAP_MS     (int)0
+/** @brief Gap after each status register read of a scan in milliseconds             */
+#define DRV8305_STATUS_REGISTER_GAP_MS      (int)0
+/** @brief Gap after each register access of a reset re-programming pass            */
+#define DRV8305_RESET_REGISTER_GAP_MS       (int)0
+#elif DRV8305_TIMING_PROFILE == DRV8305_TIMING_PROFILE_STANDARD
+#define DRV8305_CONTROL_REGISTER_GAP_MS     DRV8305_REGISTER_SWITCH_DELAY_MS
+#define DRV8305_STATUS_REGISTER_GAP_MS      DRV8305_STANDARD_TASK_DELAY_TIMEOUT
+#define DRV8305_RESET_REGISTER_GAP_MS       DRV8305_RESET_STEP_DELAY_MS
+#else
+#error "DRV8305_TIMING_PROFILE must be DRV8305_TIMING_PROFILE_STANDARD or DRV8305_TIMING_PROFILE_BURST"
+#endif
+/** @brief Scrub budget scale, credit spent by one scrub read (100 percent)          */
+#define DRV8305_SCRUB_BUDGET_SCALE          (int)100
 
 /** @brief Array index for Status Register 0x01 (Warning)               */
 #define DRV8305_STATUS_01_ARRAY_INDEX    0U
@@ -69,53 +145,247 @@ extern "C" {
 /** @brief Array index for Control Register 0x0C (VDS Sense)            */
 #define DRV8305_CONTROL_0C_ARRAY_INDEX   10U
 
+/**
+ * @brief Control register field descriptors: array_index, offset, width
+ * @details Single source of every control field position. Pass a descriptor to the
+ *          DRV8305_FIELD_*() macros; masks, packers, accessors and verify masks are derived
+ *          from it, and drv8305_packed_configuration.c rejects overlapping or out-of-word
+ *          fields at build time.
+ */
+#define DRV8305_CTRL05_TDRIVE_FIELD          DRV8305_CONTROL_05_ARRAY_INDEX,  8, 2   /* bits 9:8 */
+#define DRV8305_CTRL05_ISINK_FIELD           DRV8305_CONTROL_05_ARRAY_INDEX,  4, 4   /* bits 7:4 */
+#define DRV8305_CTRL05_ISOURCE_FIELD         DRV8305_CONTROL_05_ARRAY_INDEX,  0, 4   /* bits 3:0 */
+
+#define DRV8305_CTRL06_TDRIVE_FIELD          DRV8305_CONTROL_06_ARRAY_INDEX,  8, 2   /* bits 9:8 */
+#define DRV8305_CTRL06_ISINK_FIELD           DRV8305_CONTROL_06_ARRAY_INDEX,  4, 4   /* bits 7:4 */
+#define DRV8305_CTRL06_ISOURCE_FIELD         DRV8305_CONTROL_06_ARRAY_INDEX,  0, 4   /* bits 3:0 */
+
+#define DRV8305_CTRL07_VCPH_FREQ_FIELD       DRV8305_CONTROL_07_ARRAY_INDEX, 10, 1   /* bit 10   */
+#define DRV8305_CTRL07_COMM_OPTION_FIELD     DRV8305_CONTROL_07_ARRAY_INDEX,  9, 1   /* bit 9    */
+#define DRV8305_CTRL07_PWM_MODE_FIELD        DRV8305_CONTROL_07_ARRAY_INDEX,  7, 2   /* bits 8:7 */
+#define DRV8305_CTRL07_DEAD_TIME_FIELD       DRV8305_CONTROL_07_ARRAY_INDEX,  4, 3   /* bits 6:4 */
+#define DRV8305_CTRL07_TBLANK_FIELD          DRV8305_CONTROL_07_ARRAY_INDEX,  2, 2   /* bits 3:2 */
+#define DRV8305_CTRL07_TVDS_FIELD            DRV8305_CONTROL_07_ARRAY_INDEX,  0, 2   /* bits 1:0 */
+
+#define DRV8305_CTRL09_FLIP_OTSD_FIELD       DRV8305_CONTROL_09_ARRAY_INDEX, 10, 1   /* bit 10   */
+#define DRV8305_CTRL09_DIS_PVDD_UVLO2_FIELD  DRV8305_CONTROL_09_ARRAY_INDEX,  9, 1   /* bit 9    */
+#define DRV8305_CTRL09_DIS_GDRV_FAULT_FIELD  DRV8305_CONTROL_09_ARRAY_INDEX,  8, 1   /* bit 8    */
+#define DRV8305_CTRL09_EN_SNS_CLAMP_FIELD    DRV8305_CONTROL_09_ARRAY_INDEX,  7, 1   /* bit 7    */
+#define DRV8305_CTRL09_WD_DLY_FIELD          DRV8305_CONTROL_09_ARRAY_INDEX,  5, 2   /* bits 6:5 */
+#define DRV8305_CTRL09_DIS_SNS_OCP_FIELD     DRV8305_CONTROL_09_ARRAY_INDEX,  4, 1   /* bit 4    */
+#define DRV8305_CTRL09_WD_EN_FIELD           DRV8305_CONTROL_09_ARRAY_INDEX,  3, 1   /* bit 3    */
+#define DRV8305_CTRL09_SLEEP_FIELD           DRV8305_CONTROL_09_ARRAY_INDEX,  2, 1   /* bit 2    */
+#define DRV8305_CTRL09_CLR_FLTS_FIELD        DRV8305_CONTROL_09_ARRAY_INDEX,  1, 1   /* bit 1    */
+#define DRV8305_CTRL09_SET_VCPH_UV_FIELD     DRV8305_CONTROL_09_ARRAY_INDEX,  0, 1   /* bit 0    */
+
+#define DRV8305_CTRL0A_DC_CAL_CH3_FIELD      DRV8305_CONTROL_0A_ARRAY_INDEX, 10, 1   /* bit 10   */
+#define DRV8305_CTRL0A_DC_CAL_CH2_FIELD      DRV8305_CONTROL_0A_ARRAY_INDEX,  9, 1   /* bit 9    */
+#define DRV8305_CTRL0A_DC_CAL_CH1_FIELD      DRV8305_CONTROL_0A_ARRAY_INDEX,  8, 1   /* bit 8    */
+#define DRV8305_CTRL0A_CS_BLANK_FIELD        DRV8305_CONTROL_0A_ARRAY_INDEX,  6, 2   /* bits 7:6 */
+#define DRV8305_CTRL0A_GAIN_CH3_FIELD        DRV8305_CONTROL_0A_ARRAY_INDEX,  4, 2   /* bits 5:4 */
+#define DRV8305_CTRL0A_GAIN_CH2_FIELD        DRV8305_CONTROL_0A_ARRAY_INDEX,  2, 2   /* bits 3:2 */
+#define DRV8305_CTRL0A_GAIN_CH1_FIELD        DRV8305_CONTROL_0A_ARRAY_INDEX,  0, 2   /* bits 1:0 */
+
+#define DRV8305_CTRL0B_VREF_SCALE_FIELD      DRV8305_CONTROL_0B_ARRAY_INDEX,  8, 2   /* bits 9:8 */
+#define DRV8305_CTRL0B_SLEEP_DELAY_FIELD     DRV8305_CONTROL_0B_ARRAY_INDEX,  3, 2   /* bits 4:3 */
+#define DRV8305_CTRL0B_DIS_VREG_PWRGD_FIELD  DRV8305_CONTROL_0B_ARRAY_INDEX,  2, 1   /* bit 2    */
+#define DRV8305_CTRL0B_VREG_UV_LEVEL_FIELD   DRV8305_CONTROL_0B_ARRAY_INDEX,  0, 2   /* bits 1:0 */
+
+#define DRV8305_CTRL0C_VDS_LEVEL_FIELD       DRV8305_CONTROL_0C_ARRAY_INDEX,  3, 5   /* bits 7:3 */
+#define DRV8305_CTRL0C_VDS_MODE_FIELD        DRV8305_CONTROL_0C_ARRAY_INDEX,  0, 3   /* bits 2:0 */
+
+/** @brief Field descriptor accessors; the argument is a DRV8305_CTRLxx_<NAME>_FIELD **/
+#define DRV8305_FIELD_INDEX(...)             DRV8305_FIELD_INDEX_(__VA_ARGS__)
+#define DRV8305_FIELD_OFFSET(...)            DRV8305_FIELD_OFFSET_(__VA_ARGS__)
+#define DRV8305_FIELD_WIDTH(...)             DRV8305_FIELD_WIDTH_(__VA_ARGS__)
+#define DRV8305_FIELD_MAX(...)               DRV8305_FIELD_MAX_(__VA_ARGS__)
+#define DRV8305_FIELD_MASK(...)              DRV8305_FIELD_MASK_(__VA_ARGS__)
+/** @brief Field value of a register word (branch-free shift and mask) **/
+#define DRV8305_FIELD_GET(word, ...)         DRV8305_FIELD_GET_((word), __VA_ARGS__)
+/** @brief Field value positioned in its register word (value masked to the field width) **/
+#define DRV8305_FIELD_PUT(value, ...)        DRV8305_FIELD_PUT_((value), __VA_ARGS__)
+
+#define DRV8305_FIELD_INDEX_(array_index, offset, width)         (array_index)
+#define DRV8305_FIELD_OFFSET_(array_index, offset, width)        (offset)
+#define DRV8305_FIELD_WIDTH_(array_index, offset, width)         (width)
+#define DRV8305_FIELD_MAX_(array_index, offset, width)           ((1U << (width)) - 1U)
+#define DRV8305_FIELD_MASK_(array_index, offset, width)          (((1U << (width)) - 1U) << (offset))
+#define DRV8305_FIELD_GET_(word, array_index, offset, width)     (((word) >> (offset)) & ((1U << (width)) - 1U))
+#define DRV8305_FIELD_PUT_(value, array_index, offset, width)    (((value) & ((1U << (width)) - 1U)) << (offset))
+
+/**
+ * @brief Control register field tables: X(group, field, descriptor)
+ * @note group/field follow the member names of drv8305_configuration_t; the descriptor reaches
+ *       X as its trailing arguments (array_index, offset, width), so declare X as
+ *       X(group, field, ...) and pass __VA_ARGS__ on to the DRV8305_FIELD_*() macros.
+ */
+#define DRV8305_CTRL05_FIELDS(X)                                               \
+    X(hs_gate_drive,     tdrive,         DRV8305_CTRL05_TDRIVE_FIELD)          \
+    X(hs_gate_drive,     isink,          DRV8305_CTRL05_ISINK_FIELD)           \
+    X(hs_gate_drive,     isource,        DRV8305_CTRL05_ISOURCE_FIELD)
+
+#define DRV8305_CTRL06_FIELDS(X)                                               \
+    X(ls_gate_drive,     tdrive,         DRV8305_CTRL06_TDRIVE_FIELD)          \
+    X(ls_gate_drive,     isink,          DRV8305_CTRL06_ISINK_FIELD)           \
+    X(ls_gate_drive,     isource,        DRV8305_CTRL06_ISOURCE_FIELD)
+
+#define DRV8305_CTRL07_FIELDS(X)                                               \
+    X(gate_drive,        vcph_freq,      DRV8305_CTRL07_VCPH_FREQ_FIELD)       \
+    X(gate_drive,        comm_option,    DRV8305_CTRL07_COMM_OPTION_FIELD)     \
+    X(gate_drive,        pwm_mode,       DRV8305_CTRL07_PWM_MODE_FIELD)        \
+    X(gate_drive,        dead_time,      DRV8305_CTRL07_DEAD_TIME_FIELD)       \
+    X(gate_drive,        tblank,         DRV8305_CTRL07_TBLANK_FIELD)          \
+    X(gate_drive,        tvds,           DRV8305_CTRL07_TVDS_FIELD)
+
+#define DRV8305_CTRL09_FIELDS(X)                                               \
+    X(ic_operation,      flip_otsd,      DRV8305_CTRL09_FLIP_OTSD_FIELD)       \
+    X(ic_operation,      dis_pvdd_uvlo2, DRV8305_CTRL09_DIS_PVDD_UVLO2_FIELD)  \
+    X(ic_operation,      dis_gdrv_fault, DRV8305_CTRL09_DIS_GDRV_FAULT_FIELD)  \
+    X(ic_operation,      en_sns_clamp,   DRV8305_CTRL09_EN_SNS_CLAMP_FIELD)    \
+    X(ic_operation,      wd_dly,         DRV8305_CTRL09_WD_DLY_FIELD)          \
+    X(ic_operation,      dis_sns_ocp,    DRV8305_CTRL09_DIS_SNS_OCP_FIELD)     \
+    X(ic_operation,      wd_en,          DRV8305_CTRL09_WD_EN_FIELD)           \
+    X(ic_operation,      sleep,          DRV8305_CTRL09_SLEEP_FIELD)           \
+    X(ic_operation,      clr_flts,       DRV8305_CTRL09_CLR_FLTS_FIELD)        \
+    X(ic_operation,      set_vcph_uv,    DRV8305_CTRL09_SET_VCPH_UV_FIELD)
+
+#define DRV8305_CTRL0A_FIELDS(X)                                               \
+    X(shunt_amplifier,   dc_cal_ch3,     DRV8305_CTRL0A_DC_CAL_CH3_FIELD)      \
+    X(shunt_amplifier,   dc_cal_ch2,     DRV8305_CTRL0A_DC_CAL_CH2_FIELD)      \
+    X(shunt_amplifier,   dc_cal_ch1,     DRV8305_CTRL0A_DC_CAL_CH1_FIELD)      \
+    X(shunt_amplifier,   cs_blank,       DRV8305_CTRL0A_CS_BLANK_FIELD)        \
+    X(shunt_amplifier,   gain_cs3,       DRV8305_CTRL0A_GAIN_CH3_FIELD)        \
+    X(shunt_amplifier,   gain_cs2,       DRV8305_CTRL0A_GAIN_CH2_FIELD)        \
+    X(shunt_amplifier,   gain_cs1,       DRV8305_CTRL0A_GAIN_CH1_FIELD)
+
+#define DRV8305_CTRL0B_FIELDS(X)                                               \
+    X(voltage_regulator, vref_scale,     DRV8305_CTRL0B_VREF_SCALE_FIELD)      \
+    X(voltage_regulator, sleep_dly,      DRV8305_CTRL0B_SLEEP_DELAY_FIELD)     \
+    X(voltage_regulator, dis_vreg_pwrgd, DRV8305_CTRL0B_DIS_VREG_PWRGD_FIELD)  \
+    X(voltage_regulator, vreg_uv_level,  DRV8305_CTRL0B_VREG_UV_LEVEL_FIELD)
+
+#define DRV8305_CTRL0C_FIELDS(X)                                               \
+    X(vds_sense,         vds_level,      DRV8305_CTRL0C_VDS_LEVEL_FIELD)       \
+    X(vds_sense,         vds_mode,       DRV8305_CTRL0C_VDS_MODE_FIELD)
+
+/** @brief Every control register field, in programming order **/
+#define DRV8305_CONTROL_REGISTER_FIELDS(X)                                     \
+    DRV8305_CTRL05_FIELDS(X) DRV8305_CTRL06_FIELDS(X) DRV8305_CTRL07_FIELDS(X) \
+    DRV8305_CTRL09_FIELDS(X) DRV8305_CTRL0A_FIELDS(X) DRV8305_CTRL0B_FIELDS(X) \
+    DRV8305_CTRL0C_FIELDS(X)
+
+/** @brief Field table terms: OR / sum of the field masks of one register **/
+#define DRV8305_FIELD_OR_TERM(group, field, ...)   | DRV8305_FIELD_MASK(__VA_ARGS__)
+#define DRV8305_FIELD_SUM_TERM(group, field, ...)  + DRV8305_FIELD_MASK(__VA_ARGS__)
+/** @brief Every field bit of a control register (reg: CTRL05 ... CTRL0C) **/
+#define DRV8305_FIELD_BITS(reg)                    (0U DRV8305_##reg##_FIELDS(DRV8305_FIELD_OR_TERM))
+
 /** @brief Control register 05 and 06 masks **/
-#define DRV8305_CTRL05_CTRL06_TDRIVE_MASK   (0x03u << 8)  /* bits 9:8 */
-#define DRV8305_CTRL05_CTRL06_ISINK_MASK    (0x0Fu << 4)  /* bits 7:4 */
-#define DRV8305_CTRL05_CTRL06_ISOURCE_MASK  (0x0Fu << 0)  /* bits 3:0 */
+#define DRV8305_CTRL05_CTRL06_TDRIVE_MASK   DRV8305_FIELD_MASK(DRV8305_CTRL05_TDRIVE_FIELD)
+#define DRV8305_CTRL05_CTRL06_ISINK_MASK    DRV8305_FIELD_MASK(DRV8305_CTRL05_ISINK_FIELD)
+#define DRV8305_CTRL05_CTRL06_ISOURCE_MASK  DRV8305_FIELD_MASK(DRV8305_CTRL05_ISOURCE_FIELD)
 
 /** @brief Control register 07 masks **/
-#define DRV8305_CTRL07_VCPH_FREQ_MASK       (0x01u << 10) /* bits 10  */
-#define DRV8305_CTRL07_COMM_OPTION_MASK     (0x01u << 9)  /* bits 9   */
-#define DRV8305_CTRL07_PWM_MODE_MASK        (0x03u << 7)  /* bits 8:7 */  
-#define DRV8305_CTRL07_DEAD_TIME_MASK       (0x07u << 4)  /* bits 6:4 */
-#define DRV8305_CTRL07_TBLANK_MASK          (0x03u << 2)  /* bits 3:2 */
-#define DRV8305_CTRL07_TVDS_MASK            (0x03u << 0)  /* bits 1:0 */
+#define DRV8305_CTRL07_VCPH_FREQ_MASK       DRV8305_FIELD_MASK(DRV8305_CTRL07_VCPH_FREQ_FIELD)
+#define DRV8305_CTRL07_COMM_OPTION_MASK     DRV8305_FIELD_MASK(DRV8305_CTRL07_COMM_OPTION_FIELD)
+#define DRV8305_CTRL07_PWM_MODE_MASK        DRV8305_FIELD_MASK(DRV8305_CTRL07_PWM_MODE_FIELD)
+#define DRV8305_CTRL07_DEAD_TIME_MASK       DRV8305_FIELD_MASK(DRV8305_CTRL07_DEAD_TIME_FIELD)
+#define DRV8305_CTRL07_TBLANK_MASK          DRV8305_FIELD_MASK(DRV8305_CTRL07_TBLANK_FIELD)
+#define DRV8305_CTRL07_TVDS_MASK            DRV8305_FIELD_MASK(DRV8305_CTRL07_TVDS_FIELD)
 
 /** @brief Control register 09 masks **/
-#define DRV8305_CTRL09_FLIP_OTSD_MASK       (0x01u << 10) /* bit 10   */
-#define DRV8305_CTRL09_DIS_PVDD_UVLO2_MASK  (0x01u << 9)  /* bit 9    */
-#define DRV8305_CTRL09_DIS_GDRV_FAULT_MASK  (0x01u << 8)  /* bit 8    */
-#define DRV8305_CTRL09_EN_SNS_CLAMP_MASK    (0x01u << 7)  /* bit 7    */
-#define DRV8305_CTRL09_WD_DLY_MASK          (0x03u << 5)  /* bits 6:5 */
-#define DRV8305_CTRL09_DIS_SNS_OCP_MASK     (0x01u << 4)  /* bit 4    */
-#define DRV8305_CTRL09_WD_EN_MASK           (0x01u << 3)  /* bit 3    */
-#define DRV8305_CTRL09_SLEEP_MASK           (0x01u << 2)  /* bit 2    */
-#define DRV8305_CTRL09_CLR_FLTS_MASK        (0x01u << 1)  /* bit 1    */
-#define DRV8305_CTRL09_SET_VCPH_UV_MASK     (0x01u << 0)  /* bit 0    */
+#define DRV8305_CTRL09_FLIP_OTSD_MASK       DRV8305_FIELD_MASK(DRV8305_CTRL09_FLIP_OTSD_FIELD)
+#define DRV8305_CTRL09_DIS_PVDD_UVLO2_MASK  DRV8305_FIELD_MASK(DRV8305_CTRL09_DIS_PVDD_UVLO2_FIELD)
+#define DRV8305_CTRL09_DIS_GDRV_FAULT_MASK  DRV8305_FIELD_MASK(DRV8305_CTRL09_DIS_GDRV_FAULT_FIELD)
+#define DRV8305_CTRL09_EN_SNS_CLAMP_MASK    DRV8305_FIELD_MASK(DRV8305_CTRL09_EN_SNS_CLAMP_FIELD)
+#define DRV8305_CTRL09_WD_DLY_MASK          DRV8305_FIELD_MASK(DRV8305_CTRL09_WD_DLY_FIELD)
+#define DRV8305_CTRL09_DIS_SNS_OCP_MASK     DRV8305_FIELD_MASK(DRV8305_CTRL09_DIS_SNS_OCP_FIELD)
+#define DRV8305_CTRL09_WD_EN_MASK           DRV8305_FIELD_MASK(DRV8305_CTRL09_WD_EN_FIELD)
+#define DRV8305_CTRL09_SLEEP_MASK           DRV8305_FIELD_MASK(DRV8305_CTRL09_SLEEP_FIELD)
+#define DRV8305_CTRL09_CLR_FLTS_MASK        DRV8305_FIELD_MASK(DRV8305_CTRL09_CLR_FLTS_FIELD)
+#define DRV8305_CTRL09_SET_VCPH_UV_MASK     DRV8305_FIELD_MASK(DRV8305_CTRL09_SET_VCPH_UV_FIELD)
 
 /** @brief Control register 0A masks **/
-#define DRV8305_CTRL0A_DC_CAL_CH3_MASK      (0x01u << 10) /* bit 10   */
-#define DRV8305_CTRL0A_DC_CAL_CH2_MASK      (0x01u << 9)  /* bit 9    */
-#define DRV8305_CTRL0A_DC_CAL_CH1_MASK      (0x01u << 8)  /* bit 8    */
-#define DRV8305_CTRL0A_CS_BLANK_MASK        (0x03u << 6)  /* bits 7:6 */
-#define DRV8305_CTRL0A_GAIN_CH3_MASK        (0x07u << 4)  /* bits 5:4 */
-#define DRV8305_CTRL0A_GAIN_CH2_MASK        (0x07u << 2)  /* bits 3:2 */
-#define DRV8305_CTRL0A_GAIN_CH1_MASK        (0x07u << 0)  /* bits 1:0 */
+#define DRV8305_CTRL0A_DC_CAL_CH3_MASK      DRV8305_FIELD_MASK(DRV8305_CTRL0A_DC_CAL_CH3_FIELD)
+#define DRV8305_CTRL0A_DC_CAL_CH2_MASK      DRV8305_FIELD_MASK(DRV8305_CTRL0A_DC_CAL_CH2_FIELD)
+#define DRV8305_CTRL0A_DC_CAL_CH1_MASK      DRV8305_FIELD_MASK(DRV8305_CTRL0A_DC_CAL_CH1_FIELD)
+#define DRV8305_CTRL0A_CS_BLANK_MASK        DRV8305_FIELD_MASK(DRV8305_CTRL0A_CS_BLANK_FIELD)
+#define DRV8305_CTRL0A_GAIN_CH3_MASK        DRV8305_FIELD_MASK(DRV8305_CTRL0A_GAIN_CH3_FIELD)
+#define DRV8305_CTRL0A_GAIN_CH2_MASK        DRV8305_FIELD_MASK(DRV8305_CTRL0A_GAIN_CH2_FIELD)
+#define DRV8305_CTRL0A_GAIN_CH1_MASK        DRV8305_FIELD_MASK(DRV8305_CTRL0A_GAIN_CH1_FIELD)
 
 /** @brief Control register 0B masks **/
-#define DRV8305_CTRL0B_VREF_SCALE_MASK      (0x03u << 8)  /* bits 9:8 */
-#define DRV8305_CTRL0B_SLEEP_DELAY_MASK     (0x03u << 3)  /* bits 4:3 */
-#define DRV8305_CTRL0B_DIS_VREG_PWRGD_MASK  (0x01u << 2)  /* bit 2    */
-#define DRV8305_CTRL0B_VREG_UV_LEVEL_MASK   (0x03u << 0)  /* bits 1:0 */
+#define DRV8305_CTRL0B_VREF_SCALE_MASK      DRV8305_FIELD_MASK(DRV8305_CTRL0B_VREF_SCALE_FIELD)
+#define DRV8305_CTRL0B_SLEEP_DELAY_MASK     DRV8305_FIELD_MASK(DRV8305_CTRL0B_SLEEP_DELAY_FIELD)
+#define DRV8305_CTRL0B_DIS_VREG_PWRGD_MASK  DRV8305_FIELD_MASK(DRV8305_CTRL0B_DIS_VREG_PWRGD_FIELD)
+#define DRV8305_CTRL0B_VREG_UV_LEVEL_MASK   DRV8305_FIELD_MASK(DRV8305_CTRL0B_VREG_UV_LEVEL_FIELD)
 
 /** @brief Control register 0C masks **/
-#define DRV8305_CTRL0C_VDS_LEVEL_MASK      (0x1Fu << 3)   /* bits 7:3 */
-#define DRV8305_CTRL0C_VDS_MODE_MASK       (0x07u << 0)   /* bits 2:0 */
+#define DRV8305_CTRL0C_VDS_LEVEL_MASK       DRV8305_FIELD_MASK(DRV8305_CTRL0C_VDS_LEVEL_FIELD)
+#define DRV8305_CTRL0C_VDS_MODE_MASK        DRV8305_FIELD_MASK(DRV8305_CTRL0C_VDS_MODE_FIELD)
+
+/** @brief Control register readback verify masks (every field bit; CLR_FLTS self-clears) **/
+#define DRV8305_CTRL05_VERIFY_MASK  DRV8305_FIELD_BITS(CTRL05)
+#define DRV8305_CTRL06_VERIFY_MASK  DRV8305_FIELD_BITS(CTRL06)
+#define DRV8305_CTRL07_VERIFY_MASK  DRV8305_FIELD_BITS(CTRL07)
+#define DRV8305_CTRL09_VERIFY_MASK  (DRV8305_FIELD_BITS(CTRL09) & ~DRV8305_CTRL09_CLR_FLTS_MASK)
+#define DRV8305_CTRL0A_VERIFY_MASK  DRV8305_FIELD_BITS(CTRL0A)
+#define DRV8305_CTRL0B_VERIFY_MASK  DRV8305_FIELD_BITS(CTRL0B)
+#define DRV8305_CTRL0C_VERIFY_MASK  DRV8305_FIELD_BITS(CTRL0C)
 
 /** @brief Safe callback invocation macro - only calls if callback is non-NULL */
 #define DRV8305_NULL_CALLBACK_SAFETY(callback)  do { if((callback) != NULL) { (callback)(); } } while(0)
 
+/**
+ * @brief Memory barrier hook used by lock-free publication between execution contexts
+ * @note Define before including this header to use a target-specific barrier
+ *       (e.g. a dual-core fence). Single-core targets only need volatile ordering.
+ *       Without a C11 or GNU fence the hook is empty and DRV8305_MEMORY_BARRIER_NONE is
+ *       defined; the mailbox refuses to build then (e.g. TI C2000 cl2000).
+ */
+#ifndef DRV8305_MEMORY_BARRIER
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_ATOMICS__)
+#include <stdatomic.h>
+#define DRV8305_MEMORY_BARRIER()  atomic_thread_fence(memory_order_seq_cst)
+#elif defined(__GNUC__)
+#define DRV8305_MEMORY_BARRIER()  __sync_synchronize()
+#else
+#define DRV8305_MEMORY_BARRIER()  do { } while(0)
+#define DRV8305_MEMORY_BARRIER_NONE
+#endif
+#endif
+
+/**
+ * @brief Words shared between execution contexts (ring indices, sequence counters, seqlock payload)
+ * @note C11 builds with atomics get _Atomic words: DRV8305_SHARED_LOAD() is an acquire load,
+ *       DRV8305_SHARED_STORE() a release store, the _RELAXED forms carry no ordering and the
+ *       fences are C11 fences. Other builds (C99, TI cl2000) get volatile words, and the fences
+ *       fall back to DRV8305_MEMORY_BARRIER(). Every context sharing a structure must include
+ *       this header with the same language standard.
+ */
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_ATOMICS__)
+#include <stdint.h>
+#include <stdatomic.h>
+typedef _Atomic uint32_t drv8305_shared_u32_t;
+typedef _Atomic uint16_t drv8305_shared_u16_t;
+#define DRV8305_SHARED_LOAD(word)                  atomic_load_explicit(&(word), memory_order_acquire)
+#define DRV8305_SHARED_STORE(word, value)          atomic_store_explicit(&(word), (value), memory_order_release)
+#define DRV8305_SHARED_LOAD_RELAXED(word)          atomic_load_explicit(&(word), memory_order_relaxed)
+#define DRV8305_SHARED_STORE_RELAXED(word, value)  atomic_store_explicit(&(word), (value), memory_order_relaxed)
+#define DRV8305_ACQUIRE_FENCE()                    atomic_thread_fence(memory_order_acquire)
+#define DRV8305_RELEASE_FENCE()                    atomic_thread_fence(memory_order_release)
+#else
+#include <stdint.h>
+typedef volatile uint32_t drv8305_shared_u32_t;
+typedef volatile uint16_t drv8305_shared_u16_t;
+#define DRV8305_SHARED_LOAD(word)                  (word)
+#define DRV8305_SHARED_STORE(word, value)          ((word) = (value))
+#define DRV8305_SHARED_LOAD_RELAXED(word)          (word)
+#define DRV8305_SHARED_STORE_RELAXED(word, value)  ((word) = (value))
+#define DRV8305_ACQUIRE_FENCE()                    DRV8305_MEMORY_BARRIER()
+#define DRV8305_RELEASE_FENCE()                    DRV8305_MEMORY_BARRIER()
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,202 @@
+/**
+ * @file drv8305_port.h
+ * @brief DRV8305 Port - TI C2000 Board Binding for Callback and Static Dispatch
+ * @details Hardware I/O of the reference TI C2000 board (EN_GATE, DRV_WAKE, nFAULT and SPIA)
+ *          and the register handler routing, shared by both dispatch modes of the driver.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * Callback dispatch (default): drv8305_app.c stores the hardware_*() functions below in the
+ * hw_callbacks table of the user object.
+ * Static dispatch (-DDRV8305_STATIC_DISPATCH): drv8305_dispatch.h includes this header into
+ * drv8305_api.c and the DRV8305_PORT_*() macros bind every SPI frame, GPIO access and register
+ * notification at compile time, without going through a function pointer.
+ *
+ * @porting
+ * Copy this header for another board, keep the DRV8305_PORT_*() names and replace the bodies.
+ * A different file can be selected with -DDRV8305_PORT_HEADER="\"my_port.h\"".
+ */
+
+#ifndef DRV8305_PORT_H_
+#define DRV8305_PORT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* HARDWARE PLATFORM INCLUDES - TI C2000 DSP DriverLib and Board Support */
+#include "driverlib.h"
+#include "device.h"
+#include "board.h"
+
+/* DRV8305 INCLUDES */
+#include "drv8305_macros.h"
+#include "DRV8305_Status_Registers/drv8305_status_registers_handlers.h"
+#include "DRV8305_Control_Registers/drv8305_control_registers_handlers.h"
+
+// ============================================================================
+// HARDWARE I/O CALLBACKS - Implementation-specific GPIO and SPI control
+// ============================================================================
+
+/**
+ * @brief Disable DRV8305 gate drivers via GPIO (hardware callback)
+ * @details Sets EN_GATE GPIO to low, disabling all gate driver outputs.
+ *          Uses processor-specific GPIO function: GPIO_writePin()
+ * @return None
+ * @note Internal callback - mapped to hw_callbacks.drv8305_disable_io
+ * @processor_specific Uses GPIO_writePin() from TI C2000 DSP GPIO library
+ * @see GPIO_writePin(), EN_GATE (pin definition in board.h)
+ */
+DRV8305_INLINE void hardware_drv8305_io_disable_callback(void)
+{
+    EN_GATE_DISABLE
+}
+
+/**
+ * @brief Enable DRV8305 gate drivers via GPIO (hardware callback)
+ * @details Sets EN_GATE GPIO to high, enabling all gate driver outputs.
+ *          Uses processor-specific GPIO function: GPIO_writePin()
+ * @return None
+ * @note Internal callback - mapped to hw_callbacks.drv8305_enable_io
+ * @processor_specific Uses GPIO_writePin() from TI C2000 DSP GPIO library
+ * @see GPIO_writePin(), EN_GATE (pin definition in board.h)
+ */
+DRV8305_INLINE void hardware_drv8305_io_enable_callback(void)
+{
+    EN_GATE_ENABLE
+}
+
+/**
+ * @brief Wake up DRV8305 from sleep mode (hardware callback)
+ * @details Sets DRV_WAKE GPIO to high, releasing sleep mode and enabling normal operation.
+ *          Uses processor-specific GPIO function: GPIO_writePin()
+ * @return None
+ * @note Internal callback - mapped to hw_callbacks.drv8305_wake_up_io
+ * @processor_specific Uses GPIO_writePin() from TI C2000 DSP GPIO library
+ * @see GPIO_writePin(), DRV_WAKE (pin definition in board.h)
+ */
+DRV8305_INLINE void hardware_drv8305_sleep_io_enable_callback(void)
+{
+    DRV_WAKE_ENABLE
+}
+
+/**
+ * @brief Put DRV8305 into sleep mode (hardware callback)
+ * @details Sets DRV_WAKE GPIO to low, placing IC into low-power sleep state.
+ *          Uses processor-specific GPIO function: GPIO_writePin()
+ * @return None
+ * @note Internal callback - mapped to hw_callbacks.drv8305_sleep_io
+ * @processor_specific Uses GPIO_writePin() from TI C2000 DSP GPIO library
+ * @see GPIO_writePin(), DRV_WAKE (pin definition in board.h)
+ */
+DRV8305_INLINE void hardware_drv8305_sleep_io_disable_callback(void)
+{
+    DRV_WAKE_DISABLE
+}
+
+/**
+ * @brief Get DRV8305 FAULT pin status (hardware callback)
+ * @details Reads the FAULT pin GPIO status to determine if a fault condition exists.
+ *          Uses processor-specific GPIO function: GPIO_readPin()
+ * @return bool True if FAULT pin is high (no fault), False if low (fault present)
+ * @note Internal callback - mapped to hw_callbacks.drv8305_get_fault_pin_status
+ * @processor_specific Uses GPIO_readPin() from TI C2000 DSP GPIO library
+ * @see GPIO_readPin(), FAULT_PIN_STATUS (pin definition in board.h)
+ */
+DRV8305_INLINE bool hardware_drv8305_get_fault_pin_status_callback(void)
+{
+    return FAULT_PIN_STATUS
+}
+
+/**
+ * @brief Transmit SPI command packet (hardware callback)
+ * @details Sends 16-bit command packet to DRV8305 via SPI in blocking mode.
+ *          Uses processor-specific SPI function: SPI_transmit16Bits()
+ * @param[in] data SPI packet data to transmit
+ * @return None
+ * @note Internal callback - mapped to hw_callbacks.drv8305_spi_transmit_cb
+ * @processor_specific Uses SPI_transmit16Bits() from TI C2000 DSP SPI library
+ *                     SPI bus: SPIA (16-bit blocking FIFO mode)
+ * @see SPI_transmit16Bits(), SPIA_BASE (SPI configuration in device.h)
+ */
+DRV8305_INLINE uint16_t hardware_spi_write_and_read_from_register_callback(uint16_t data)
+{
+    uint16_t read_data = 0;
+
+    CS_LOW
+    read_data = SPI_transmit16Bits(SPIA_BASE, data);
+    CS_HIGH
+
+    return read_data;
+}
+
+// ============================================================================
+// REGISTER NOTIFICATIONS - Handler routing used by static dispatch
+// ============================================================================
+
+/**
+ * @brief Route a status register frame to its handler (static dispatch)
+ * @param[in] self Pointer to DRV8305 user object
+ * @param[in] status_index Status register index (DRV8305_STATUS_0x_ARRAY_INDEX)
+ * @param[in] data Raw status frame
+ * @return None
+ * @note Replaces status_callbacks when DRV8305_STATIC_DISPATCH is defined
+ */
+DRV8305_INLINE void drv8305_port_status_notify(void *self, uint16_t status_index, uint16_t data)
+{
+    switch (status_index)
+    {
+        case DRV8305_STATUS_01_ARRAY_INDEX: { drv8305_warning_register_handler(self, data);    break; }
+        case DRV8305_STATUS_02_ARRAY_INDEX: { drv8305_ov_vds_register_handler(self, data);     break; }
+        case DRV8305_STATUS_03_ARRAY_INDEX: { drv8305_ic_faults_register_handler(self, data);  break; }
+        case DRV8305_STATUS_04_ARRAY_INDEX: { drv8305_vgs_faults_register_handler(self, data); break; }
+        default:                            { break; }
+    }
+}
+
+/**
+ * @brief Route a control register readback to its handler (static dispatch)
+ * @param[in] self Pointer to DRV8305 user object
+ * @param[in] array_index Control register index (DRV8305_CONTROL_xx_ARRAY_INDEX)
+ * @param[in] data Raw readback frame
+ * @return None
+ * @note Replaces control_callbacks when DRV8305_STATIC_DISPATCH is defined
+ */
+DRV8305_INLINE void drv8305_port_control_notify(void *self, uint16_t array_index, uint16_t data)
+{
+    switch (array_index)
+    {
+        case DRV8305_CONTROL_05_ARRAY_INDEX: { drv8305_hs_gate_drive_register_handler(self, data);     break; }
+        case DRV8305_CONTROL_06_ARRAY_INDEX: { drv8305_ls_gate_drive_register_handler(self, data);     break; }
+        case DRV8305_CONTROL_07_ARRAY_INDEX: { drv8305_gate_drive_register_handler(self, data);        break; }
+        case DRV8305_CONTROL_09_ARRAY_INDEX: { drv8305_ic_operation_register_handler(self, data);      break; }
+        case DRV8305_CONTROL_0A_ARRAY_INDEX: { drv8305_shunt_amplifier_register_handler(self, data);   break; }
+        case DRV8305_CONTROL_0B_ARRAY_INDEX: { drv8305_voltage_regulator_register_handler(self, data); break; }
+        case DRV8305_CONTROL_0C_ARRAY_INDEX: { drv8305_vds_sense_register_handler(self, data);         break; }
+        default:                             { break; }
+    }
+}
+
+// ============================================================================
+// STATIC DISPATCH BINDING - Consumed by DRV8305_API/drv8305_dispatch.h
+// ============================================================================
+
+#define DRV8305_PORT_SPI_TRANSFER(self, frame)          hardware_spi_write_and_read_from_register_callback(frame)
+#define DRV8305_PORT_ENABLE_IO(self)                    hardware_drv8305_io_enable_callback()
+#define DRV8305_PORT_DISABLE_IO(self)                   hardware_drv8305_io_disable_callback()
+#define DRV8305_PORT_SLEEP_IO(self)                     hardware_drv8305_sleep_io_disable_callback()
+#define DRV8305_PORT_WAKE_UP_IO(self)                   hardware_drv8305_sleep_io_enable_callback()
+#define DRV8305_PORT_STATUS_NOTIFY(self, index, data)   drv8305_port_status_notify(self, index, data)
+#define DRV8305_PORT_CONTROL_NOTIFY(self, index, data)  drv8305_port_control_notify(self, index, data)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRV8305_PORT_H_ */
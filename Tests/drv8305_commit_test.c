@@ -0,0 +1,175 @@
+/**
+ * @file drv8305_commit_test.c
+ * @brief DRV8305 Staged Configuration Commit Unit Test (Host)
+ * @details Runs staged profile commits against the behavioral simulator with a control
+ *          register that does not take the write, and checks the rollback outcomes.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ *   1. Cold start: configuration confirmed, the device holds the programmed words
+ *   2. Accepted commit: a new dead time in Control 0x07 becomes active (DRV8305_COMMIT_DONE)
+ *   3. Rejected commit: 0x07 ignores writes (stuck), the verify fails and the previous words
+ *      are written back and verified (DRV8305_COMMIT_ROLLED_BACK)
+ *   4. Failed rollback: 0x07 stuck at an upset word matching neither profile, so the
+ *      rollback verify fails as well (DRV8305_COMMIT_FAILED)
+ * Each rollback must leave the previously active words in config and only write 0x07.
+ *
+ * @usage
+ * drv8305_commit_test   (exit code 0 when every check passes)
+ *
+ * @build
+ * CMake target drv8305_commit_test, or from this directory:
+ *   gcc -std=c99 -O2 -I../DRV8305_Driver -I../Tools/drv8305_simulator drv8305_commit_test.c
+ *       drv8305_test_support.c ../Tools/drv8305_simulator/drv8305_simulator.c <driver sources> -o drv8305_commit_test
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "drv8305_macros.h"
+#include "drv8305_register_map.h"
+#include "DRV8305_API/drv8305_api.h"
+#include "DRV8305_Config/drv8305_packed_configuration.h"
+#include "drv8305_simulator.h"
+#include "drv8305_test_support.h"
+
+/** @brief Simulated milliseconds one step may take before the test fails */
+#define TEST_STEP_MS  (uint32_t)10000
+/** @brief Upset pattern for Control 0x07: the TVDS field, outside the dead time */
+#define TEST_UPSET    (uint16_t)DRV8305_CTRL07_TVDS_MASK
+
+DRV8305_PRIVATE drv8305_commit_status_e test_commit         (uint16_t dead_time, drv8305_packed_configuration_t *previous);
+DRV8305_PRIVATE void                    test_step           (void);
+DRV8305_PRIVATE bool                    test_programmed     (const drv8305_packed_configuration_t *cfg);
+DRV8305_PRIVATE uint32_t                test_control_writes (void);
+
+DRV8305_PRIVATE drv8305_sim_t         test_sim;
+DRV8305_PRIVATE drv8305_user_object_t test_drv8305_obj;
+
+int main(void)
+{
+    drv8305_packed_configuration_t previous;
+    drv8305_commit_status_e        status;
+    uint32_t                       writes;
+    uint32_t                       writes_07;
+
+    drv8305_test_start(&test_sim, &test_drv8305_obj);
+    drv8305_api_confirm_configuration(&test_drv8305_obj);
+
+    /* 1. Cold start */
+    for(uint32_t tick = 0; tick < TEST_STEP_MS && !drv8305_api_is_configuration_confirm(&test_drv8305_obj); tick++) { test_step(); }
+
+    drv8305_test_check(drv8305_api_is_configuration_confirm(&test_drv8305_obj), "cold start: configuration confirmed");
+    drv8305_test_check(test_programmed(&test_drv8305_obj.config), "cold start: device holds the programmed words");
+
+    /* 2. Accepted commit */
+    status = test_commit(DRV8305_DEADTIME_88NS, &previous);
+
+    drv8305_test_check(status == DRV8305_COMMIT_DONE, "accepted: DRV8305_COMMIT_DONE");
+    drv8305_test_check(drv8305_packed_get_gate_drive_dead_time(&test_drv8305_obj.config) == DRV8305_DEADTIME_88NS, "accepted: staged dead time active");
+    drv8305_test_check(test_programmed(&test_drv8305_obj.config), "accepted: device holds the staged words");
+
+    /* 3. Rejected commit: the write does not take, the rollback restores the previous words */
+    drv8305_sim_inject(&test_sim, DRV8305_SIM_STICK, DRV8305_CONTROL_07_REG_ADDR, 0);
+    writes    = test_control_writes();
+    writes_07 = test_sim.writes[DRV8305_CONTROL_07_REG_ADDR];
+    status    = test_commit(DRV8305_DEADTIME_440NS, &previous);
+
+    drv8305_test_check(status == DRV8305_COMMIT_ROLLED_BACK, "rejected: DRV8305_COMMIT_ROLLED_BACK");
+    drv8305_test_check(drv8305_configuration_diff(NULL, &previous, &test_drv8305_obj.config) == 0, "rejected: previous words active again");
+    drv8305_test_check(test_programmed(&previous), "rejected: device holds the previous words");
+    drv8305_test_check(test_drv8305_obj.commit.register_mask == DRV8305_CONTROL_REGISTER_BIT(DRV8305_CONTROL_07_ARRAY_INDEX), "rejected: only 0x07 committed");
+    drv8305_test_check(test_sim.writes[DRV8305_CONTROL_07_REG_ADDR] - writes_07 == 2U, "rejected: 0x07 written for the commit and the rollback");
+    drv8305_test_check(test_control_writes() - writes == 2U, "rejected: no other control register written");
+
+    /* 4. Failed rollback: 0x07 holds a word of neither profile and keeps it */
+    drv8305_sim_inject(&test_sim, DRV8305_SIM_CORRUPT, DRV8305_CONTROL_07_REG_ADDR, TEST_UPSET);
+    status = test_commit(DRV8305_DEADTIME_440NS, &previous);
+
+    drv8305_test_check(status == DRV8305_COMMIT_FAILED, "failed rollback: DRV8305_COMMIT_FAILED");
+    drv8305_test_check(drv8305_configuration_diff(NULL, &previous, &test_drv8305_obj.config) == 0, "failed rollback: previous words active");
+    drv8305_test_check(drv8305_api_commit_configuration(&test_drv8305_obj), "failed rollback: next commit accepted");
+
+    printf("{\"simulated_ms\":%lu,\"writes_0x07\":%lu,\"failures\":%d}\n",
+           (unsigned long)test_sim.time, (unsigned long)test_sim.writes[DRV8305_CONTROL_07_REG_ADDR], drv8305_test_failures());
+
+    return (drv8305_test_failures() == 0) ? 0 : 1;
+}
+
+/**
+ * @brief Stage a dead time, commit it and run until the commit concludes
+ * @param[in] dead_time drv8305_deadtime_e value for Control 0x07
+ * @param[out] previous Active profile before the commit
+ * @return drv8305_commit_status_e Final commit state, or the state at the step limit
+ */
+DRV8305_PRIVATE drv8305_commit_status_e test_commit(uint16_t dead_time, drv8305_packed_configuration_t *previous)
+{
+    drv8305_packed_configuration_t *staged = drv8305_api_get_staged_configuration(&test_drv8305_obj);
+
+    *previous = test_drv8305_obj.config;
+    *staged   = test_drv8305_obj.config;
+    drv8305_packed_set_gate_drive_dead_time(staged, dead_time);
+
+    drv8305_test_check(drv8305_api_commit_configuration(&test_drv8305_obj), "commit: queued");
+
+    for(uint32_t tick = 0; tick < TEST_STEP_MS; tick++)
+    {
+        test_step();
+
+        drv8305_commit_status_e status = drv8305_api_get_commit_status(&test_drv8305_obj);
+
+        if(status == DRV8305_COMMIT_DONE || status == DRV8305_COMMIT_ROLLED_BACK || status == DRV8305_COMMIT_FAILED) { return status; }
+    }
+
+    return drv8305_api_get_commit_status(&test_drv8305_obj);
+}
+
+/**
+ * @brief One simulated millisecond: one poll, one timer tick, one model tick
+ * @return None
+ */
+DRV8305_PRIVATE void test_step(void)
+{
+    drv8305_api_master_sm_polling(&test_drv8305_obj);
+    drv8305_api_timer(&test_drv8305_obj);
+    drv8305_sim_tick(&test_sim);
+}
+
+/**
+ * @brief Compare the model's control registers with a profile
+ * @param[in] cfg Packed profile
+ * @return true if every control register 0x05 - 0x0C holds its word
+ * @note CLR_FLTS is self-clearing and never reads back as written
+ */
+DRV8305_PRIVATE bool test_programmed(const drv8305_packed_configuration_t *cfg)
+{
+    for(uint16_t index = DRV8305_CONTROL_05_ARRAY_INDEX; index <= DRV8305_CONTROL_0C_ARRAY_INDEX; index++)
+    {
+        uint16_t address = (uint16_t)test_drv8305_obj.register_manager[index].type;
+        uint16_t ignore  = (address == DRV8305_CONTROL_09_REG_ADDR) ? (uint16_t)DRV8305_CTRL09_CLR_FLTS_MASK : 0U;
+
+        if(((drv8305_sim_peek(&test_sim, address) ^ cfg->word[DRV8305_REGISTER_IMAGE_INDEX(index)]) & (uint16_t)~ignore) != 0) { return false; }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Writes the model received on any control register
+ * @return uint32_t Sum of the per-address write counters of 0x05 - 0x0C
+ */
+DRV8305_PRIVATE uint32_t test_control_writes(void)
+{
+    uint32_t writes = 0;
+
+    for(uint16_t index = DRV8305_CONTROL_05_ARRAY_INDEX; index <= DRV8305_CONTROL_0C_ARRAY_INDEX; index++)
+    {
+        writes += test_sim.writes[test_drv8305_obj.register_manager[index].type];
+    }
+
+    return writes;
+}
@@ -0,0 +1,154 @@
+/**
+ * @file drv8305_config_blob_test.c
+ * @brief DRV8305 Configuration Blob Unit Test (Host)
+ * @details Round trip of the default configuration through the blob, and one check per
+ *          rejection status of drv8305_config_blob_validate().
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ *   - serialize / deserialize / pack / unpack round trip of default_configuration
+ *   - BAD_MAGIC, BAD_VERSION, BAD_LENGTH, BAD_VARIANT, BAD_CRC and BAD_FIELD
+ *   - Every single-bit flip of a valid blob is rejected
+ *   - Variant matching (ANY on either side is accepted)
+ *
+ * @usage
+ * drv8305_config_blob_test   (exit code 0 when every check passes)
+ *
+ * @build
+ * CMake target drv8305_config_blob_test, or from this directory:
+ *   gcc -std=c99 -O2 -I../DRV8305_Driver drv8305_config_blob_test.c
+ *       ../DRV8305_Driver/DRV8305_Config/drv8305_configuration.c
+ *       ../DRV8305_Driver/DRV8305_Config/drv8305_packed_configuration.c
+ *       ../DRV8305_Driver/DRV8305_Config/drv8305_config_blob.c
+ *       ../DRV8305_Driver/DRV8305_Utils/drv8305_crc.c -o drv8305_config_blob_test
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "drv8305_macros.h"
+#include "DRV8305_Config/drv8305_configuration.h"
+#include "DRV8305_Config/drv8305_packed_configuration.h"
+#include "DRV8305_Config/drv8305_config_blob.h"
+#include "DRV8305_Utils/drv8305_crc.h"
+
+extern drv8305_configuration_t default_configuration;
+
+DRV8305_PRIVATE void test_seal  (drv8305_config_blob_t *blob);
+DRV8305_PRIVATE bool test_check (bool condition, const char *what);
+
+DRV8305_PRIVATE int test_failures;
+
+int main(void)
+{
+    drv8305_packed_configuration_t packed, loaded;
+    drv8305_configuration_t        unpacked;
+    drv8305_config_blob_t          blob, bad;
+
+    test_check(sizeof(drv8305_config_blob_t) == DRV8305_CONFIG_BLOB_WORDS * sizeof(uint16_t), "layout: 13 words, no padding");
+
+    /* 1. Round trip */
+    drv8305_configuration_pack(&packed, &default_configuration);
+    drv8305_config_blob_serialize(&blob, &packed, DRV8305_VARIANT_Q1);
+
+    test_check(blob.magic == DRV8305_CONFIG_BLOB_MAGIC && blob.version == DRV8305_CONFIG_BLOB_VERSION, "serialize: header");
+    test_check(drv8305_config_blob_validate(&blob, DRV8305_VARIANT_Q1) == DRV8305_BLOB_OK, "serialize: valid");
+
+    memset(&loaded, 0, sizeof(loaded));
+    test_check(drv8305_config_blob_deserialize(&blob, DRV8305_VARIANT_Q1, &loaded) == DRV8305_BLOB_OK, "deserialize: ok");
+    test_check(memcmp(&loaded, &packed, sizeof(packed)) == 0, "deserialize: words identical");
+
+    drv8305_configuration_unpack(&unpacked, &loaded);
+    drv8305_configuration_pack(&loaded, &unpacked);
+    test_check(memcmp(&loaded, &packed, sizeof(packed)) == 0, "unpack/pack: words identical");
+    test_check(drv8305_configuration_diff_fields(NULL, &unpacked, &default_configuration) == 0, "unpack: fields identical");
+
+    /* 2. One rejection per status */
+    bad = blob; bad.magic = 0xFFFFU;
+    test_check(drv8305_config_blob_validate(&bad, DRV8305_VARIANT_ANY) == DRV8305_BLOB_BAD_MAGIC, "reject: erased flash");
+    test_check(drv8305_config_blob_validate(NULL, DRV8305_VARIANT_ANY) == DRV8305_BLOB_BAD_MAGIC, "reject: NULL");
+
+    bad = blob; bad.version = (uint16_t)(DRV8305_CONFIG_BLOB_VERSION + 1);
+    test_check(drv8305_config_blob_validate(&bad, DRV8305_VARIANT_ANY) == DRV8305_BLOB_BAD_VERSION, "reject: version");
+
+    bad = blob; bad.word_count = 6;
+    test_check(drv8305_config_blob_validate(&bad, DRV8305_VARIANT_ANY) == DRV8305_BLOB_BAD_LENGTH, "reject: length");
+
+    test_check(drv8305_config_blob_validate(&blob, DRV8305_VARIANT_N) == DRV8305_BLOB_BAD_VARIANT, "reject: Q1 blob on N");
+    test_check(drv8305_config_blob_validate(&blob, DRV8305_VARIANT_ANY) == DRV8305_BLOB_OK, "accept: Q1 blob, any device");
+
+    drv8305_config_blob_serialize(&bad, &packed, DRV8305_VARIANT_ANY);
+    test_check(drv8305_config_blob_validate(&bad, DRV8305_VARIANT_E) == DRV8305_BLOB_OK, "accept: any blob on E");
+
+    bad = blob; bad.registers[2] ^= 0x0001U;
+    test_check(drv8305_config_blob_validate(&bad, DRV8305_VARIANT_ANY) == DRV8305_BLOB_BAD_CRC, "reject: corrupted word");
+
+    /* serialize() masks bits 15:11, so write the word and re-seal the CRC by hand */
+    bad = blob; bad.registers[0] |= 0x0800U;
+    test_seal(&bad);
+    test_check(drv8305_config_blob_validate(&bad, DRV8305_VARIANT_ANY) == DRV8305_BLOB_BAD_FIELD, "reject: bit 11 set");
+
+    loaded = packed;
+    drv8305_packed_set_gate_drive_pwm_mode(&loaded, 3U);
+    drv8305_config_blob_serialize(&bad, &loaded, DRV8305_VARIANT_ANY);
+    test_check(drv8305_config_blob_validate(&bad, DRV8305_VARIANT_ANY) == DRV8305_BLOB_BAD_FIELD, "reject: reserved PWM mode");
+
+    memset(&loaded, 0, sizeof(loaded));
+    test_check(drv8305_config_blob_deserialize(&bad, DRV8305_VARIANT_ANY, &loaded) == DRV8305_BLOB_BAD_FIELD, "deserialize: rejected");
+    test_check(loaded.word[0] == 0 && loaded.word[6] == 0, "deserialize: destination untouched on reject");
+
+    /* 3. Every single-bit flip is caught */
+    bool caught = true;
+
+    for(int word = 0; word < DRV8305_CONFIG_BLOB_WORDS; word++)
+    {
+        for(int bit = 0; bit < 16; bit++)
+        {
+            bad = blob;
+            ((uint16_t *)&bad)[word] ^= (uint16_t)(1U << bit);
+
+            caught = caught && drv8305_config_blob_validate(&bad, DRV8305_VARIANT_Q1) != DRV8305_BLOB_OK;
+        }
+    }
+
+    test_check(caught, "flip: every single-bit error rejected");
+
+    printf("{\"words\":%d,\"crc\":\"0x%04X%04X\",\"failures\":%d}\n", DRV8305_CONFIG_BLOB_WORDS, blob.crc_high, blob.crc_low, test_failures);
+
+    return (test_failures == 0) ? 0 : 1;
+}
+
+/**
+ * @brief Recompute the CRC of a hand-edited blob
+ * @param[in,out] blob Blob
+ * @return None
+ */
+DRV8305_PRIVATE void test_seal(drv8305_config_blob_t *blob)
+{
+    uint32_t crc = drv8305_crc32_words(DRV8305_CRC32_INIT, (const uint16_t *)blob, (uint32_t)(DRV8305_CONFIG_BLOB_WORDS - 2));
+
+    blob->crc_low  = (uint16_t)(crc & 0xFFFFU);
+    blob->crc_high = (uint16_t)(crc >> 16);
+}
+
+/**
+ * @brief Report a failed check
+ * @param[in] condition Check result
+ * @param[in] what Description printed on failure
+ * @return bool condition
+ */
+DRV8305_PRIVATE bool test_check(bool condition, const char *what)
+{
+    if(!condition)
+    {
+        fprintf(stderr, "FAIL: %s\n", what);
+        test_failures++;
+    }
+
+    return condition;
+}
@@ -0,0 +1,185 @@
+/**
+ * @file drv8305_config_diff_test.c
+ * @brief DRV8305 Configuration Diff Unit Test (Host)
+ * @details Checks the register mask and per-register change bits of
+ *          drv8305_configuration_diff() and drv8305_api_diff_readback() for configurations
+ *          that differ in known fields.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ *   1. Identical configurations: empty mask, no change bits
+ *   2. One field in one register (Control 0x07 dead time): exactly that register and field
+ *   3. Several fields across registers (0x05 ISINK, 0x09 WD_EN and FLIP_OTSD, 0x0C VDS_LEVEL):
+ *      exactly those registers and fields, and the field-per-word variant agrees
+ *   4. Readback: write-only bits (0x09 CLR_FLTS) never differ, a readback bit that does not
+ *      match the programmed word does, and a desired configuration is compared as given
+ *
+ * @usage
+ * drv8305_config_diff_test   (exit code 0 when every check passes)
+ *
+ * @build
+ * CMake target drv8305_config_diff_test, or from this directory:
+ *   gcc -std=c99 -O2 -I../DRV8305_Driver -I../Tools/drv8305_simulator drv8305_config_diff_test.c
+ *       ../Tools/drv8305_simulator/drv8305_simulator.c <driver sources> -o drv8305_config_diff_test
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "drv8305_macros.h"
+#include "drv8305_register_map.h"
+#include "DRV8305_API/drv8305_api.h"
+#include "DRV8305_Config/drv8305_configuration.h"
+#include "DRV8305_Config/drv8305_packed_configuration.h"
+#include "drv8305_simulator.h"
+
+/** @brief Packed word index of a control register */
+#define TEST_WORD(array_index)  DRV8305_REGISTER_IMAGE_INDEX(array_index)
+
+extern drv8305_configuration_t default_configuration;
+
+DRV8305_PRIVATE bool test_changed_only (const drv8305_configuration_diff_t *diff, const uint16_t *expected);
+DRV8305_PRIVATE bool test_check        (bool condition, const char *what);
+
+DRV8305_PRIVATE drv8305_sim_t         test_sim;
+DRV8305_PRIVATE drv8305_user_object_t test_drv8305_obj;
+DRV8305_PRIVATE int                   test_failures;
+
+int main(void)
+{
+    drv8305_packed_configuration_t base, tuned;
+    drv8305_configuration_t        base_fields, tuned_fields;
+    drv8305_configuration_diff_t   diff, diff_fields;
+    uint16_t                       expected[DRV8305_NUMBER_OF_CONTROL_REGISTERS];
+    uint16_t                       mask;
+
+    drv8305_configuration_pack(&base, &default_configuration);
+
+    /* 1. Identical */
+    memset(&diff, 0xFF, sizeof(diff));
+    memset(expected, 0, sizeof(expected));
+
+    test_check(drv8305_configuration_diff(&diff, &base, &base) == 0 && diff.register_mask == 0, "identical: empty mask");
+    test_check(test_changed_only(&diff, expected), "identical: no change bits");
+
+    /* 2. One field in one register */
+    tuned = base;
+    drv8305_packed_set_gate_drive_dead_time(&tuned, (uint16_t)(drv8305_packed_get_gate_drive_dead_time(&base) ^ 0x7U));
+    expected[TEST_WORD(DRV8305_CONTROL_07_ARRAY_INDEX)] = DRV8305_CTRL07_DEAD_TIME_MASK;
+
+    mask = drv8305_configuration_diff(&diff, &base, &tuned);
+
+    test_check(mask == DRV8305_CONTROL_REGISTER_BIT(DRV8305_CONTROL_07_ARRAY_INDEX) && diff.register_mask == mask, "one field: mask is 0x07 only");
+    test_check(test_changed_only(&diff, expected), "one field: dead time bits only");
+    test_check(drv8305_diff_gate_drive_dead_time(&diff) && !drv8305_diff_gate_drive_tblank(&diff) && !drv8305_diff_gate_drive_pwm_mode(&diff), "one field: field tests");
+
+    /* 3. Several fields across registers */
+    tuned = base;
+    drv8305_packed_set_hs_gate_drive_isink(&tuned, (uint16_t)(drv8305_packed_get_hs_gate_drive_isink(&base) ^ 0xFU));
+    drv8305_packed_set_ic_operation_wd_en(&tuned, (uint16_t)(drv8305_packed_get_ic_operation_wd_en(&base) ^ 0x1U));
+    drv8305_packed_set_ic_operation_flip_otsd(&tuned, (uint16_t)(drv8305_packed_get_ic_operation_flip_otsd(&base) ^ 0x1U));
+    drv8305_packed_set_vds_sense_vds_level(&tuned, (uint16_t)(drv8305_packed_get_vds_sense_vds_level(&base) ^ 0x1U));
+
+    memset(expected, 0, sizeof(expected));
+    expected[TEST_WORD(DRV8305_CONTROL_05_ARRAY_INDEX)] = DRV8305_CTRL05_CTRL06_ISINK_MASK;
+    expected[TEST_WORD(DRV8305_CONTROL_09_ARRAY_INDEX)] = (uint16_t)(DRV8305_CTRL09_WD_EN_MASK | DRV8305_CTRL09_FLIP_OTSD_MASK);
+    expected[TEST_WORD(DRV8305_CONTROL_0C_ARRAY_INDEX)] = DRV8305_FIELD_PUT(1U, DRV8305_CTRL0C_VDS_LEVEL_FIELD);
+
+    mask = drv8305_configuration_diff(&diff, &base, &tuned);
+
+    test_check(mask == (uint16_t)(DRV8305_CONTROL_REGISTER_BIT(DRV8305_CONTROL_05_ARRAY_INDEX) | DRV8305_CONTROL_REGISTER_BIT(DRV8305_CONTROL_09_ARRAY_INDEX) |
+                                  DRV8305_CONTROL_REGISTER_BIT(DRV8305_CONTROL_0C_ARRAY_INDEX)), "several fields: mask is 0x05, 0x09 and 0x0C");
+    test_check(test_changed_only(&diff, expected), "several fields: changed bits exact");
+    test_check(drv8305_diff_hs_gate_drive_isink(&diff) && !drv8305_diff_hs_gate_drive_isource(&diff) && !drv8305_diff_ls_gate_drive_isink(&diff),
+               "several fields: 0x05 ISINK only");
+    test_check(drv8305_diff_ic_operation_wd_en(&diff) && drv8305_diff_ic_operation_flip_otsd(&diff) && !drv8305_diff_ic_operation_wd_dly(&diff),
+               "several fields: 0x09 WD_EN and FLIP_OTSD only");
+    test_check(drv8305_diff_vds_sense_vds_level(&diff) && !drv8305_diff_vds_sense_vds_mode(&diff), "several fields: 0x0C VDS_LEVEL only");
+
+    drv8305_configuration_unpack(&base_fields, &base);
+    drv8305_configuration_unpack(&tuned_fields, &tuned);
+
+    test_check(drv8305_configuration_diff_fields(&diff_fields, &base_fields, &tuned_fields) == mask &&
+               memcmp(&diff_fields, &diff, sizeof(diff)) == 0, "several fields: field-per-word diff agrees");
+
+    /* 4. Readback: register_manager[] as a control pass leaves it */
+    drv8305_sim_init(&test_sim);
+    memset(&test_drv8305_obj, 0, sizeof(test_drv8305_obj));
+    drv8305_sim_attach(&test_sim, &test_drv8305_obj.hw_callbacks);
+    drv8305_api_initialize(&test_drv8305_obj);
+
+    for(uint16_t index = DRV8305_CONTROL_05_ARRAY_INDEX; index <= DRV8305_CONTROL_0C_ARRAY_INDEX; index++)
+    {
+        test_drv8305_obj.register_manager[index].data = drv8305_api_get_control_word(&test_drv8305_obj, index);
+    }
+
+    test_check(drv8305_api_diff_readback(&test_drv8305_obj, NULL, &diff) == 0, "readback: matches the programmed words");
+
+    /* CLR_FLTS is self-clearing: set in the word, clear in the readback, or the other way round */
+    test_drv8305_obj.register_manager[DRV8305_CONTROL_09_ARRAY_INDEX].data ^= DRV8305_CTRL09_CLR_FLTS_MASK;
+    test_check(drv8305_api_diff_readback(&test_drv8305_obj, NULL, &diff) == 0, "readback: CLR_FLTS ignored");
+
+    tuned = test_drv8305_obj.config;
+    tuned.word[TEST_WORD(DRV8305_CONTROL_09_ARRAY_INDEX)] ^= DRV8305_CTRL09_CLR_FLTS_MASK;
+    test_check(drv8305_api_diff_readback(&test_drv8305_obj, &tuned, &diff) == 0, "readback: CLR_FLTS in desired ignored");
+
+    /* A verified bit that did not take */
+    test_drv8305_obj.register_manager[DRV8305_CONTROL_0B_ARRAY_INDEX].data ^= DRV8305_CTRL0B_VREG_UV_LEVEL_MASK;
+
+    memset(expected, 0, sizeof(expected));
+    expected[TEST_WORD(DRV8305_CONTROL_0B_ARRAY_INDEX)] = DRV8305_CTRL0B_VREG_UV_LEVEL_MASK;
+
+    test_check(drv8305_api_diff_readback(&test_drv8305_obj, NULL, &diff) == DRV8305_CONTROL_REGISTER_BIT(DRV8305_CONTROL_0B_ARRAY_INDEX), "readback: 0x0B differs");
+    test_check(test_changed_only(&diff, expected) && drv8305_diff_voltage_regulator_vreg_uv_level(&diff), "readback: VREG_UV_LEVEL only");
+
+    /* A desired configuration is compared as given, not against the programmed words */
+    tuned = test_drv8305_obj.config;
+    tuned.word[TEST_WORD(DRV8305_CONTROL_0B_ARRAY_INDEX)] ^= DRV8305_CTRL0B_VREG_UV_LEVEL_MASK;
+    test_check(drv8305_api_diff_readback(&test_drv8305_obj, &tuned, &diff) == 0, "readback: desired words matched");
+
+    printf("{\"failures\":%d}\n", test_failures);
+
+    return (test_failures == 0) ? 0 : 1;
+}
+
+/**
+ * @brief Compare the change bits of every register with the expected ones
+ * @param[in] diff Diff result
+ * @param[in] expected Change bits per packed word
+ * @return true if every register and the register mask match exactly
+ */
+DRV8305_PRIVATE bool test_changed_only(const drv8305_configuration_diff_t *diff, const uint16_t *expected)
+{
+    uint16_t mask = 0;
+
+    for(int index = 0; index < DRV8305_NUMBER_OF_CONTROL_REGISTERS; index++)
+    {
+        if(diff->changed[index] != expected[index]) { return false; }
+
+        if(expected[index] != 0) { mask |= (uint16_t)(1U << index); }
+    }
+
+    return diff->register_mask == mask;
+}
+
+/**
+ * @brief Report a failed check
+ * @param[in] condition Check result
+ * @param[in] what Description printed on failure
+ * @return bool condition
+ */
+DRV8305_PRIVATE bool test_check(bool condition, const char *what)
+{
+    if(!condition)
+    {
+        fprintf(stderr, "FAIL: %s\n", what);
+        test_failures++;
+    }
+
+    return condition;
+}
@@ -0,0 +1,188 @@
+/**
+ * @file drv8305_event_ring_test.c
+ * @brief DRV8305 Event Ring Unit Test (Host)
+ * @details Single-context checks of the lock-free status event ring: FIFO order, drop-newest
+ *          overflow accounting, free-running index wrap, slot reuse of a full ring, and of the
+ *          overwrite-oldest history.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @usage
+ * drv8305_event_ring_test   (exit code 0 when every check passes)
+ *
+ * @build
+ * CMake targets drv8305_event_ring_test and drv8305_event_ring_test_depth2
+ * (DRV8305_EVENT_RING_DEPTH=2, every push of a full ring wraps), or from this directory:
+ *   gcc -std=c99 -O2 -I../DRV8305_Driver drv8305_event_ring_test.c
+ *       ../DRV8305_Driver/DRV8305_Events/drv8305_event_ring.c -o drv8305_event_ring_test
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "drv8305_macros.h"
+#include "DRV8305_Events/drv8305_event_ring.h"
+
+DRV8305_PRIVATE drv8305_event_t test_event (uint32_t sequence);
+DRV8305_PRIVATE bool            test_check (bool condition, const char *what);
+
+DRV8305_PRIVATE drv8305_event_ring_t    test_ring;
+DRV8305_PRIVATE drv8305_event_history_t test_history;
+DRV8305_PRIVATE int                     test_failures;
+
+int main(void)
+{
+    drv8305_event_t event;
+    drv8305_event_t recent[DRV8305_POSTMORTEM_EVENT_DEPTH + 1];
+    uint32_t        sequence = 0;
+    bool            ordered  = true;
+
+    /* 1. Empty ring */
+    drv8305_event_ring_init(&test_ring);
+    test_check(drv8305_event_ring_count(&test_ring) == 0, "init: empty");
+    test_check(!drv8305_event_ring_pop(&test_ring, &event), "init: pop fails");
+    test_check(!drv8305_event_ring_push(NULL, &event) && !drv8305_event_ring_pop(&test_ring, NULL), "init: NULL rejected");
+
+    /* 2. Fill to depth, one more push is dropped and counted */
+    for(int index = 0; index < DRV8305_EVENT_RING_DEPTH; index++)
+    {
+        event = test_event(sequence++);
+        ordered = drv8305_event_ring_push(&test_ring, &event) && ordered;
+    }
+
+    test_check(ordered, "fill: every push stored");
+    test_check(drv8305_event_ring_count(&test_ring) == (uint32_t)DRV8305_EVENT_RING_DEPTH, "fill: count is depth");
+
+    event = test_event(0xFFFFU);
+    test_check(!drv8305_event_ring_push(&test_ring, &event), "full: push rejected");
+    test_check(drv8305_event_ring_overflows(&test_ring) == 1, "full: overflow counted");
+    test_check(drv8305_event_ring_count(&test_ring) == (uint32_t)DRV8305_EVENT_RING_DEPTH, "full: count unchanged");
+
+    /* 3. Drain in FIFO order, the dropped event never shows up */
+    ordered = true;
+
+    for(uint32_t expected = 0; drv8305_event_ring_pop(&test_ring, &event); expected++)
+    {
+        ordered = ordered && event.timestamp == expected && event.data == (uint16_t)(expected & 0x7FFU);
+    }
+
+    test_check(ordered, "drain: FIFO order, newest dropped");
+    test_check(drv8305_event_ring_count(&test_ring) == 0, "drain: empty");
+
+    /* 4. Many laps of push/pop keep order across the index wrap of the slot array */
+    ordered = true;
+
+    for(uint32_t lap = 0; lap < 10U * (uint32_t)DRV8305_EVENT_RING_DEPTH; lap++)
+    {
+        uint32_t expected = sequence;
+
+        event = test_event(sequence++);
+        drv8305_event_ring_push(&test_ring, &event);
+        event = test_event(sequence++);
+        drv8305_event_ring_push(&test_ring, &event);
+
+        ordered = ordered && drv8305_event_ring_pop(&test_ring, &event) && event.timestamp == expected;
+        ordered = ordered && drv8305_event_ring_pop(&test_ring, &event) && event.timestamp == expected + 1;
+    }
+
+    test_check(ordered, "laps: order kept across wrap");
+    test_check(drv8305_event_ring_overflows(&test_ring) == 1, "laps: no new overflow");
+
+    /* 5. Full ring: each pop frees exactly the slot the next push refills */
+    drv8305_event_ring_init(&test_ring);
+    ordered = true;
+
+    uint32_t oldest = sequence;
+
+    for(int index = 0; index < DRV8305_EVENT_RING_DEPTH; index++)
+    {
+        event = test_event(sequence++);
+        drv8305_event_ring_push(&test_ring, &event);
+    }
+
+    for(uint32_t lap = 0; lap < 10U * (uint32_t)DRV8305_EVENT_RING_DEPTH; lap++)
+    {
+        event   = test_event(0xFFFFU);
+        ordered = ordered && !drv8305_event_ring_push(&test_ring, &event);
+        ordered = ordered && drv8305_event_ring_pop(&test_ring, &event) && event.timestamp == oldest++;
+        event   = test_event(sequence++);
+        ordered = ordered && drv8305_event_ring_push(&test_ring, &event);
+        ordered = ordered && drv8305_event_ring_count(&test_ring) == (uint32_t)DRV8305_EVENT_RING_DEPTH;
+    }
+
+    while(drv8305_event_ring_pop(&test_ring, &event)) { ordered = ordered && event.timestamp == oldest++; }
+
+    test_check(ordered && oldest == sequence, "full wrap: refilled slots popped in order");
+    test_check(drv8305_event_ring_overflows(&test_ring) == 10U * (uint32_t)DRV8305_EVENT_RING_DEPTH, "full wrap: every push of a full ring counted");
+
+    /* 6. Re-init clears indices and overflow count */
+    drv8305_event_ring_init(&test_ring);
+    test_check(drv8305_event_ring_count(&test_ring) == 0 && drv8305_event_ring_overflows(&test_ring) == 0, "re-init: cleared");
+
+    /* 7. History: overwrites the oldest, copies the latest oldest first */
+    drv8305_event_history_init(&test_history);
+    test_check(drv8305_event_history_copy(&test_history, recent, 4) == 0, "history: empty after init");
+
+    for(uint32_t index = 0; index < 3U * (uint32_t)DRV8305_POSTMORTEM_EVENT_DEPTH + 3U; index++)
+    {
+        event = test_event(sequence++);
+        drv8305_event_history_record(&test_history, &event);
+    }
+
+    uint16_t copied = drv8305_event_history_copy(&test_history, recent, 4);
+
+    test_check(copied == 4 && recent[0].timestamp == sequence - 4 && recent[3].timestamp == sequence - 1, "history: last four, oldest first");
+
+    copied  = drv8305_event_history_copy(&test_history, recent, DRV8305_POSTMORTEM_EVENT_DEPTH + 1);
+    ordered = copied == DRV8305_POSTMORTEM_EVENT_DEPTH;
+
+    for(uint16_t index = 0; ordered && index < copied; index++)
+    {
+        ordered = recent[index].timestamp == sequence - DRV8305_POSTMORTEM_EVENT_DEPTH + index;
+    }
+
+    test_check(ordered, "history: bounded by depth, latest kept across wrap");
+
+    printf("{\"depth\":%d,\"events\":%lu,\"failures\":%d}\n", DRV8305_EVENT_RING_DEPTH, (unsigned long)sequence, test_failures);
+
+    return (test_failures == 0) ? 0 : 1;
+}
+
+/**
+ * @brief Build an event whose fields are derived from a sequence number
+ * @param[in] sequence Sequence number
+ * @return drv8305_event_t Event
+ */
+DRV8305_PRIVATE drv8305_event_t test_event(uint32_t sequence)
+{
+    drv8305_event_t event;
+
+    event.timestamp        = sequence;
+    event.register_address = (uint16_t)(1U + (sequence & 3U));
+    event.data             = (uint16_t)(sequence & 0x7FFU);
+    event.raised           = (uint16_t)(sequence & 0x7FFU);
+    event.cleared          = 0;
+    event.main_state       = 0;
+
+    return event;
+}
+
+/**
+ * @brief Report a failed check
+ * @param[in] condition Check result
+ * @param[in] what Description printed on failure
+ * @return bool condition
+ */
+DRV8305_PRIVATE bool test_check(bool condition, const char *what)
+{
+    if(!condition)
+    {
+        fprintf(stderr, "FAIL: %s\n", what);
+        test_failures++;
+    }
+
+    return condition;
+}
@@ -0,0 +1,306 @@
+/**
+ * @file drv8305_flow_test.c
+ * @brief DRV8305 Flow Unit Test (Host)
+ * @details Runs drv8305_flow_polling() against the behavioral simulator, once with a transport
+ *          that completes every frame inside the start call and once with one that completes
+ *          it on a later poll, the way a DMA interrupt would.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * Per transport:
+ *   1. Cold start: the programming pass confirms the configuration and the device holds
+ *      every control word the driver programmed
+ *   2. A fixed number of status scans run and publish snapshots
+ *   3. An injected VDS_HA fault reaches a status subscriber
+ *   4. A brown-out (register file back to reset words, PVDD_UVLO2 latched) runs the
+ *      programming pass again and restores the control words
+ *   5. drv8305_flow_request_programming() runs one more pass
+ *   6. A request made during a pass, after Control 0x05 was written and then changed in the
+ *      working copy, runs a second pass that writes the new word
+ *   7. Every started frame completed; the deferred transport kept each one in flight for a poll
+ * Finally both transports must have sent the same frames in the same order up to the end of
+ * the last steady-state scan. The comparison counts scans, not simulated time: a zero-delay
+ * DRV8305_FLOW_DELAY does not yield, so the blocking transport gets through more frames per
+ * millisecond than the deferred one (timing profile BURST).
+ *
+ * @usage
+ * drv8305_flow_test   (exit code 0 when every check passes)
+ *
+ * @build
+ * CMake target drv8305_flow_test, or from this directory:
+ *   gcc -std=c99 -O2 -I../DRV8305_Driver -I../Tools/drv8305_simulator drv8305_flow_test.c
+ *       drv8305_test_support.c ../Tools/drv8305_simulator/drv8305_simulator.c <driver sources> -o drv8305_flow_test
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "drv8305_macros.h"
+#include "drv8305_register_map.h"
+#include "DRV8305_API/drv8305_api.h"
+#include "DRV8305_Config/drv8305_packed_configuration.h"
+#include "DRV8305_Flow/drv8305_flow.h"
+#include "DRV8305_Status_Registers/drv8305_status_registers_definitions.h"
+#include "drv8305_simulator.h"
+#include "drv8305_test_support.h"
+
+/** @brief Simulated milliseconds one step may take before the test fails */
+#define TEST_STEP_MS     (uint32_t)10000
+/** @brief Completed status scans at the end of the steady state, also the end of the frame log */
+#define TEST_STEADY_SCANS (uint32_t)4
+/** @brief Frames logged per transport for the order comparison */
+#define TEST_LOG_FRAMES   (int)128
+
+typedef enum
+{
+    TEST_TRANSPORT_BLOCKING,  // -> Response reported inside transfer_start
+    TEST_TRANSPORT_DEFERRED,  // -> Response reported before the next poll
+    TEST_TRANSPORTS
+} test_transport_e;
+
+/**
+ * @brief Transport model and its counters
+ */
+typedef struct
+{
+    test_transport_e kind;
+    bool             in_flight;              // Deferred frame waiting for its completion
+    uint16_t         frame;                  // Deferred frame
+    uint32_t         started;                // Frames accepted
+    uint32_t         deferred;               // Frames completed outside transfer_start
+    uint32_t         logged;                 // Frames in log[]
+    uint16_t         log[TEST_LOG_FRAMES];   // Frames started before scan TEST_STEADY_SCANS completed
+} test_transport_t;
+
+DRV8305_PRIVATE void test_run           (test_transport_e kind);
+DRV8305_PRIVATE void test_step          (void);
+DRV8305_PRIVATE bool test_run_until     (bool (*condition)(void), uint32_t limit);
+DRV8305_PRIVATE bool test_transfer_start(void *context, uint16_t frame);
+DRV8305_PRIVATE void test_on_status     (void *self, uint16_t status_index, uint16_t data, uint16_t raised, uint16_t cleared);
+DRV8305_PRIVATE bool test_confirmed     (void);
+DRV8305_PRIVATE bool test_fault_seen    (void);
+DRV8305_PRIVATE bool test_steady_done   (void);
+DRV8305_PRIVATE bool test_second_pass   (void);
+DRV8305_PRIVATE bool test_third_pass    (void);
+DRV8305_PRIVATE void test_edit_in_pass  (void);
+DRV8305_PRIVATE bool test_fifth_pass    (void);
+DRV8305_PRIVATE bool test_programmed    (void);
+
+DRV8305_PRIVATE drv8305_sim_t         test_sim;
+DRV8305_PRIVATE drv8305_user_object_t test_drv8305_obj;
+DRV8305_PRIVATE drv8305_flow_t        test_flow;
+DRV8305_PRIVATE test_transport_t      test_transports[TEST_TRANSPORTS];
+DRV8305_PRIVATE test_transport_t     *test_transport;
+DRV8305_PRIVATE uint16_t              test_raised_02;
+DRV8305_PRIVATE uint32_t              test_writes_05;
+DRV8305_PRIVATE bool                  test_edit_armed;
+DRV8305_PRIVATE bool                  test_edit_done;
+
+DRV8305_PRIVATE const char *const test_transport_names[TEST_TRANSPORTS] = { "blocking", "deferred" };
+
+DRV8305_PRIVATE const uint16_t test_all_bits[DRV8305_NUMBER_OF_STATUS_REGISTERS] =
+{
+    DRV8305_REGISTER_DATA_MASK, DRV8305_REGISTER_DATA_MASK, DRV8305_REGISTER_DATA_MASK, DRV8305_REGISTER_DATA_MASK
+};
+
+int main(void)
+{
+    for(int kind = 0; kind < TEST_TRANSPORTS; kind++)
+    {
+        test_run((test_transport_e)kind);
+
+        printf("{\"transport\":\"%s\",\"simulated_ms\":%lu,\"frames\":%lu,\"deferred\":%lu,\"passes\":%lu,\"scans\":%lu}\n",
+               test_transport_names[kind], (unsigned long)test_sim.time, (unsigned long)test_transports[kind].started,
+               (unsigned long)test_transports[kind].deferred, (unsigned long)test_flow.passes, (unsigned long)test_flow.scans);
+    }
+
+    const test_transport_t *blocking = &test_transports[TEST_TRANSPORT_BLOCKING];
+    const test_transport_t *deferred = &test_transports[TEST_TRANSPORT_DEFERRED];
+
+    drv8305_test_set_context(NULL);
+    drv8305_test_check(blocking->logged == deferred->logged && blocking->logged < (uint32_t)TEST_LOG_FRAMES &&
+                       memcmp(blocking->log, deferred->log, blocking->logged * sizeof(uint16_t)) == 0, "both transports: same frames in the same order");
+
+    printf("{\"failures\":%d}\n", drv8305_test_failures());
+
+    return (drv8305_test_failures() == 0) ? 0 : 1;
+}
+
+/**
+ * @brief Run every step against a fresh model and driver with one transport
+ * @param[in] kind Transport model
+ * @return None
+ */
+DRV8305_PRIVATE void test_run(test_transport_e kind)
+{
+    test_transport = &test_transports[kind];
+    memset(test_transport, 0, sizeof(test_transport_t));
+    test_transport->kind = kind;
+    test_raised_02       = 0;
+
+    drv8305_test_set_context(test_transport_names[kind]);
+    drv8305_test_start(&test_sim, &test_drv8305_obj);
+    drv8305_api_status_subscribe(&test_drv8305_obj, test_on_status, test_all_bits);
+    drv8305_flow_init(&test_flow, &test_drv8305_obj, test_transfer_start, test_transport);
+
+    /* 1. Cold start */
+    drv8305_test_check(test_run_until(test_confirmed, TEST_STEP_MS), "cold start: configuration confirmed");
+    drv8305_test_check(test_flow.passes == 1 && test_programmed(), "cold start: device holds the programmed words");
+
+    /* 2. Steady state */
+    drv8305_test_check(test_flow.scans < TEST_STEADY_SCANS, "steady: scans left before the end of the log");
+    drv8305_test_check(test_run_until(test_steady_done, TEST_STEP_MS), "steady: status scans continue");
+
+    drv8305_snapshot_t snapshot;
+
+    drv8305_test_check(drv8305_api_get_register_snapshot(&test_drv8305_obj, &snapshot) && snapshot.sequence > test_flow.passes, "steady: snapshots published");
+    drv8305_test_check(test_flow.passes == 1, "steady: no programming pass without a request");
+
+    /* 3. Fault notification */
+    drv8305_sim_inject(&test_sim, DRV8305_SIM_ASSERT, DRV8305_STATUS_02_REG_ADDR, DRV8305_VDS_HA);
+    drv8305_test_check(test_run_until(test_fault_seen, TEST_STEP_MS), "fault: subscriber sees VDS_HA");
+    drv8305_sim_inject(&test_sim, DRV8305_SIM_RELEASE, DRV8305_STATUS_02_REG_ADDR, DRV8305_VDS_HA);
+
+    /* 4. Brown-out: the scan sees PVDD_UVLO2 and the flow re-programs */
+    drv8305_sim_inject(&test_sim, DRV8305_SIM_BROWN_OUT, DRV8305_STATUS_03_REG_ADDR, 0);
+    drv8305_test_check(test_run_until(test_second_pass, TEST_STEP_MS), "brown-out: programming pass ran again");
+    drv8305_test_check(test_programmed(), "brown-out: control words restored");
+
+    /* 5. Programming on request */
+    drv8305_flow_request_programming(&test_flow);
+    drv8305_test_check(test_run_until(test_third_pass, TEST_STEP_MS), "request: programming pass ran");
+
+    /* 6. Request during a pass: 0x05 already holds the old word, so a further pass must follow */
+    test_writes_05  = test_sim.writes[DRV8305_CONTROL_05_REG_ADDR];
+    test_edit_armed = true;
+    test_edit_done  = false;
+    drv8305_flow_request_programming(&test_flow);
+
+    drv8305_test_check(test_run_until(test_fifth_pass, TEST_STEP_MS), "request in pass: another pass followed");
+    drv8305_test_check(test_edit_done, "request in pass: edited during the fourth pass");
+    drv8305_test_check(test_programmed(), "request in pass: new 0x05 word written");
+
+    /* 7. Transport accounting */
+    drv8305_test_check(test_flow.transfers == test_transport->started && !test_transport->in_flight, "transport: every started frame completed");
+    drv8305_test_check(test_transport->deferred == ((kind == TEST_TRANSPORT_DEFERRED) ? test_transport->started : 0U), "transport: completion context");
+}
+
+/**
+ * @brief One simulated millisecond: transport completion, one poll, one timer tick, one model tick
+ * @return None
+ */
+DRV8305_PRIVATE void test_step(void)
+{
+    /* The "interrupt" of the deferred transport: a frame started on an earlier poll completes */
+    if(test_transport->in_flight)
+    {
+        test_transport->in_flight = false;
+        test_transport->deferred++;
+        drv8305_flow_transfer_complete(&test_flow, drv8305_sim_transfer(&test_sim, test_transport->frame));
+    }
+
+    drv8305_flow_polling(&test_flow);
+    drv8305_api_timer(&test_drv8305_obj);
+    drv8305_sim_tick(&test_sim);
+}
+
+/**
+ * @brief Step until a condition holds or the limit has passed
+ * @param[in] condition Checked after every step
+ * @param[in] limit Simulated milliseconds
+ * @return bool condition held
+ */
+DRV8305_PRIVATE bool test_run_until(bool (*condition)(void), uint32_t limit)
+{
+    for(uint32_t tick = 0; tick < limit; tick++)
+    {
+        test_step();
+
+        if(condition()) { return true; }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Transport start function handed to drv8305_flow_init()
+ * @param[in] context test_transport_t
+ * @param[in] frame Command frame
+ * @return true if accepted, false while a frame is still in flight
+ */
+DRV8305_PRIVATE bool test_transfer_start(void *context, uint16_t frame)
+{
+    test_transport_t *transport = (test_transport_t *)context;
+
+    if(transport->in_flight) { return false; }
+
+    test_edit_in_pass();
+
+    /* Log by scan count, so both transports cover the same part of the sequence */
+    if(test_flow.scans < TEST_STEADY_SCANS && transport->logged < (uint32_t)TEST_LOG_FRAMES) { transport->log[transport->logged++] = frame; }
+
+    transport->started++;
+
+    if(transport->kind == TEST_TRANSPORT_BLOCKING)
+    {
+        drv8305_flow_transfer_complete(&test_flow, drv8305_sim_transfer(&test_sim, frame));
+        return true;
+    }
+
+    transport->frame     = frame;
+    transport->in_flight = true;
+
+    return true;
+}
+
+/* Runs from the transport, so the edit lands inside the pass even when a whole pass fits in one poll */
+DRV8305_PRIVATE void test_edit_in_pass(void)
+{
+    if(!test_edit_armed || test_sim.writes[DRV8305_CONTROL_05_REG_ADDR] == test_writes_05) { return; }
+
+    test_edit_armed = false;
+    test_edit_done  = (test_flow.passes == 3);
+
+    drv8305_packed_set_hs_gate_drive_isink(&test_drv8305_obj.config, (uint16_t)(drv8305_packed_get_hs_gate_drive_isink(&test_drv8305_obj.config) ^ 0x1U));
+    drv8305_flow_request_programming(&test_flow);
+}
+
+/**
+ * @brief Remember the status 0x02 bits raised since the run started
+ */
+DRV8305_PRIVATE void test_on_status(void *self, uint16_t status_index, uint16_t data, uint16_t raised, uint16_t cleared)
+{
+    (void)self; (void)data; (void)cleared;
+
+    if(status_index == DRV8305_STATUS_02_ARRAY_INDEX) { test_raised_02 |= raised; }
+}
+
+DRV8305_PRIVATE bool test_confirmed(void)   { return drv8305_api_is_configuration_confirm(&test_drv8305_obj); }
+DRV8305_PRIVATE bool test_fault_seen(void)  { return (test_raised_02 & DRV8305_VDS_HA) != 0; }
+DRV8305_PRIVATE bool test_steady_done(void) { return test_flow.scans >= TEST_STEADY_SCANS; }
+DRV8305_PRIVATE bool test_second_pass(void) { return test_flow.passes == 2; }
+DRV8305_PRIVATE bool test_third_pass(void)  { return test_flow.passes == 3; }
+DRV8305_PRIVATE bool test_fifth_pass(void)  { return test_flow.passes == 5; }
+
+/**
+ * @brief Compare the model's control registers with the words the driver programs
+ * @return true if every control register 0x05 - 0x0C matches
+ * @note CLR_FLTS is self-clearing and never reads back as written
+ */
+DRV8305_PRIVATE bool test_programmed(void)
+{
+    for(uint16_t index = DRV8305_CONTROL_05_ARRAY_INDEX; index <= DRV8305_CONTROL_0C_ARRAY_INDEX; index++)
+    {
+        uint16_t address = (uint16_t)test_drv8305_obj.register_manager[index].type;
+        uint16_t ignore  = (address == DRV8305_CONTROL_09_REG_ADDR) ? (uint16_t)DRV8305_CTRL09_CLR_FLTS_MASK : 0U;
+
+        if(((drv8305_sim_peek(&test_sim, address) ^ drv8305_api_get_control_word(&test_drv8305_obj, index)) & (uint16_t)~ignore) != 0) { return false; }
+    }
+
+    return true;
+}
@@ -0,0 +1,415 @@
+/**
+ * @file drv8305_mailbox_test.c
+ * @brief DRV8305 Split-Execution Mailbox Test (Host, POSIX threads)
+ * @details Runs the mailbox server with the driver and the behavioral simulator on one thread
+ *          and a client on another, the way the two CPUs of a dual-core part share the mailbox.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * The server thread toggles the overtemperature warning every TEST_TOGGLE_MS simulated
+ * milliseconds, so status events keep flowing, and counts every event through a status
+ * subscriber. The client thread:
+ *   1. Waits for the first configuration confirm, draining events and reading snapshots
+ *   2. Has Control 0x0C stuck and posts two SET_CONFIGURATION back to back. The first also
+ *      changes 0x0C and rolls back, the second waits behind it. Each ticket reports its own
+ *      commit: DRV8305_COMMIT_ROLLED_BACK for the first, DRV8305_COMMIT_DONE with the second
+ *      dead time in the device for the second, never the other's result
+ *   3. Posts IC_DISABLE, IC_ENABLE, IC_SLEEP, IC_WAKE_UP and CONFIRM_CONFIGURATION and checks
+ *      EN_GATE, WAKE and the re-programmed register after wake-up
+ *   4. Stops draining until the shared event ring overflows
+ * Throughout, every accepted snapshot must be newer than the previous one and every event must
+ * be in time order. At the end, events popped plus overflows counted must equal the events the
+ * driver produced.
+ * Built as C11 against drv8305_c11, every word the threads share (mailbox, event ring and
+ * snapshot words, and the test's own probe) is an atomic, so the test is clean under
+ * -fsanitize=thread.
+ *
+ * @usage
+ * drv8305_mailbox_test   (exit code 0 when every check passes)
+ *
+ * @build
+ * CMake target drv8305_mailbox_test (C11, so the mailbox words are atomics), or from this directory:
+ *   gcc -std=c11 -O2 -pthread -I../DRV8305_Driver -I../Tools/drv8305_simulator drv8305_mailbox_test.c
+ *       drv8305_test_support.c ../Tools/drv8305_simulator/drv8305_simulator.c <driver sources> -o drv8305_mailbox_test
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include "drv8305_macros.h"
+#include "drv8305_register_map.h"
+#include "DRV8305_API/drv8305_api.h"
+#include "DRV8305_Config/drv8305_configuration.h"
+#include "DRV8305_Config/drv8305_packed_configuration.h"
+#include "DRV8305_Mailbox/drv8305_mailbox.h"
+#include "DRV8305_Status_Registers/drv8305_status_registers_definitions.h"
+#include "drv8305_simulator.h"
+#include "drv8305_test_support.h"
+
+/** @brief Simulated milliseconds between overtemperature warning toggles */
+#define TEST_TOGGLE_MS   (uint32_t)2000
+/** @brief Simulated milliseconds the client may take for one step before the test fails */
+#define TEST_STEP_MS     (uint32_t)30000
+/** @brief Simulated milliseconds to fill the shared ring, one event per toggle */
+#define TEST_OVERFLOW_MS (((uint32_t)DRV8305_EVENT_RING_DEPTH + 8U) * TEST_TOGGLE_MS)
+/** @brief Simulated milliseconds after which the server gives up */
+#define TEST_LIMIT_MS    (uint32_t)3600000
+
+/**
+ * @brief Server-side state the client may look at (the test's view of the pins)
+ */
+typedef struct
+{
+    drv8305_shared_u32_t time;       // Simulated milliseconds
+    drv8305_shared_u32_t confirmed;  // drv8305_api_is_configuration_confirm()
+    drv8305_shared_u32_t en_gate;    // EN_GATE pin
+    drv8305_shared_u32_t wake;       // WAKE pin
+    drv8305_shared_u32_t control_07; // Gate drive control word held by the device
+    drv8305_shared_u32_t produced;   // Status events raised by the driver
+    drv8305_shared_u32_t stick_0c;   // Client: Control 0x0C should ignore writes
+    drv8305_shared_u32_t stuck_0c;   // Server: stick_0c applied to the model
+} test_probe_t;
+
+DRV8305_PRIVATE void *test_server        (void *argument);
+DRV8305_PRIVATE void *test_client        (void *argument);
+DRV8305_PRIVATE bool  test_wait          (bool (*condition)(void), uint32_t limit, const char *what);
+DRV8305_PRIVATE void  test_consume       (bool drain);
+DRV8305_PRIVATE bool  test_post          (drv8305_mailbox_command_e command, uint16_t dead_time);
+DRV8305_PRIVATE bool  test_post_config   (uint16_t dead_time, uint16_t vds_level, uint32_t *ticket);
+DRV8305_PRIVATE bool  test_send          (const drv8305_mailbox_command_t *message, uint32_t *ticket);
+DRV8305_PRIVATE void  test_stick_0c      (bool stick);
+DRV8305_PRIVATE void  test_on_status     (void *self, uint16_t status_index, uint16_t data, uint16_t raised, uint16_t cleared);
+DRV8305_PRIVATE bool  test_confirmed     (void);
+DRV8305_PRIVATE bool  test_commit_final  (void);
+DRV8305_PRIVATE bool  test_stuck_0c      (void);
+DRV8305_PRIVATE bool  test_unstuck_0c    (void);
+DRV8305_PRIVATE bool  test_queue_empty   (void);
+DRV8305_PRIVATE bool  test_gates_off     (void);
+DRV8305_PRIVATE bool  test_gates_on      (void);
+DRV8305_PRIVATE bool  test_asleep        (void);
+DRV8305_PRIVATE bool  test_awake         (void);
+DRV8305_PRIVATE bool  test_programmed    (void);
+DRV8305_PRIVATE bool  test_overflowed    (void);
+
+extern drv8305_configuration_t default_configuration;
+
+DRV8305_PRIVATE drv8305_sim_t            test_sim;
+DRV8305_PRIVATE drv8305_user_object_t    test_drv8305_obj;
+DRV8305_PRIVATE drv8305_mailbox_t        test_mailbox;
+DRV8305_PRIVATE drv8305_mailbox_server_t test_mailbox_server;
+DRV8305_PRIVATE test_probe_t             test_probe;
+DRV8305_PRIVATE drv8305_shared_u32_t     test_stop;
+DRV8305_PRIVATE uint16_t                 test_dead_time;
+DRV8305_PRIVATE uint32_t                 test_ticket;
+DRV8305_PRIVATE bool                     test_stuck;
+
+/**@brief: Client bookkeeping, touched by the client thread (and main after both joined) **/
+DRV8305_PRIVATE uint32_t test_popped;
+DRV8305_PRIVATE uint32_t test_last_event_time;
+DRV8305_PRIVATE uint32_t test_last_sequence;
+DRV8305_PRIVATE uint32_t test_snapshots;
+DRV8305_PRIVATE bool     test_events_ordered = true;
+DRV8305_PRIVATE bool     test_snapshots_ordered = true;
+
+DRV8305_PRIVATE const uint16_t test_all_bits[DRV8305_NUMBER_OF_STATUS_REGISTERS] =
+{
+    DRV8305_REGISTER_DATA_MASK, DRV8305_REGISTER_DATA_MASK, DRV8305_REGISTER_DATA_MASK, DRV8305_REGISTER_DATA_MASK
+};
+
+int main(void)
+{
+    pthread_t server, client;
+
+    drv8305_test_start(&test_sim, &test_drv8305_obj);
+    drv8305_api_status_subscribe(&test_drv8305_obj, test_on_status, test_all_bits);
+    drv8305_api_confirm_configuration(&test_drv8305_obj);
+
+    drv8305_mailbox_init(&test_mailbox);
+    drv8305_mailbox_server_init(&test_mailbox_server, &test_mailbox, &test_drv8305_obj);
+
+    if(pthread_create(&server, NULL, test_server, NULL) != 0) { return 1; }
+    if(pthread_create(&client, NULL, test_client, NULL) != 0) { return 1; }
+
+    pthread_join(client, NULL);
+    DRV8305_SHARED_STORE(test_stop, 1U);
+    pthread_join(server, NULL);
+
+    /* Both sides stopped: whatever is left in the ring is the rest of the events */
+    test_consume(true);
+
+    uint32_t overflows = drv8305_mailbox_client_get_event_overflows(&test_mailbox);
+
+    drv8305_test_check(test_events_ordered, "events: time order");
+    drv8305_test_check(test_snapshots_ordered, "snapshots: sequence and timestamp order");
+    drv8305_test_check(test_popped + overflows == DRV8305_SHARED_LOAD(test_probe.produced), "events: popped + overflows == produced");
+    drv8305_test_check(drv8305_api_get_event_overflows(&test_drv8305_obj) == 0, "events: server kept the driver ring empty");
+
+    printf("{\"simulated_ms\":%lu,\"snapshots\":%lu,\"produced\":%lu,\"popped\":%lu,\"overflows\":%lu,\"failures\":%d}\n",
+           (unsigned long)DRV8305_SHARED_LOAD(test_probe.time), (unsigned long)test_snapshots, (unsigned long)DRV8305_SHARED_LOAD(test_probe.produced),
+           (unsigned long)test_popped, (unsigned long)overflows, drv8305_test_failures());
+
+    return (drv8305_test_failures() == 0) ? 0 : 1;
+}
+
+/**
+ * @brief Server CPU: mailbox polling, driver timer, device model and warning toggles
+ * @param[in] argument Unused
+ * @return NULL
+ */
+DRV8305_PRIVATE void *test_server(void *argument)
+{
+    (void)argument;
+
+    while(!DRV8305_SHARED_LOAD(test_stop) && test_sim.time < TEST_LIMIT_MS)
+    {
+        if(test_sim.time % TEST_TOGGLE_MS == 0)
+        {
+            bool present = ((test_sim.time / TEST_TOGGLE_MS) & 1U) == 0;
+
+            drv8305_sim_inject(&test_sim, present ? DRV8305_SIM_ASSERT : DRV8305_SIM_RELEASE, DRV8305_STATUS_01_REG_ADDR, DRV8305_WARN_OTW);
+        }
+
+        test_stick_0c(DRV8305_SHARED_LOAD(test_probe.stick_0c) != 0);
+
+        drv8305_mailbox_server_polling(&test_mailbox_server);
+        drv8305_api_timer(&test_drv8305_obj);
+        drv8305_sim_tick(&test_sim);
+
+        DRV8305_SHARED_STORE(test_probe.confirmed,  drv8305_api_is_configuration_confirm(&test_drv8305_obj) ? 1U : 0U);
+        DRV8305_SHARED_STORE(test_probe.en_gate,    test_sim.en_gate ? 1U : 0U);
+        DRV8305_SHARED_STORE(test_probe.wake,       test_sim.wake ? 1U : 0U);
+        DRV8305_SHARED_STORE(test_probe.control_07, drv8305_sim_peek(&test_sim, DRV8305_CONTROL_07_REG_ADDR));
+        DRV8305_SHARED_STORE(test_probe.time,       test_sim.time);
+
+        /* Leave the client some CPU on single-core hosts */
+        if((test_sim.time & 0x1FU) == 0) { sched_yield(); }
+    }
+
+    if(!DRV8305_SHARED_LOAD(test_stop)) { drv8305_test_check(false, "server: simulated time limit reached"); }
+
+    return NULL;
+}
+
+/**
+ * @brief Client CPU: commands, event draining and snapshot checks
+ * @param[in] argument Unused
+ * @return NULL
+ */
+DRV8305_PRIVATE void *test_client(void *argument)
+{
+    (void)argument;
+
+    /* 1. Cold start */
+    drv8305_test_check(test_wait(test_confirmed, TEST_STEP_MS, "cold start confirm"), "start: configuration confirmed");
+
+    /* 2. Two configurations back to back: the first rolls back, the second waits behind it */
+    uint32_t first, second;
+    uint16_t vds_level = default_configuration.vds_sense.vds_level;
+
+    DRV8305_SHARED_STORE(test_probe.stick_0c, 1U);
+    drv8305_test_check(test_wait(test_stuck_0c, TEST_STEP_MS, "stick 0x0C"), "set: 0x0C stuck");
+
+    test_dead_time = DRV8305_DEADTIME_35NS;
+    drv8305_test_check(test_post_config(DRV8305_DEADTIME_88NS, (uint16_t)(vds_level ^ 1U), &first), "set: first posted");
+    drv8305_test_check(test_post_config(DRV8305_DEADTIME_35NS, vds_level, &second), "set: second posted");
+
+    test_ticket = second;
+    drv8305_test_check(test_wait(test_commit_final, TEST_STEP_MS, "second commit"), "set: second commit concluded");
+    drv8305_test_check(drv8305_mailbox_client_get_commit_status(&test_mailbox, second) == DRV8305_COMMIT_DONE, "set: second ticket DRV8305_COMMIT_DONE");
+    drv8305_test_check(drv8305_mailbox_client_get_commit_status(&test_mailbox, first) == DRV8305_COMMIT_ROLLED_BACK, "set: first ticket DRV8305_COMMIT_ROLLED_BACK");
+    drv8305_test_check(test_wait(test_programmed, TEST_STEP_MS, "dead time programmed"), "set: device holds the second dead time");
+
+    DRV8305_SHARED_STORE(test_probe.stick_0c, 0U);
+    drv8305_test_check(test_wait(test_unstuck_0c, TEST_STEP_MS, "unstick 0x0C"), "set: 0x0C released");
+
+    /* 3. Pin commands and a re-confirm after the device lost its registers in sleep */
+    drv8305_test_check(test_post(DRV8305_MAILBOX_CMD_IC_DISABLE, 0) && test_wait(test_gates_off, TEST_STEP_MS, "ic disable"), "ic disable: EN_GATE low");
+    drv8305_test_check(test_post(DRV8305_MAILBOX_CMD_IC_ENABLE, 0)  && test_wait(test_gates_on, TEST_STEP_MS, "ic enable"), "ic enable: EN_GATE high");
+    drv8305_test_check(test_post(DRV8305_MAILBOX_CMD_IC_DISABLE, 0) && test_wait(test_gates_off, TEST_STEP_MS, "ic disable"), "sleep: EN_GATE low first");
+    drv8305_test_check(test_post(DRV8305_MAILBOX_CMD_IC_SLEEP, 0)   && test_wait(test_asleep, TEST_STEP_MS, "ic sleep"), "ic sleep: WAKE low");
+    drv8305_test_check(test_post(DRV8305_MAILBOX_CMD_IC_WAKE_UP, 0) && test_wait(test_awake, TEST_STEP_MS, "ic wake up"), "ic wake up: WAKE high");
+    drv8305_test_check(test_post(DRV8305_MAILBOX_CMD_IC_ENABLE, 0)  && test_wait(test_gates_on, TEST_STEP_MS, "ic enable"), "wake: EN_GATE high");
+    drv8305_test_check(test_post(DRV8305_MAILBOX_CMD_CONFIRM_CONFIGURATION, 0) && test_wait(test_queue_empty, TEST_STEP_MS, "confirm drain"), "confirm: applied");
+    drv8305_test_check(test_wait(test_confirmed, TEST_STEP_MS, "re-confirm") && test_wait(test_programmed, TEST_STEP_MS, "re-programmed"), "confirm: device re-programmed");
+
+    /* 4. No draining until the shared ring overflows */
+    drv8305_test_check(test_wait(test_overflowed, TEST_OVERFLOW_MS, "event overflow"), "overflow: counted by the server");
+
+    return NULL;
+}
+
+/**
+ * @brief Keep consuming until a condition holds or the limit has passed
+ * @param[in] condition Condition to wait for
+ * @param[in] limit Simulated milliseconds
+ * @param[in] what Printed on timeout
+ * @return bool condition held
+ */
+DRV8305_PRIVATE bool test_wait(bool (*condition)(void), uint32_t limit, const char *what)
+{
+    uint32_t start = DRV8305_SHARED_LOAD(test_probe.time);
+    bool     drain = (condition != test_overflowed);
+
+    while(!condition())
+    {
+        if(DRV8305_SHARED_LOAD(test_probe.time) - start > limit || DRV8305_SHARED_LOAD(test_stop))
+        {
+            fprintf(stderr, "timeout: %s\n", what);
+            return false;
+        }
+
+        test_consume(drain);
+        sched_yield();
+    }
+
+    return true;
+}
+
+/**
+ * @brief Read the status snapshot and optionally drain the events (client side)
+ * @param[in] drain Pop every pending event
+ * @return None
+ */
+DRV8305_PRIVATE void test_consume(bool drain)
+{
+    drv8305_snapshot_t snapshot;
+    drv8305_event_t    event;
+
+    if(drv8305_mailbox_client_get_status(&test_mailbox, &snapshot) && snapshot.sequence != 0)
+    {
+        test_snapshots_ordered = test_snapshots_ordered && snapshot.sequence >= test_last_sequence;
+
+        for(int index = 0; index < DRV8305_NUMBER_OF_REGISTERS; index++)
+        {
+            test_snapshots_ordered = test_snapshots_ordered && (snapshot.registers[index] & ~DRV8305_REGISTER_DATA_MASK) == 0;
+        }
+
+        if(snapshot.sequence != test_last_sequence) { test_snapshots++; }
+
+        test_last_sequence = snapshot.sequence;
+    }
+
+    while(drain && drv8305_mailbox_client_pop_event(&test_mailbox, &event))
+    {
+        test_events_ordered = test_events_ordered && event.timestamp >= test_last_event_time &&
+                              event.register_address == DRV8305_STATUS_01_REG_ADDR && (event.raised | event.cleared) == DRV8305_WARN_OTW;
+
+        test_last_event_time = event.timestamp;
+        test_popped++;
+    }
+}
+
+/**
+ * @brief Post a command with the default configuration and a dead time as payload
+ * @param[in] command Command
+ * @param[in] dead_time Gate drive dead time of a SET_CONFIGURATION payload
+ * @return bool posted
+ */
+DRV8305_PRIVATE bool test_post(drv8305_mailbox_command_e command, uint16_t dead_time)
+{
+    drv8305_mailbox_command_t message;
+
+    message.command                     = command;
+    message.config                      = default_configuration;
+    message.config.gate_drive.dead_time = dead_time;
+
+    return test_send(&message, NULL);
+}
+
+/**
+ * @brief Post a SET_CONFIGURATION
+ * @param[in] dead_time Gate drive dead time (Control 0x07)
+ * @param[in] vds_level VDS comparator level (Control 0x0C)
+ * @param[out] ticket Ticket of the command
+ * @return bool posted
+ */
+DRV8305_PRIVATE bool test_post_config(uint16_t dead_time, uint16_t vds_level, uint32_t *ticket)
+{
+    drv8305_mailbox_command_t message;
+
+    message.command                     = DRV8305_MAILBOX_CMD_SET_CONFIGURATION;
+    message.config                      = default_configuration;
+    message.config.gate_drive.dead_time = dead_time;
+    message.config.vds_sense.vds_level  = vds_level;
+
+    return test_send(&message, ticket);
+}
+
+/**
+ * @brief Post a command, retrying while the queue is full
+ * @param[in] message Command and payload
+ * @param[out] ticket Ticket of the command, may be NULL
+ * @return bool posted
+ */
+DRV8305_PRIVATE bool test_send(const drv8305_mailbox_command_t *message, uint32_t *ticket)
+{
+    uint32_t start = DRV8305_SHARED_LOAD(test_probe.time);
+
+    while(!drv8305_mailbox_client_post_command(&test_mailbox, message, ticket))
+    {
+        if(DRV8305_SHARED_LOAD(test_probe.time) - start > TEST_STEP_MS || DRV8305_SHARED_LOAD(test_stop)) { return false; }
+
+        sched_yield();
+    }
+
+    return true;
+}
+
+/**
+ * @brief Apply the client's stick request for Control 0x0C to the model (server side)
+ * @param[in] stick Control 0x0C should ignore writes
+ * @return None
+ */
+DRV8305_PRIVATE void test_stick_0c(bool stick)
+{
+    if(stick == test_stuck) { return; }
+
+    drv8305_sim_inject(&test_sim, stick ? DRV8305_SIM_STICK : DRV8305_SIM_UNSTICK, DRV8305_CONTROL_0C_REG_ADDR, 0);
+    test_stuck = stick;
+
+    DRV8305_SHARED_STORE(test_probe.stuck_0c, stick ? 1U : 0U);
+}
+
+/**
+ * @brief Count every status event the driver raises (server side subscriber)
+ */
+DRV8305_PRIVATE void test_on_status(void *self, uint16_t status_index, uint16_t data, uint16_t raised, uint16_t cleared)
+{
+    (void)self; (void)status_index; (void)data; (void)raised; (void)cleared;
+
+    DRV8305_SHARED_STORE(test_probe.produced, DRV8305_SHARED_LOAD_RELAXED(test_probe.produced) + 1U);
+}
+
+DRV8305_PRIVATE bool test_confirmed(void)   { return DRV8305_SHARED_LOAD(test_probe.confirmed) != 0; }
+DRV8305_PRIVATE bool test_stuck_0c(void)    { return DRV8305_SHARED_LOAD(test_probe.stuck_0c) != 0; }
+DRV8305_PRIVATE bool test_unstuck_0c(void)  { return DRV8305_SHARED_LOAD(test_probe.stuck_0c) == 0; }
+DRV8305_PRIVATE bool test_queue_empty(void) { return DRV8305_SHARED_LOAD(test_mailbox.command_tail) == DRV8305_SHARED_LOAD(test_mailbox.command_head); }
+DRV8305_PRIVATE bool test_gates_off(void)   { return DRV8305_SHARED_LOAD(test_probe.en_gate) == 0; }
+DRV8305_PRIVATE bool test_gates_on(void)    { return DRV8305_SHARED_LOAD(test_probe.en_gate) != 0; }
+DRV8305_PRIVATE bool test_asleep(void)      { return DRV8305_SHARED_LOAD(test_probe.wake) == 0; }
+DRV8305_PRIVATE bool test_awake(void)       { return DRV8305_SHARED_LOAD(test_probe.wake) != 0; }
+DRV8305_PRIVATE bool test_overflowed(void)  { return drv8305_mailbox_client_get_event_overflows(&test_mailbox) != 0; }
+
+DRV8305_PRIVATE bool test_commit_final(void)
+{
+    drv8305_commit_status_e status = drv8305_mailbox_client_get_commit_status(&test_mailbox, test_ticket);
+
+    return status == DRV8305_COMMIT_DONE || status == DRV8305_COMMIT_ROLLED_BACK || status == DRV8305_COMMIT_FAILED;
+}
+
+DRV8305_PRIVATE bool test_programmed(void)
+{
+    drv8305_packed_configuration_t device;
+
+    device.word[DRV8305_CONTROL_07_ARRAY_INDEX - DRV8305_CONTROL_05_ARRAY_INDEX] = (uint16_t)DRV8305_SHARED_LOAD(test_probe.control_07);
+
+    return drv8305_packed_get_gate_drive_dead_time(&device) == test_dead_time;
+}
@@ -0,0 +1,153 @@
+/**
+ * @file drv8305_postmortem_test.c
+ * @brief DRV8305 Post-Mortem Capture Unit Test (Host)
+ * @details Runs the driver against the behavioral simulator with nobody draining the status
+ *          event ring, then checks that a capture still records the latest events.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * The overtemperature warning is toggled every TEST_TOGGLE_MS simulated milliseconds until
+ * the event ring has dropped TEST_EXTRA_EVENTS events. A status subscriber logs the last
+ * DRV8305_POSTMORTEM_EVENT_DEPTH events as the driver raised them. Checks:
+ *   - the ring overflowed and still holds the oldest events (drop-newest)
+ *   - the application capture holds DRV8305_POSTMORTEM_EVENT_DEPTH events, equal to the
+ *     subscriber log, oldest first, and the overflow count of the ring
+ *   - the record is sealed and survives a round trip through drv8305_api_get_postmortem()
+ *
+ * @usage
+ * drv8305_postmortem_test   (exit code 0 when every check passes)
+ *
+ * @build
+ * CMake target drv8305_postmortem_test, or from this directory:
+ *   gcc -std=c99 -O2 -I../DRV8305_Driver -I../Tools/drv8305_simulator drv8305_postmortem_test.c
+ *       drv8305_test_support.c ../Tools/drv8305_simulator/drv8305_simulator.c <driver sources> -o drv8305_postmortem_test
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "drv8305_macros.h"
+#include "drv8305_register_map.h"
+#include "DRV8305_API/drv8305_api.h"
+#include "DRV8305_PostMortem/drv8305_postmortem.h"
+#include "DRV8305_Status_Registers/drv8305_status_registers_definitions.h"
+#include "drv8305_simulator.h"
+#include "drv8305_test_support.h"
+
+/** @brief Simulated milliseconds between overtemperature warning toggles */
+#define TEST_TOGGLE_MS     (uint32_t)2000
+/** @brief Events dropped by the ring before the capture */
+#define TEST_EXTRA_EVENTS  (uint32_t)(2 * DRV8305_POSTMORTEM_EVENT_DEPTH + 3)
+/** @brief Simulated milliseconds after which the test gives up */
+#define TEST_LIMIT_MS      (((uint32_t)DRV8305_EVENT_RING_DEPTH + TEST_EXTRA_EVENTS + 8U) * TEST_TOGGLE_MS)
+
+DRV8305_PRIVATE void test_on_status  (void *self, uint16_t status_index, uint16_t data, uint16_t raised, uint16_t cleared);
+DRV8305_PRIVATE bool test_same_event (const drv8305_event_t *a, const drv8305_event_t *b);
+
+DRV8305_PRIVATE drv8305_sim_t         test_sim;
+DRV8305_PRIVATE drv8305_user_object_t test_drv8305_obj;
+
+DRV8305_POSTMORTEM_DEFINE(test_postmortem);
+
+/**@brief: Subscriber log of the latest events, test_log[produced % depth] **/
+DRV8305_PRIVATE drv8305_event_t test_log[DRV8305_POSTMORTEM_EVENT_DEPTH];
+DRV8305_PRIVATE uint32_t        test_produced;
+
+DRV8305_PRIVATE const uint16_t test_all_bits[DRV8305_NUMBER_OF_STATUS_REGISTERS] =
+{
+    DRV8305_REGISTER_DATA_MASK, DRV8305_REGISTER_DATA_MASK, DRV8305_REGISTER_DATA_MASK, DRV8305_REGISTER_DATA_MASK
+};
+
+int main(void)
+{
+    drv8305_postmortem_record_t record;
+    drv8305_event_t             oldest;
+
+    drv8305_test_start(&test_sim, &test_drv8305_obj);
+    drv8305_api_status_subscribe(&test_drv8305_obj, test_on_status, test_all_bits);
+    drv8305_api_confirm_configuration(&test_drv8305_obj);
+
+    /* Blank no-init RAM: attach discards it and arms the capture */
+    memset(&test_postmortem, 0, sizeof(test_postmortem));
+    drv8305_test_check(!drv8305_api_postmortem_attach(&test_drv8305_obj, &test_postmortem), "attach: blank record discarded");
+
+    /* 1. Toggle the warning until the undrained ring has dropped TEST_EXTRA_EVENTS events */
+    while(drv8305_api_get_event_overflows(&test_drv8305_obj) < TEST_EXTRA_EVENTS && test_sim.time < TEST_LIMIT_MS)
+    {
+        if(test_sim.time % TEST_TOGGLE_MS == 0)
+        {
+            bool present = ((test_sim.time / TEST_TOGGLE_MS) & 1U) == 0;
+
+            drv8305_sim_inject(&test_sim, present ? DRV8305_SIM_ASSERT : DRV8305_SIM_RELEASE, DRV8305_STATUS_01_REG_ADDR, DRV8305_WARN_OTW);
+        }
+
+        drv8305_api_master_sm_polling(&test_drv8305_obj);
+        drv8305_api_timer(&test_drv8305_obj);
+        drv8305_sim_tick(&test_sim);
+    }
+
+    uint32_t overflows = drv8305_api_get_event_overflows(&test_drv8305_obj);
+
+    drv8305_test_check(overflows == TEST_EXTRA_EVENTS, "ring: overflowed");
+    drv8305_test_check(test_produced == (uint32_t)DRV8305_EVENT_RING_DEPTH + overflows, "ring: every event produced once");
+
+    /* 2. Capture: the latest events, not the ones the full ring kept */
+    drv8305_test_check(drv8305_api_postmortem_capture(&test_drv8305_obj, DRV8305_POSTMORTEM_REASON_APPLICATION), "capture: taken");
+    drv8305_test_check(drv8305_api_get_postmortem(&test_drv8305_obj, &record), "capture: sealed and reported");
+
+    bool latest = record.event_count == (uint16_t)DRV8305_POSTMORTEM_EVENT_DEPTH;
+
+    for(uint32_t index = 0; latest && index < (uint32_t)DRV8305_POSTMORTEM_EVENT_DEPTH; index++)
+    {
+        const drv8305_event_t *expected = &test_log[(test_produced + index) % (uint32_t)DRV8305_POSTMORTEM_EVENT_DEPTH];
+
+        latest = test_same_event(&record.events[index], expected);
+    }
+
+    drv8305_test_check(latest, "capture: latest events, oldest first");
+    drv8305_test_check(record.event_overflows == overflows, "capture: overflow count");
+    drv8305_test_check(record.reason == (uint16_t)DRV8305_POSTMORTEM_REASON_APPLICATION, "capture: reason");
+
+    /* The ring itself still starts with the first event (drop-newest) */
+    drv8305_test_check(drv8305_api_pop_event(&test_drv8305_obj, &oldest) && oldest.timestamp < record.events[0].timestamp, "ring: oldest event kept");
+
+    printf("{\"simulated_ms\":%lu,\"produced\":%lu,\"overflows\":%lu,\"recorded\":%u,\"failures\":%d}\n",
+           (unsigned long)test_sim.time, (unsigned long)test_produced, (unsigned long)overflows, (unsigned)record.event_count, drv8305_test_failures());
+
+    return (drv8305_test_failures() == 0) ? 0 : 1;
+}
+
+/**
+ * @brief Log every status event as the driver raises it
+ */
+DRV8305_PRIVATE void test_on_status(void *self, uint16_t status_index, uint16_t data, uint16_t raised, uint16_t cleared)
+{
+    drv8305_user_object_t *driver = (drv8305_user_object_t *)self;
+    drv8305_event_t       *event  = &test_log[test_produced % (uint32_t)DRV8305_POSTMORTEM_EVENT_DEPTH];
+
+    event->timestamp        = driver->state.system_time;
+    event->register_address = (uint16_t)driver->register_manager[status_index].type;
+    event->data             = data;
+    event->raised           = raised;
+    event->cleared          = cleared;
+    event->main_state       = (uint16_t)driver->state.main_state;
+
+    test_produced++;
+}
+
+/**
+ * @brief Compare two events field by field (padding is not part of an event)
+ * @param[in] a First event
+ * @param[in] b Second event
+ * @return true if every field matches
+ */
+DRV8305_PRIVATE bool test_same_event(const drv8305_event_t *a, const drv8305_event_t *b)
+{
+    return a->timestamp == b->timestamp && a->register_address == b->register_address && a->data == b->data &&
+           a->raised == b->raised && a->cleared == b->cleared && a->main_state == b->main_state;
+}
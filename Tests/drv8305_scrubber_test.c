@@ -0,0 +1,134 @@
+/**
+ * @file drv8305_scrubber_test.c
+ * @brief DRV8305 Background Scrubber Unit Test (Host)
+ * @details Runs drv8305_api_master_sm_polling() against the behavioral simulator with the
+ *          scrubber off and at its full budget, and checks that scrubbing never takes the
+ *          place of a status scan.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * Per budget (0 and 100 percent):
+ *   1. Cold start until the configuration is confirmed and the scrubber armed
+ *   2. TEST_RUN_MS simulated milliseconds of IDLE / status scan cycles, counted as reads of
+ *      Status 0x01 by the model
+ * Checks:
+ *   - the full budget run scans as often as the run without scrubbing
+ *   - the full budget run scrubs every control register, without a mismatch
+ *   - an upset in Control 0x0B is still found and restored at the full budget
+ *
+ * @usage
+ * drv8305_scrubber_test   (exit code 0 when every check passes)
+ *
+ * @build
+ * CMake target drv8305_scrubber_test, or from this directory:
+ *   gcc -std=c99 -O2 -I../DRV8305_Driver -I../Tools/drv8305_simulator drv8305_scrubber_test.c
+ *       drv8305_test_support.c ../Tools/drv8305_simulator/drv8305_simulator.c <driver sources> -o drv8305_scrubber_test
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "drv8305_macros.h"
+#include "drv8305_register_map.h"
+#include "DRV8305_API/drv8305_api.h"
+#include "drv8305_simulator.h"
+#include "drv8305_test_support.h"
+
+/** @brief Simulated milliseconds the cold start may take */
+#define TEST_START_MS  (uint32_t)10000
+/** @brief Simulated milliseconds of status scans per budget */
+#define TEST_RUN_MS    (uint32_t)20000
+
+/**
+ * @brief Counters of one run
+ */
+typedef struct
+{
+    uint32_t           scans;     // Status 0x01 reads during the run
+    drv8305_scrubber_t scrubber;  // Scrubber counters at the end of the run
+} test_result_t;
+
+DRV8305_PRIVATE bool test_run   (uint16_t budget_percent, test_result_t *result);
+DRV8305_PRIVATE void test_step  (void);
+
+DRV8305_PRIVATE drv8305_sim_t         test_sim;
+DRV8305_PRIVATE drv8305_user_object_t test_drv8305_obj;
+
+int main(void)
+{
+    test_result_t off;
+    test_result_t full;
+
+    drv8305_test_check(test_run(0, &off), "off: configuration confirmed");
+    drv8305_test_check(test_run((uint16_t)DRV8305_SCRUB_BUDGET_SCALE, &full), "full budget: configuration confirmed");
+
+    drv8305_test_check(off.scans != 0 && off.scrubber.reads == 0, "off: status scans, no scrub reads");
+    drv8305_test_check(full.scans + 1U >= off.scans, "full budget: status scans still run at the polling interval");
+    drv8305_test_check(full.scrubber.reads >= (uint32_t)DRV8305_NUMBER_OF_CONTROL_REGISTERS, "full budget: every control register scrubbed");
+    drv8305_test_check(full.scrubber.mismatches == 0, "full budget: no mismatch on an undisturbed device");
+
+    /* An upset is found by the scrubber and restored between the scans */
+    uint16_t expected = drv8305_sim_peek(&test_sim, DRV8305_CONTROL_0B_REG_ADDR);
+    uint32_t scans    = test_sim.reads[DRV8305_STATUS_01_REG_ADDR];
+
+    drv8305_sim_inject(&test_sim, DRV8305_SIM_CORRUPT, DRV8305_CONTROL_0B_REG_ADDR, 0x0003U);
+
+    for(uint32_t tick = 0; tick < TEST_START_MS; tick++) { test_step(); }
+
+    drv8305_api_get_scrubber(&test_drv8305_obj, &full.scrubber);
+
+    drv8305_test_check(full.scrubber.mismatches == 1, "upset: scrubber mismatch");
+    drv8305_test_check(drv8305_sim_peek(&test_sim, DRV8305_CONTROL_0B_REG_ADDR) == expected, "upset: word restored");
+    drv8305_test_check(test_sim.reads[DRV8305_STATUS_01_REG_ADDR] > scans, "upset: status scans continue");
+
+    printf("{\"scans_off\":%lu,\"scans_full\":%lu,\"scrub_reads\":%lu,\"mismatches\":%lu,\"failures\":%d}\n",
+           (unsigned long)off.scans, (unsigned long)full.scans, (unsigned long)full.scrubber.reads,
+           (unsigned long)full.scrubber.mismatches, drv8305_test_failures());
+
+    return (drv8305_test_failures() == 0) ? 0 : 1;
+}
+
+/**
+ * @brief Cold start a fresh model and driver, then count status scans for TEST_RUN_MS
+ * @param[in] budget_percent Scrubber budget set after initialization
+ * @param[out] result Scan and scrubber counters of the run
+ * @return true if the configuration was confirmed within TEST_START_MS
+ */
+DRV8305_PRIVATE bool test_run(uint16_t budget_percent, test_result_t *result)
+{
+    drv8305_test_start(&test_sim, &test_drv8305_obj);
+    drv8305_api_set_scrub_budget(&test_drv8305_obj, budget_percent);
+    drv8305_api_confirm_configuration(&test_drv8305_obj);
+
+    bool confirmed = false;
+
+    for(uint32_t tick = 0; tick < TEST_START_MS && !confirmed; tick++)
+    {
+        test_step();
+        confirmed = drv8305_api_is_configuration_confirm(&test_drv8305_obj);
+    }
+
+    uint32_t scans = test_sim.reads[DRV8305_STATUS_01_REG_ADDR];
+
+    for(uint32_t tick = 0; tick < TEST_RUN_MS; tick++) { test_step(); }
+
+    result->scans = test_sim.reads[DRV8305_STATUS_01_REG_ADDR] - scans;
+    drv8305_api_get_scrubber(&test_drv8305_obj, &result->scrubber);
+
+    return confirmed;
+}
+
+/**
+ * @brief One simulated millisecond: one poll, one timer tick, one model tick
+ * @return None
+ */
+DRV8305_PRIVATE void test_step(void)
+{
+    drv8305_api_master_sm_polling(&test_drv8305_obj);
+    drv8305_api_timer(&test_drv8305_obj);
+    drv8305_sim_tick(&test_sim);
+}
@@ -0,0 +1,212 @@
+/**
+ * @file drv8305_snapshot_stress_test.c
+ * @brief DRV8305 Register Snapshot Stress Test (Host, POSIX threads)
+ * @details One writer thread publishes as fast as it can while N reader threads copy the
+ *          snapshot; every copy drv8305_snapshot_read() accepts must be a complete publication.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * Publication n carries timestamp ~n and registers[i] = n * 31 + i, so a copy mixing two
+ * publications (torn read) breaks the pattern keyed on its sequence number. Each reader checks:
+ *   - every accepted copy matches the pattern of its own sequence
+ *   - accepted sequences never go backwards
+ * Rejected reads (all attempts raced with the writer) are counted, not failures.
+ *
+ * @usage
+ * drv8305_snapshot_stress_test [readers] [publications]   (default: 4, 2000000)
+ * Exit code 0 when no torn copy was accepted.
+ *
+ * @build
+ * CMake target drv8305_snapshot_stress_test (C11, so the seqlock words are atomics), or from this directory:
+ *   gcc -std=c11 -O2 -pthread -I../DRV8305_Driver drv8305_snapshot_stress_test.c
+ *       ../DRV8305_Driver/DRV8305_Snapshot/drv8305_snapshot.c -o drv8305_snapshot_stress_test
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+
+#include "drv8305_macros.h"
+#include "DRV8305_Snapshot/drv8305_snapshot.h"
+
+/** @brief Reader threads when none are given */
+#define STRESS_DEFAULT_READERS       (int)4
+/** @brief Upper bound of reader threads */
+#define STRESS_MAX_READERS           (int)16
+/** @brief Publications when none are given */
+#define STRESS_DEFAULT_PUBLICATIONS  (uint32_t)2000000
+
+/**
+ * @brief Result of one reader thread
+ */
+typedef struct
+{
+    pthread_t thread;
+    uint32_t  accepted;   // Copies drv8305_snapshot_read() returned as coherent
+    uint32_t  rejected;   // Reads that raced with the writer on every attempt
+    uint32_t  torn;       // Accepted copies breaking the pattern (must stay 0)
+    uint32_t  backwards;  // Accepted copies older than the previous one (must stay 0)
+    uint32_t  last;       // Highest sequence seen
+} stress_reader_t;
+
+DRV8305_PRIVATE void  *stress_writer  (void *argument);
+DRV8305_PRIVATE void  *stress_reader  (void *argument);
+DRV8305_PRIVATE bool   stress_coherent(const drv8305_snapshot_t *snapshot);
+
+DRV8305_PRIVATE drv8305_snapshot_publisher_t stress_publisher;
+DRV8305_PRIVATE stress_reader_t              stress_readers[STRESS_MAX_READERS];
+DRV8305_PRIVATE uint32_t                     stress_publications;
+DRV8305_PRIVATE drv8305_shared_u32_t         stress_done;
+
+int main(int argc, char **argv)
+{
+    int readers = (argc > 1) ? atoi(argv[1]) : STRESS_DEFAULT_READERS;
+
+    stress_publications = (argc > 2) ? (uint32_t)strtoul(argv[2], NULL, 0) : STRESS_DEFAULT_PUBLICATIONS;
+
+    if(readers < 1 || readers > STRESS_MAX_READERS || stress_publications == 0)
+    {
+        fprintf(stderr, "usage: drv8305_snapshot_stress_test [readers 1-%d] [publications]\n", STRESS_MAX_READERS);
+        return 2;
+    }
+
+    pthread_t          writer;
+    drv8305_snapshot_t mixed = { 7U, ~7U, { 0 } };
+
+    /* The pattern check itself must reject a copy mixing two publications */
+    for(int index = 0; index < DRV8305_NUMBER_OF_REGISTERS; index++)
+    {
+        mixed.registers[index] = (uint16_t)(((index < 5) ? 7U : 8U) * 31U + (uint32_t)index);
+    }
+
+    if(stress_coherent(&mixed))
+    {
+        fprintf(stderr, "FAIL: pattern check accepts a mixed copy\n");
+        return 1;
+    }
+
+    drv8305_snapshot_init(&stress_publisher);
+
+    for(int index = 0; index < readers; index++)
+    {
+        if(pthread_create(&stress_readers[index].thread, NULL, stress_reader, &stress_readers[index]) != 0) { return 1; }
+    }
+
+    if(pthread_create(&writer, NULL, stress_writer, NULL) != 0) { return 1; }
+
+    pthread_join(writer, NULL);
+
+    uint32_t accepted = 0, rejected = 0, torn = 0, backwards = 0;
+
+    for(int index = 0; index < readers; index++)
+    {
+        pthread_join(stress_readers[index].thread, NULL);
+
+        accepted  += stress_readers[index].accepted;
+        rejected  += stress_readers[index].rejected;
+        torn      += stress_readers[index].torn;
+        backwards += stress_readers[index].backwards;
+    }
+
+    drv8305_snapshot_t final_snapshot;
+    bool               final_read = drv8305_snapshot_read(&stress_publisher, &final_snapshot);
+
+    printf("{\"readers\":%d,\"publications\":%lu,\"accepted\":%lu,\"rejected\":%lu,\"torn\":%lu,\"backwards\":%lu}\n",
+           readers, (unsigned long)stress_publications, (unsigned long)accepted, (unsigned long)rejected,
+           (unsigned long)torn, (unsigned long)backwards);
+
+    if(torn != 0)      { fprintf(stderr, "FAIL: torn snapshot accepted\n"); }
+    if(backwards != 0) { fprintf(stderr, "FAIL: snapshot sequence went backwards\n"); }
+    if(accepted == 0)  { fprintf(stderr, "FAIL: no snapshot read during the run\n"); }
+
+    if(!final_read || final_snapshot.sequence != stress_publications || !stress_coherent(&final_snapshot))
+    {
+        fprintf(stderr, "FAIL: final snapshot is not the last publication\n");
+        return 1;
+    }
+
+    return (torn == 0 && backwards == 0 && accepted != 0) ? 0 : 1;
+}
+
+/**
+ * @brief Publish the pattern of every sequence number in turn
+ * @param[in] argument Unused
+ * @return NULL
+ */
+DRV8305_PRIVATE void *stress_writer(void *argument)
+{
+    uint16_t registers[DRV8305_NUMBER_OF_REGISTERS];
+
+    (void)argument;
+
+    /* drv8305_snapshot_publish() numbers publications 1, 2, ... */
+    for(uint32_t sequence = 1; sequence <= stress_publications; sequence++)
+    {
+        for(int index = 0; index < DRV8305_NUMBER_OF_REGISTERS; index++)
+        {
+            registers[index] = (uint16_t)(sequence * 31U + (uint32_t)index);
+        }
+
+        drv8305_snapshot_publish(&stress_publisher, registers, ~sequence);
+    }
+
+    DRV8305_SHARED_STORE(stress_done, 1U);
+
+    return NULL;
+}
+
+/**
+ * @brief Read until the writer is done, checking every accepted copy
+ * @param[in,out] argument stress_reader_t of this thread
+ * @return NULL
+ */
+DRV8305_PRIVATE void *stress_reader(void *argument)
+{
+    stress_reader_t   *reader = (stress_reader_t *)argument;
+    drv8305_snapshot_t snapshot;
+
+    while(DRV8305_SHARED_LOAD(stress_done) == 0)
+    {
+        if(!drv8305_snapshot_read(&stress_publisher, &snapshot))
+        {
+            reader->rejected++;
+            continue;
+        }
+
+        /* Nothing published yet */
+        if(snapshot.sequence == 0) { continue; }
+
+        reader->accepted++;
+
+        if(!stress_coherent(&snapshot)) { reader->torn++; }
+        if(snapshot.sequence < reader->last) { reader->backwards++; }
+
+        reader->last = snapshot.sequence;
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Check a copy against the pattern of its sequence number
+ * @param[in] snapshot Copy to check
+ * @return true if every field belongs to the same publication
+ */
+DRV8305_PRIVATE bool stress_coherent(const drv8305_snapshot_t *snapshot)
+{
+    if(snapshot->timestamp != ~snapshot->sequence) { return false; }
+
+    for(int index = 0; index < DRV8305_NUMBER_OF_REGISTERS; index++)
+    {
+        if(snapshot->registers[index] != (uint16_t)(snapshot->sequence * 31U + (uint32_t)index)) { return false; }
+    }
+
+    return true;
+}
@@ -0,0 +1,198 @@
+/**
+ * @file drv8305_status_decoder_test.c
+ * @brief DRV8305 Status Decoder Unit Test (Host)
+ * @details Checks the status bit descriptor tables against the bit macros and the set-bit
+ *          decoder against a plain bit loop.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ *   - Every descriptor [reg][n] has mask (1U << n) and a name
+ *   - Each register's masks cover bits 10:0 exactly once
+ *   - Reserved bits carry no severity and no action
+ *   - drv8305_status_register_decode() visits every set bit once, lowest first, for all
+ *     2048 words of every register, and returns the union of their actions
+ *   - drv8305_status_action_mask() and drv8305_ctz16() agree with the tables / a bit loop
+ *
+ * @usage
+ * drv8305_status_decoder_test   (exit code 0 when every check passes)
+ *
+ * @build
+ * CMake target drv8305_status_decoder_test, or from this directory:
+ *   gcc -std=c99 -O2 -I../DRV8305_Driver drv8305_status_decoder_test.c
+ *       ../DRV8305_Driver/DRV8305_Status_Registers/drv8305_status_registers_decoder.c
+ *       -o drv8305_status_decoder_test
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "drv8305_macros.h"
+#include "DRV8305_Status_Registers/drv8305_status_registers_definitions.h"
+#include "DRV8305_Status_Registers/drv8305_status_registers_decoder.h"
+
+/**
+ * @brief Visitor log of one decode call
+ */
+typedef struct
+{
+    uint16_t visited;   // Bits reported so far
+    uint16_t count;     // Visitor calls
+    bool     ordered;   // Every call reported a higher bit than the previous one
+    bool     indexed;   // Every call reported the register being decoded
+} test_visit_t;
+
+DRV8305_PRIVATE void test_visitor (void *self, uint16_t status_index, const drv8305_status_bit_descriptor_t *descriptor);
+DRV8305_PRIVATE bool test_check   (bool condition, const char *what);
+
+DRV8305_PRIVATE uint16_t test_status_index;
+DRV8305_PRIVATE int      test_failures;
+
+int main(void)
+{
+    /* 1. Tables */
+    for(uint16_t reg = 0; reg < (uint16_t)DRV8305_NUMBER_OF_STATUS_REGISTERS; reg++)
+    {
+        uint16_t covered  = 0;
+        bool     exact    = true;
+        bool     named    = true;
+        bool     reserved = true;
+
+        for(uint16_t bit = 0; bit < (uint16_t)DRV8305_STATUS_BITS_PER_REGISTER; bit++)
+        {
+            const drv8305_status_bit_descriptor_t *descriptor = drv8305_status_descriptor_get(reg, bit);
+
+            exact = exact && descriptor != NULL && descriptor->mask == (uint16_t)(1U << bit) && (covered & descriptor->mask) == 0;
+            named = named && descriptor != NULL && descriptor->name != NULL && descriptor->name[0] != '\0';
+
+            if(descriptor == NULL) { continue; }
+
+            covered |= descriptor->mask;
+
+            if(strstr(descriptor->name, "RSVD") != NULL)
+            {
+                reserved = reserved && descriptor->severity == DRV8305_SEVERITY_NONE && descriptor->action == DRV8305_ACTION_NONE;
+            }
+        }
+
+        test_check(exact, "tables: descriptor [reg][n] has mask 1U << n");
+        test_check(named, "tables: every descriptor named");
+        test_check(covered == DRV8305_REGISTER_DATA_MASK, "tables: bits 10:0 covered once");
+        test_check(reserved, "tables: reserved bits inert");
+    }
+
+    test_check(drv8305_status_descriptor_get((uint16_t)DRV8305_NUMBER_OF_STATUS_REGISTERS, 0) == NULL, "tables: register out of range");
+    test_check(drv8305_status_descriptor_get(0, (uint16_t)DRV8305_STATUS_BITS_PER_REGISTER) == NULL, "tables: bit out of range");
+
+    test_check(strcmp(drv8305_status_descriptor_get(1, 10)->name, "DRV8305_VDS_HA") == 0, "tables: 0x02 bit 10 is VDS_HA");
+    test_check(drv8305_status_descriptor_get(1, 10)->phase == DRV8305_PHASE_A &&
+               drv8305_status_descriptor_get(1, 10)->mosfet == DRV8305_MOSFET_HIGH_SIDE, "tables: VDS_HA on phase A high side");
+
+    /* 2. Decoder against a bit loop, every word of every register */
+    bool decoded = true;
+
+    for(uint16_t reg = 0; reg < (uint16_t)DRV8305_NUMBER_OF_STATUS_REGISTERS; reg++)
+    {
+        for(uint16_t word = 0; word <= DRV8305_REGISTER_DATA_MASK; word++)
+        {
+            test_visit_t visit    = { 0, 0, true, true };
+            uint16_t     expected = 0;
+            uint16_t     bits     = 0;
+
+            for(uint16_t bit = 0; bit < (uint16_t)DRV8305_STATUS_BITS_PER_REGISTER; bit++)
+            {
+                if((word & (1U << bit)) == 0) { continue; }
+
+                expected |= (uint16_t)(1U << drv8305_status_descriptors[reg][bit].action);
+                bits++;
+            }
+
+            test_status_index = reg;
+
+            /* Bits 15:11 (address, frame error) must be ignored */
+            uint16_t actions = drv8305_status_register_decode(&visit, reg, (uint16_t)(word | 0xF800U), test_visitor);
+
+            decoded = decoded && actions == expected && visit.visited == word && visit.count == bits && visit.ordered && visit.indexed;
+        }
+    }
+
+    test_check(decoded, "decode: set bits visited once, lowest first, actions united");
+    test_check(drv8305_status_register_decode(NULL, (uint16_t)DRV8305_NUMBER_OF_STATUS_REGISTERS, 0x7FFU, NULL) == 0, "decode: register out of range");
+
+    /* 3. Action masks partition each register */
+    bool partitioned = true;
+
+    for(uint16_t reg = 0; reg < (uint16_t)DRV8305_NUMBER_OF_STATUS_REGISTERS; reg++)
+    {
+        uint16_t all = 0;
+
+        for(int action = DRV8305_ACTION_NONE; action <= DRV8305_ACTION_STOP_MOTOR; action++)
+        {
+            uint16_t mask = drv8305_status_action_mask(reg, (drv8305_status_action_e)action);
+
+            partitioned = partitioned && (all & mask) == 0;
+            all |= mask;
+        }
+
+        partitioned = partitioned && all == DRV8305_REGISTER_DATA_MASK;
+    }
+
+    test_check(partitioned, "action mask: every bit in exactly one action");
+    test_check((drv8305_status_action_mask(1, DRV8305_ACTION_STOP_MOTOR) & DRV8305_VDS_HA) != 0, "action mask: VDS_HA stops the motor");
+
+    /* 4. Portable count-trailing-zeros */
+    bool ctz = true;
+
+    for(uint32_t value = 1; value <= 0xFFFFU; value++)
+    {
+        uint16_t expected = 0;
+
+        while(((value >> expected) & 1U) == 0) { expected++; }
+
+        ctz = ctz && drv8305_ctz16((uint16_t)value) == expected;
+    }
+
+    test_check(ctz, "ctz16: matches a bit loop");
+
+    printf("{\"registers\":%d,\"bits\":%d,\"failures\":%d}\n", DRV8305_NUMBER_OF_STATUS_REGISTERS, DRV8305_STATUS_BITS_PER_REGISTER, test_failures);
+
+    return (test_failures == 0) ? 0 : 1;
+}
+
+/**
+ * @brief Record one visited bit
+ * @param[in] self test_visit_t of the decode call
+ * @param[in] status_index Status register index
+ * @param[in] descriptor Descriptor of the set bit
+ * @return None
+ */
+DRV8305_PRIVATE void test_visitor(void *self, uint16_t status_index, const drv8305_status_bit_descriptor_t *descriptor)
+{
+    test_visit_t *visit = (test_visit_t *)self;
+
+    visit->ordered = visit->ordered && descriptor->mask > visit->visited && (visit->visited & descriptor->mask) == 0;
+    visit->indexed = visit->indexed && status_index == test_status_index;
+    visit->visited |= descriptor->mask;
+    visit->count++;
+}
+
+/**
+ * @brief Report a failed check
+ * @param[in] condition Check result
+ * @param[in] what Description printed on failure
+ * @return bool condition
+ */
+DRV8305_PRIVATE bool test_check(bool condition, const char *what)
+{
+    if(!condition)
+    {
+        fprintf(stderr, "FAIL: %s\n", what);
+        test_failures++;
+    }
+
+    return condition;
+}
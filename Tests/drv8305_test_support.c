@@ -0,0 +1,82 @@
+/**
+ * @file drv8305_test_support.c
+ * @brief DRV8305 Host Unit Test Support - Implementation
+ * @details Implements the simulator fixture and the checks described in drv8305_test_support.h.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * This implementation file contains:
+ *   - The default status and control register handler tables
+ *   - Fixture start and failure accounting
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "drv8305_macros.h"
+#include "DRV8305_API/drv8305_api.h"
+#include "DRV8305_Status_Registers/drv8305_status_registers_handlers.h"
+#include "DRV8305_Control_Registers/drv8305_control_registers_handlers.h"
+#include "drv8305_simulator.h"
+#include "drv8305_test_support.h"
+
+DRV8305_PRIVATE int         drv8305_test_failed;
+DRV8305_PRIVATE const char *drv8305_test_context;
+
+DRV8305_PRIVATE const drv8305_status_register_cb_t drv8305_test_status_callbacks =
+{
+    .drv8305_warning_register_cb    = drv8305_warning_register_handler,
+    .drv8305_ov_vds_register_cb     = drv8305_ov_vds_register_handler,
+    .drv8305_ic_faults_register_cb  = drv8305_ic_faults_register_handler,
+    .drv8305_vgs_faults_register_cb = drv8305_vgs_faults_register_handler
+};
+
+DRV8305_PRIVATE const drv8305_control_register_cb_t drv8305_test_control_callbacks =
+{
+    .drv8305_hs_gate_drive_control_register_cb     = drv8305_hs_gate_drive_register_handler,
+    .drv8305_ls_gate_drive_control_register_cb     = drv8305_ls_gate_drive_register_handler,
+    .drv8305_gate_drive_control_register_cb        = drv8305_gate_drive_register_handler,
+    .drv8305_ic_operation_register_cb              = drv8305_ic_operation_register_handler,
+    .drv8305_shunt_amplifier_control_register_cb   = drv8305_shunt_amplifier_register_handler,
+    .drv8305_voltage_regulator_control_register_cb = drv8305_voltage_regulator_register_handler,
+    .drv8305_vds_sense_control_register_cb         = drv8305_vds_sense_register_handler
+};
+
+DRV8305_PUBLIC void drv8305_test_start(drv8305_sim_t *sim, drv8305_user_object_t *obj)
+{
+    drv8305_sim_init(sim);
+
+    memset(obj, 0, sizeof(*obj));
+    obj->status_callbacks  = drv8305_test_status_callbacks;
+    obj->control_callbacks = drv8305_test_control_callbacks;
+    drv8305_sim_attach(sim, &obj->hw_callbacks);
+
+    drv8305_api_initialize(obj);
+}
+
+DRV8305_PUBLIC bool drv8305_test_check(bool condition, const char *what)
+{
+    if(!condition)
+    {
+        if(drv8305_test_context != NULL) { fprintf(stderr, "FAIL [%s]: %s\n", drv8305_test_context, what); }
+        else                             { fprintf(stderr, "FAIL: %s\n", what); }
+
+        drv8305_test_failed++;
+    }
+
+    return condition;
+}
+
+DRV8305_PUBLIC void drv8305_test_set_context(const char *context)
+{
+    drv8305_test_context = context;
+}
+
+DRV8305_PUBLIC int drv8305_test_failures(void)
+{
+    return drv8305_test_failed;
+}
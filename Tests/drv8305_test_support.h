@@ -0,0 +1,82 @@
+/**
+ * @file drv8305_test_support.h
+ * @brief DRV8305 Host Unit Test Support - Simulator Fixture and Checks
+ * @details Declares the fixture shared by the unit tests that run the driver on the behavioral
+ *          simulator: a fresh model attached to a driver with the default register handlers,
+ *          and the failure counting check every scenario reports through.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * This module provides:
+ *   - drv8305_test_start(): power up the model, clear the driver object, install the status
+ *     and control register handlers, attach the model and initialize the driver
+ *   - drv8305_test_check(): report a failed check on stderr and count it
+ *   - drv8305_test_set_context(): name the variant a test is running (printed with failures)
+ *   - drv8305_test_failures(): failed checks so far
+ *
+ * @usage
+ * @code
+ * drv8305_test_start(&test_sim, &test_drv8305_obj);
+ * drv8305_api_confirm_configuration(&test_drv8305_obj);
+ * ...
+ * drv8305_test_check(drv8305_api_is_configuration_confirm(&test_drv8305_obj), "cold start: configuration confirmed");
+ *
+ * return (drv8305_test_failures() == 0) ? 0 : 1;
+ * @endcode
+ *
+ * @build
+ * Host only; compile drv8305_test_support.c into the test with drv8305_simulator.c and the
+ * driver sources (CMake: drv8305_add_unit_test(<name> SUPPORT ...)).
+ */
+
+#ifndef DRV8305_TEST_SUPPORT_H_
+#define DRV8305_TEST_SUPPORT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+
+#include "drv8305_macros.h"
+#include "DRV8305_API/drv8305_api.h"
+#include "drv8305_simulator.h"
+
+/**
+ * @brief Power up the model and initialize a driver attached to it
+ * @param[out] sim Model state
+ * @param[out] obj Driver object, cleared first; default status and control register handlers
+ * @return None
+ * @note Subscriptions, budgets and drv8305_api_confirm_configuration() stay with the test
+ */
+DRV8305_PUBLIC void drv8305_test_start(drv8305_sim_t *sim, drv8305_user_object_t *obj);
+
+/**
+ * @brief Count and report a failed check
+ * @param[in] condition Check result
+ * @param[in] what Scenario and expectation, e.g. "cold start: configuration confirmed"
+ * @return condition
+ */
+DRV8305_PUBLIC bool drv8305_test_check(bool condition, const char *what);
+
+/**
+ * @brief Name the variant the following checks belong to
+ * @param[in] context Printed as "FAIL [context]: ..." (kept by reference), or NULL for none
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_test_set_context(const char *context);
+
+/**
+ * @brief Failed checks so far
+ * @return Number of drv8305_test_check() calls with a false condition
+ */
+DRV8305_PUBLIC int drv8305_test_failures(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRV8305_TEST_SUPPORT_H_ */
@@ -0,0 +1,475 @@
+/**
+ * @file drv8305_driver_bench.c
+ * @brief DRV8305 Driver Benchmark Suite (Host)
+ * @details Runs the unmodified driver against the behavioral simulator (Tools/drv8305_simulator)
+ *          on a simulated millisecond clock and reports CPU cost and simulated-time figures of
+ *          the polling state machine and of the flow (drv8305_flow.h) as one JSON object.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * Clock: one simulated millisecond is one drv8305_api_master_sm_polling() call (or one
+ * drv8305_flow_polling() call), one drv8305_api_timer() tick and one drv8305_sim_tick().
+ * Both front ends run the same phases on a fresh model and driver:
+ *   1. Cold start: driver initialized and confirmed on a powered-up model; time until
+ *      drv8305_api_is_configuration_confirm()
+ *   2. Steady state: BENCH_STEADY_MS without faults; SPI frames per simulated second and the
+ *      period between register snapshot publications
+ *   3. Fault injection: VDS_HA asserted BENCH_TRIALS times at spread offsets of the scan
+ *      period; time until a status subscriber sees the bit raised, then released and recovered
+ * Every polling call of all phases is timed on the host monotonic clock and accounted to the
+ * main state it started in (the flow has a single account); the cost of an empty clock read
+ * pair is subtracted.
+ * The flow runs on a blocking transport (the response is reported inside the start call). It
+ * has no recovery, so it runs without a protection policy, the bench clears the latched fault
+ * in the model after each release the way the application would, and "recovered" means the
+ * driver has read 0x02 without the bit.
+ *
+ * @output
+ * One JSON object on stdout:
+ *   profile               timing profile the driver was built with (drv8305_timing.h)
+ *   poll_ns               clock overhead and per main state: calls, calls issuing SPI frames,
+ *                         mean and max host nanoseconds per call
+ *   confirm_ms            cold start to configuration confirmed
+ *   spi_frames_per_s      steady state, per simulated second
+ *   snapshot_refresh_ms   steady state, simulated ms between publications (min/mean/max)
+ *   fault_detection_ms    injection to subscriber notification (min/mean/max)
+ *   flow                  the same figures for drv8305_flow_polling(); poll_ns is one account
+ *
+ * @build
+ * Compile together with the simulator and every driver source except drv8305_app.c, from this
+ * directory:
+ *   gcc -std=c99 -O2 -I../../DRV8305_Driver -I../drv8305_simulator drv8305_driver_bench.c
+ *       ../drv8305_simulator/drv8305_simulator.c <driver sources> -o drv8305_driver_bench
+ * or build the drv8305_driver_bench CMake target. Add the timing profile flags of the driver
+ * build under test (e.g. -DDRV8305_TIMING_PROFILE=DRV8305_TIMING_PROFILE_BURST).
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "drv8305_macros.h"
+#include "drv8305_register_map.h"
+#include "DRV8305_API/drv8305_api.h"
+#include "DRV8305_Flow/drv8305_flow.h"
+#include "DRV8305_Status_Registers/drv8305_status_registers_definitions.h"
+#include "DRV8305_Status_Registers/drv8305_status_registers_handlers.h"
+#include "DRV8305_Control_Registers/drv8305_control_registers_handlers.h"
+#include "drv8305_simulator.h"
+
+/** @brief Simulated milliseconds of the steady state phase */
+#define BENCH_STEADY_MS       (uint32_t)60000
+/** @brief Number of fault injections */
+#define BENCH_TRIALS          (int)200
+/** @brief Upper bound of simulated ticks per phase before giving up */
+#define BENCH_TICK_LIMIT      (uint32_t)100000
+/** @brief Fault injected into status register 0x02 */
+#define BENCH_INJECTED_FAULT  DRV8305_VDS_HA
+/** @brief Clock read pairs averaged for the overhead estimate */
+#define BENCH_CLOCK_SAMPLES   (int)100000
+/** @brief Number of drv8305_sm_state_e values */
+#define BENCH_MAIN_STATES     (int)(DRV8305_DELAY_STATE + 1)
+
+/**
+ * @brief Polling cost accumulated for one main state
+ */
+typedef struct
+{
+    uint32_t calls;
+    uint32_t frame_calls; // Calls that issued at least one SPI frame
+    uint64_t ns_sum;
+    uint64_t ns_max;
+} bench_state_cost_t;
+
+/**
+ * @brief Minimum, sum and maximum of a series of simulated millisecond intervals
+ */
+typedef struct
+{
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum;
+} bench_interval_t;
+
+typedef enum
+{
+    BENCH_STATE_MACHINE,  // -> drv8305_api_master_sm_polling()
+    BENCH_FLOW            // -> drv8305_flow_polling() on a blocking transport
+} bench_front_end_e;
+
+/**
+ * @brief Simulated-time figures of one run
+ */
+typedef struct
+{
+    bool             ok;             // Confirmed, and every injected fault detected
+    uint32_t         confirm_ms;
+    uint32_t         steady_frames;
+    bench_interval_t refresh;
+    bench_interval_t latency;
+} bench_result_t;
+
+DRV8305_PRIVATE void     bench_run               (bench_front_end_e front_end, bench_result_t *result);
+DRV8305_PRIVATE void     bench_step              (void);
+DRV8305_PRIVATE void     bench_cost_add          (bench_state_cost_t *cost, uint64_t elapsed, bool frames);
+DRV8305_PRIVATE void     bench_cost_print        (const char *name, const bench_state_cost_t *cost);
+DRV8305_PRIVATE void     bench_result_print      (const bench_result_t *result);
+DRV8305_PRIVATE bool     bench_flow_transfer     (void *context, uint16_t frame);
+DRV8305_PRIVATE bool     bench_run_until         (bool (*condition)(void));
+DRV8305_PRIVATE bool     bench_confirmed         (void);
+DRV8305_PRIVATE bool     bench_detected          (void);
+DRV8305_PRIVATE bool     bench_recovered         (void);
+DRV8305_PRIVATE void     bench_on_status_change  (void *self, uint16_t status_index, uint16_t data, uint16_t raised, uint16_t cleared);
+DRV8305_PRIVATE void     bench_interval_add      (bench_interval_t *interval, uint32_t value);
+DRV8305_PRIVATE void     bench_interval_print    (const char *name, const bench_interval_t *interval);
+DRV8305_PRIVATE uint64_t bench_clock_overhead_ns (void);
+DRV8305_PRIVATE uint64_t bench_now_ns            (void);
+
+DRV8305_PRIVATE drv8305_sim_t         bench_sim;
+DRV8305_PRIVATE drv8305_user_object_t bench_drv8305_obj;
+DRV8305_PRIVATE drv8305_flow_t        bench_flow;
+DRV8305_PRIVATE bench_front_end_e     bench_front_end;
+DRV8305_PRIVATE bench_state_cost_t    bench_costs[BENCH_MAIN_STATES];
+DRV8305_PRIVATE bench_state_cost_t    bench_flow_cost;
+DRV8305_PRIVATE uint64_t              bench_overhead_ns;
+DRV8305_PRIVATE bool                  bench_fault_seen;
+
+DRV8305_PRIVATE const char *const bench_state_names[BENCH_MAIN_STATES] =
+{
+    "init", "idle", "status", "control", "recovery", "delay"
+};
+
+DRV8305_PRIVATE const drv8305_status_register_cb_t bench_status_callbacks =
+{
+    .drv8305_warning_register_cb    = drv8305_warning_register_handler,
+    .drv8305_ov_vds_register_cb     = drv8305_ov_vds_register_handler,
+    .drv8305_ic_faults_register_cb  = drv8305_ic_faults_register_handler,
+    .drv8305_vgs_faults_register_cb = drv8305_vgs_faults_register_handler
+};
+
+DRV8305_PRIVATE const drv8305_control_register_cb_t bench_control_callbacks =
+{
+    .drv8305_hs_gate_drive_control_register_cb     = drv8305_hs_gate_drive_register_handler,
+    .drv8305_ls_gate_drive_control_register_cb     = drv8305_ls_gate_drive_register_handler,
+    .drv8305_gate_drive_control_register_cb        = drv8305_gate_drive_register_handler,
+    .drv8305_ic_operation_register_cb              = drv8305_ic_operation_register_handler,
+    .drv8305_shunt_amplifier_control_register_cb   = drv8305_shunt_amplifier_register_handler,
+    .drv8305_voltage_regulator_control_register_cb = drv8305_voltage_regulator_register_handler,
+    .drv8305_vds_sense_control_register_cb         = drv8305_vds_sense_register_handler
+};
+
+/**@brief: Status 0x02 bit the detection subscriber waits for **/
+DRV8305_PRIVATE const uint16_t bench_interest[DRV8305_NUMBER_OF_STATUS_REGISTERS] = { 0, BENCH_INJECTED_FAULT, 0, 0 };
+
+int main(void)
+{
+    bench_result_t state_machine, flow;
+
+    bench_overhead_ns = bench_clock_overhead_ns();
+
+    bench_run(BENCH_STATE_MACHINE, &state_machine);
+    uint32_t simulated_ms = bench_sim.time;
+    state_machine.ok = state_machine.ok && bench_drv8305_obj.state.main_state != DRV8305_INIT_STATE;
+
+    bench_run(BENCH_FLOW, &flow);
+
+    printf("{\"benchmark\":\"driver\",\"profile\":\"%s\",\"simulated_ms\":%lu,",
+#if defined(DRV8305_RUNTIME_TIMING)
+           "runtime",
+#elif DRV8305_TIMING_PROFILE == DRV8305_TIMING_PROFILE_BURST
+           "burst",
+#else
+           "standard",
+#endif
+           (unsigned long)simulated_ms);
+
+    printf("\"poll_ns\":{\"clock_overhead\":%llu", (unsigned long long)bench_overhead_ns);
+
+    for(int state = 0; state < BENCH_MAIN_STATES; state++)
+    {
+        printf(",");
+        bench_cost_print(bench_state_names[state], &bench_costs[state]);
+    }
+
+    printf("},");
+    bench_result_print(&state_machine);
+
+    printf(",\"flow\":{\"simulated_ms\":%lu,", (unsigned long)bench_sim.time);
+    bench_cost_print("poll_ns", &bench_flow_cost);
+    printf(",");
+    bench_result_print(&flow);
+    printf("}}\n");
+
+    return (state_machine.ok && flow.ok) ? 0 : 1;
+}
+
+/**
+ * @brief Run every phase with one front end on a fresh model and driver
+ * @param[in] front_end Polling front end under test
+ * @param[out] result Simulated-time figures
+ * @return None
+ */
+DRV8305_PRIVATE void bench_run(bench_front_end_e front_end, bench_result_t *result)
+{
+    uint32_t           seed = 0x8305U;
+    uint32_t           last_publication = 0, last_sequence = 0;
+    drv8305_snapshot_t snapshot;
+
+    bench_front_end = front_end;
+
+    memset(result, 0, sizeof(bench_result_t));
+    result->refresh.min = UINT32_MAX;
+    result->latency.min = UINT32_MAX;
+
+    drv8305_sim_init(&bench_sim);
+
+    memset(&bench_drv8305_obj, 0, sizeof(bench_drv8305_obj));
+    bench_drv8305_obj.status_callbacks  = bench_status_callbacks;
+    bench_drv8305_obj.control_callbacks = bench_control_callbacks;
+    drv8305_sim_attach(&bench_sim, &bench_drv8305_obj.hw_callbacks);
+
+    drv8305_api_status_subscribe(&bench_drv8305_obj, bench_on_status_change, bench_interest);
+
+    /* The flow has no recovery to bring EN_GATE back after a shutdown, so it runs without the policy */
+    if(front_end == BENCH_STATE_MACHINE) { drv8305_api_set_protection_policy(&bench_drv8305_obj, NULL, NULL, NULL); }
+
+    drv8305_api_initialize(&bench_drv8305_obj);
+
+    if(front_end == BENCH_STATE_MACHINE)
+    {
+        drv8305_api_set_recovery_policy(&bench_drv8305_obj, NULL, true);
+        drv8305_api_confirm_configuration(&bench_drv8305_obj);
+    }
+    else
+    {
+        drv8305_flow_init(&bench_flow, &bench_drv8305_obj, bench_flow_transfer, NULL);
+    }
+
+    /* 1. Cold start */
+    bool confirmed = bench_run_until(bench_confirmed);
+    result->confirm_ms = bench_sim.time;
+
+    /* 2. Steady state */
+    result->steady_frames = bench_sim.frames;
+
+    for(uint32_t tick = 0; tick < BENCH_STEADY_MS; tick++)
+    {
+        bench_step();
+
+        if(drv8305_api_get_register_snapshot(&bench_drv8305_obj, &snapshot) && snapshot.sequence != last_sequence)
+        {
+            if(last_sequence != 0) { bench_interval_add(&result->refresh, bench_sim.time - last_publication); }
+
+            last_sequence    = snapshot.sequence;
+            last_publication = bench_sim.time;
+        }
+    }
+
+    result->steady_frames = bench_sim.frames - result->steady_frames;
+
+    /* 3. Fault injection at spread offsets of the scan period */
+    for(int trial = 0; trial < BENCH_TRIALS; trial++)
+    {
+        seed = seed * 1664525UL + 1013904223UL;
+        uint32_t offset = (seed >> 8) % (uint32_t)(DRV8305_STATUS_POLLING_INTERVAL_MS + 4 * DRV8305_REGISTER_SWITCH_DELAY_MS);
+
+        for(uint32_t tick = 0; tick < offset; tick++)
+        {
+            bench_step();
+        }
+
+        uint32_t injected = bench_sim.time;
+
+        bench_fault_seen = false;
+        drv8305_sim_inject(&bench_sim, DRV8305_SIM_ASSERT, DRV8305_STATUS_02_REG_ADDR, BENCH_INJECTED_FAULT);
+
+        if(bench_run_until(bench_detected)) { bench_interval_add(&result->latency, bench_sim.time - injected); }
+
+        drv8305_sim_inject(&bench_sim, DRV8305_SIM_RELEASE, DRV8305_STATUS_02_REG_ADDR, BENCH_INJECTED_FAULT);
+
+        /* No recovery in the flow: stand in for the application clearing the fault */
+        if(front_end == BENCH_FLOW) { bench_sim.latched[DRV8305_STATUS_02_REG_ADDR] &= (uint16_t)~BENCH_INJECTED_FAULT; }
+
+        bench_run_until(bench_recovered);
+    }
+
+    result->ok = confirmed && result->latency.count == (uint32_t)BENCH_TRIALS;
+}
+
+/**
+ * @brief One simulated millisecond: one timed polling call, one timer tick, one model tick
+ * @return None
+ */
+DRV8305_PRIVATE void bench_step(void)
+{
+    drv8305_sm_state_e state  = bench_drv8305_obj.state.main_state;
+    uint32_t           frames = bench_sim.frames;
+    uint64_t           start  = bench_now_ns();
+
+    if(bench_front_end == BENCH_FLOW)
+    {
+        drv8305_flow_polling(&bench_flow);
+    }
+    else
+    {
+        drv8305_api_master_sm_polling(&bench_drv8305_obj);
+    }
+
+    uint64_t elapsed = bench_now_ns() - start;
+
+    elapsed = (elapsed > bench_overhead_ns) ? (elapsed - bench_overhead_ns) : 0;
+
+    if(bench_front_end == BENCH_FLOW)
+    {
+        bench_cost_add(&bench_flow_cost, elapsed, bench_sim.frames != frames);
+    }
+    else if((int)state < BENCH_MAIN_STATES)
+    {
+        bench_cost_add(&bench_costs[state], elapsed, bench_sim.frames != frames);
+    }
+
+    drv8305_api_timer(&bench_drv8305_obj);
+    drv8305_sim_tick(&bench_sim);
+}
+
+/**
+ * @brief Step until a condition holds
+ * @param[in] condition Checked after every step
+ * @return true if it held within BENCH_TICK_LIMIT steps
+ */
+DRV8305_PRIVATE bool bench_run_until(bool (*condition)(void))
+{
+    for(uint32_t tick = 0; tick < BENCH_TICK_LIMIT; tick++)
+    {
+        bench_step();
+
+        if(condition()) { return true; }
+    }
+
+    return false;
+}
+
+DRV8305_PRIVATE bool bench_confirmed(void)
+{
+    return drv8305_api_is_configuration_confirm(&bench_drv8305_obj);
+}
+
+DRV8305_PRIVATE bool bench_detected(void)
+{
+    return bench_fault_seen;
+}
+
+DRV8305_PRIVATE bool bench_recovered(void)
+{
+    if(bench_front_end == BENCH_FLOW)
+    {
+        return (bench_drv8305_obj.register_manager[DRV8305_STATUS_02_ARRAY_INDEX].data & BENCH_INJECTED_FAULT) == 0;
+    }
+
+    return drv8305_api_get_recovery_status(&bench_drv8305_obj) == DRV8305_RECOVERY_IDLE && drv8305_sim_gates_active(&bench_sim);
+}
+
+/**
+ * @brief Blocking transport of the flow run: the model answers inside the start call
+ */
+DRV8305_PRIVATE bool bench_flow_transfer(void *context, uint16_t frame)
+{
+    (void)context;
+
+    drv8305_flow_transfer_complete(&bench_flow, drv8305_sim_transfer(&bench_sim, frame));
+
+    return true;
+}
+
+DRV8305_PRIVATE void bench_on_status_change(void *self, uint16_t status_index, uint16_t data, uint16_t raised, uint16_t cleared)
+{
+    (void)self; (void)data; (void)cleared;
+
+    if(status_index == DRV8305_STATUS_02_ARRAY_INDEX && (raised & BENCH_INJECTED_FAULT) != 0)
+    {
+        bench_fault_seen = true;
+    }
+}
+
+DRV8305_PRIVATE void bench_cost_add(bench_state_cost_t *cost, uint64_t elapsed, bool frames)
+{
+    cost->calls++;
+    cost->ns_sum += elapsed;
+    if(elapsed > cost->ns_max) { cost->ns_max = elapsed; }
+    if(frames)                 { cost->frame_calls++;    }
+}
+
+DRV8305_PRIVATE void bench_cost_print(const char *name, const bench_state_cost_t *cost)
+{
+    printf("\"%s\":{\"calls\":%lu,\"frame_calls\":%lu,\"mean\":%.1f,\"max\":%llu}",
+           name, (unsigned long)cost->calls, (unsigned long)cost->frame_calls,
+           (cost->calls != 0) ? (double)cost->ns_sum / cost->calls : 0.0, (unsigned long long)cost->ns_max);
+}
+
+DRV8305_PRIVATE void bench_result_print(const bench_result_t *result)
+{
+    printf("\"confirm_ms\":%lu,\"spi_frames_per_s\":%.2f,",
+           (unsigned long)result->confirm_ms, (double)result->steady_frames * 1000.0 / BENCH_STEADY_MS);
+
+    bench_interval_print("snapshot_refresh_ms", &result->refresh);
+    printf(",");
+    bench_interval_print("fault_detection_ms", &result->latency);
+}
+
+DRV8305_PRIVATE void bench_interval_add(bench_interval_t *interval, uint32_t value)
+{
+    interval->count++;
+    interval->sum += value;
+    if(value < interval->min) { interval->min = value; }
+    if(value > interval->max) { interval->max = value; }
+}
+
+DRV8305_PRIVATE void bench_interval_print(const char *name, const bench_interval_t *interval)
+{
+    if(interval->count == 0)
+    {
+        printf("\"%s\":{\"count\":0}", name);
+        return;
+    }
+
+    printf("\"%s\":{\"count\":%lu,\"min\":%lu,\"mean\":%.1f,\"max\":%lu}", name, (unsigned long)interval->count,
+           (unsigned long)interval->min, (double)interval->sum / interval->count, (unsigned long)interval->max);
+}
+
+/**
+ * @brief Mean cost of two back-to-back clock reads
+ * @return uint64_t Nanoseconds subtracted from every timed polling call
+ */
+DRV8305_PRIVATE uint64_t bench_clock_overhead_ns(void)
+{
+    uint64_t sum = 0;
+
+    for(int sample = 0; sample < BENCH_CLOCK_SAMPLES; sample++)
+    {
+        uint64_t start = bench_now_ns();
+        sum += bench_now_ns() - start;
+    }
+
+    return sum / BENCH_CLOCK_SAMPLES;
+}
+
+/**
+ * @brief Monotonic host time
+ * @return uint64_t Nanoseconds
+ */
+DRV8305_PRIVATE uint64_t bench_now_ns(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
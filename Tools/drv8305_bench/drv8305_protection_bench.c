@@ -0,0 +1,233 @@
+/**
+ * @file drv8305_protection_bench.c
+ * @brief DRV8305 Protective Shutdown Latency Benchmark (Host)
+ * @details Runs the unmodified driver against a minimal SPI register model and a simulated
+ *          millisecond clock, injects VDS faults at varying points of the polling cycle and
+ *          measures the latency until EN_GATE is driven low by the protective policy.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * Reports two latencies per trial:
+ *   - Detection latency: simulated ticks from fault injection to EN_GATE low (dominated by
+ *     DRV8305_STATUS_POLLING_INTERVAL_MS and the per-register delays)
+ *   - Reaction latency: host nanoseconds from the SPI frame carrying the fault returning to
+ *     the driver until drv8305_disable_io() is called (the inline policy cost)
+ *
+ * @build
+ * Compile together with every driver source except drv8305_app.c, from this directory:
+ *   gcc -std=c99 -O2 -I../../DRV8305_Driver drv8305_protection_bench.c <driver sources>
+ *       -o drv8305_protection_bench
+ *
+ * @output
+ * One JSON object on stdout.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "drv8305_macros.h"
+#include "DRV8305_API/drv8305_api.h"
+#include "DRV8305_Status_Registers/drv8305_status_registers_definitions.h"
+#include "DRV8305_Status_Registers/drv8305_status_registers_handlers.h"
+#include "DRV8305_Control_Registers/drv8305_control_registers_handlers.h"
+
+/** @brief Number of fault injections */
+#define BENCH_TRIALS          (int)1000
+/** @brief Upper bound of simulated ticks per phase before giving up */
+#define BENCH_TICK_LIMIT      (uint32_t)100000
+/** @brief Fault injected into status register 0x02 */
+#define BENCH_INJECTED_FAULT  DRV8305_VDS_HA
+
+DRV8305_PRIVATE uint16_t bench_spi_callback       (uint16_t data);
+DRV8305_PRIVATE bool     bench_fault_pin_callback (void);
+DRV8305_PRIVATE void     bench_enable_callback    (void);
+DRV8305_PRIVATE void     bench_disable_callback   (void);
+DRV8305_PRIVATE void     bench_nop_callback       (void);
+DRV8305_PRIVATE uint64_t bench_now_ns             (void);
+DRV8305_PRIVATE void     bench_step               (void);
+
+DRV8305_PRIVATE uint16_t bench_registers[16];
+DRV8305_PRIVATE bool     bench_en_gate;
+DRV8305_PRIVATE uint64_t bench_fault_frame_ns;
+DRV8305_PRIVATE uint64_t bench_en_gate_low_ns;
+
+DRV8305_PRIVATE drv8305_user_object_t bench_drv8305_obj =
+{
+    .hw_callbacks =
+    {
+        .drv8305_disable_io                          = bench_disable_callback,
+        .drv8305_enable_io                           = bench_enable_callback,
+        .drv8305_sleep_io                            = bench_nop_callback,
+        .drv8305_wake_up_io                          = bench_nop_callback,
+        .drv8305_get_fault_pin_status                = bench_fault_pin_callback,
+        .drv8305_spi_write_and_read_from_register_cb = bench_spi_callback
+    },
+
+    .status_callbacks =
+    {
+        .drv8305_warning_register_cb    = drv8305_warning_register_handler,
+        .drv8305_ov_vds_register_cb     = drv8305_ov_vds_register_handler,
+        .drv8305_ic_faults_register_cb  = drv8305_ic_faults_register_handler,
+        .drv8305_vgs_faults_register_cb = drv8305_vgs_faults_register_handler
+    },
+
+    .control_callbacks =
+    {
+        .drv8305_hs_gate_drive_control_register_cb     = drv8305_hs_gate_drive_register_handler,
+        .drv8305_ls_gate_drive_control_register_cb     = drv8305_ls_gate_drive_register_handler,
+        .drv8305_gate_drive_control_register_cb        = drv8305_gate_drive_register_handler,
+        .drv8305_ic_operation_register_cb              = drv8305_ic_operation_register_handler,
+        .drv8305_shunt_amplifier_control_register_cb   = drv8305_shunt_amplifier_register_handler,
+        .drv8305_voltage_regulator_control_register_cb = drv8305_voltage_regulator_register_handler,
+        .drv8305_vds_sense_control_register_cb         = drv8305_vds_sense_register_handler
+    }
+};
+
+int main(void)
+{
+    uint32_t seed         = 0x8305U;
+    uint32_t ticks_min    = 0xFFFFFFFFUL, ticks_max = 0;
+    uint64_t ticks_sum    = 0;
+    uint64_t reaction_min = UINT64_MAX, reaction_max = 0, reaction_sum = 0;
+    int      completed    = 0;
+
+    bench_en_gate = true;
+
+    drv8305_api_initialize(&bench_drv8305_obj);
+    drv8305_api_confirm_configuration(&bench_drv8305_obj);
+    drv8305_api_set_protection_policy(&bench_drv8305_obj, NULL, NULL, NULL);
+
+    for(uint32_t tick = 0; tick < BENCH_TICK_LIMIT && !drv8305_api_is_configuration_confirm(&bench_drv8305_obj); tick++)
+    {
+        bench_step();
+    }
+
+    for(int trial = 0; trial < BENCH_TRIALS; trial++)
+    {
+        /* Spread injections over the whole status polling period */
+        seed = seed * 1664525UL + 1013904223UL;
+        uint32_t offset = (seed >> 8) % (uint32_t)(DRV8305_STATUS_POLLING_INTERVAL_MS + 4 * DRV8305_REGISTER_SWITCH_DELAY_MS);
+
+        for(uint32_t tick = 0; tick < offset; tick++)
+        {
+            bench_step();
+        }
+
+        bench_registers[DRV8305_STATUS_02_REG_ADDR] = BENCH_INJECTED_FAULT;
+
+        uint32_t ticks = 0;
+
+        while(bench_en_gate && ticks < BENCH_TICK_LIMIT)
+        {
+            bench_step();
+            ticks++;
+        }
+
+        if(!bench_en_gate)
+        {
+            uint64_t reaction = bench_en_gate_low_ns - bench_fault_frame_ns;
+
+            ticks_sum    += ticks;
+            reaction_sum += reaction;
+            if(ticks    < ticks_min)    { ticks_min    = ticks;    }
+            if(ticks    > ticks_max)    { ticks_max    = ticks;    }
+            if(reaction < reaction_min) { reaction_min = reaction; }
+            if(reaction > reaction_max) { reaction_max = reaction; }
+            completed++;
+        }
+
+        /* Clear fault, let one full scan observe the clean register, re-arm EN_GATE */
+        bench_registers[DRV8305_STATUS_02_REG_ADDR] = 0;
+
+        for(uint32_t tick = 0; tick < (uint32_t)(DRV8305_STATUS_POLLING_INTERVAL_MS + 8 * DRV8305_REGISTER_SWITCH_DELAY_MS); tick++)
+        {
+            bench_step();
+        }
+
+        drv8305_api_ic_enable(&bench_drv8305_obj);
+    }
+
+    if(completed == 0) { completed = 1; ticks_min = 0; reaction_min = 0; }
+
+    printf("{\"benchmark\":\"protective_shutdown\",\"trials\":%d,\"shutdowns\":%lu,"
+           "\"detection_ticks\":{\"min\":%lu,\"mean\":%.1f,\"max\":%lu},"
+           "\"reaction_ns\":{\"min\":%llu,\"mean\":%.1f,\"max\":%llu}}\n",
+           BENCH_TRIALS, (unsigned long)bench_drv8305_obj.protection.shutdown_count,
+           (unsigned long)ticks_min, (double)ticks_sum / completed, (unsigned long)ticks_max,
+           (unsigned long long)reaction_min, (double)reaction_sum / completed, (unsigned long long)reaction_max);
+
+    return 0;
+}
+
+/**
+ * @brief One simulated millisecond: one polling call followed by one timer tick
+ * @return None
+ */
+DRV8305_PRIVATE void bench_step(void)
+{
+    drv8305_api_master_sm_polling(&bench_drv8305_obj);
+    drv8305_api_timer(&bench_drv8305_obj);
+}
+
+/**
+ * @brief Register model: writes store data, reads return [fault][address][data]
+ * @param[in] data SPI frame from the driver
+ * @return uint16_t Response frame
+ */
+DRV8305_PRIVATE uint16_t bench_spi_callback(uint16_t data)
+{
+    uint16_t address = (data >> 11) & 0x0FU;
+
+    if((data & 0x8000U) == 0)
+    {
+        bench_registers[address] = data & DRV8305_REGISTER_DATA_MASK;
+        return 0;
+    }
+
+    if(address == DRV8305_STATUS_02_REG_ADDR && bench_registers[address] != 0)
+    {
+        bench_fault_frame_ns = bench_now_ns();
+    }
+
+    return (uint16_t)((address << 11) | bench_registers[address]);
+}
+
+DRV8305_PRIVATE bool bench_fault_pin_callback(void)
+{
+    return true;
+}
+
+DRV8305_PRIVATE void bench_enable_callback(void)
+{
+    bench_en_gate = true;
+}
+
+DRV8305_PRIVATE void bench_disable_callback(void)
+{
+    bench_en_gate_low_ns = bench_now_ns();
+    bench_en_gate        = false;
+}
+
+DRV8305_PRIVATE void bench_nop_callback(void)
+{
+}
+
+/**
+ * @brief Monotonic host time
+ * @return uint64_t Nanoseconds
+ */
+DRV8305_PRIVATE uint64_t bench_now_ns(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
@@ -0,0 +1,279 @@
+/**
+ * @file drv8305_blob_tool.c
+ * @brief DRV8305 Configuration Blob Converter (Host)
+ * @details Converts between the binary configuration blob (drv8305_config_blob.h) and a
+ *          readable "group.field = value" text form for manufacturing and tuning.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * Commands:
+ *   template [text]        write the default configuration (drv8305_configuration.c) as text
+ *   encode <text> <blob>   text to blob; fields not listed keep their default value
+ *   decode <blob> [text]   validate a blob and write it as text (stdout if no file)
+ *
+ * @text_format
+ *   # comment
+ *   variant = 1                      (drv8305_device_variant_e)
+ *   hs_gate_drive.isink = 0x4        (field names of drv8305_configuration_t, decimal or 0x hex)
+ *
+ * @blob_file
+ * 13 words, each written as two octets, low octet first (26 bytes).
+ *
+ * @build
+ * From this directory:
+ *   gcc -std=c99 -O2 -I../../DRV8305_Driver drv8305_blob_tool.c
+ *       ../../DRV8305_Driver/DRV8305_Config/drv8305_configuration.c
+ *       ../../DRV8305_Driver/DRV8305_Config/drv8305_packed_configuration.c
+ *       ../../DRV8305_Driver/DRV8305_Config/drv8305_config_blob.c
+ *       ../../DRV8305_Driver/DRV8305_Utils/drv8305_crc.c -o drv8305_blob_tool
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#include "drv8305_macros.h"
+#include "DRV8305_Config/drv8305_configuration.h"
+#include "DRV8305_Config/drv8305_packed_configuration.h"
+#include "DRV8305_Config/drv8305_config_blob.h"
+
+/** @brief Longest accepted text line */
+#define TOOL_LINE_LENGTH  (int)256
+
+typedef struct
+{
+    const char *name;   // "group.field"
+    uint16_t    index;  // Packed word index
+    uint16_t    shift;
+    uint16_t    mask;
+} tool_field_t;
+
+#define TOOL_FIELD(group, field, ...)                                                    \
+    { #group "." #field, (uint16_t)DRV8305_REGISTER_IMAGE_INDEX(DRV8305_FIELD_INDEX(__VA_ARGS__)), \
+      (uint16_t)DRV8305_FIELD_OFFSET(__VA_ARGS__), (uint16_t)DRV8305_FIELD_MAX(__VA_ARGS__) },
+
+DRV8305_PRIVATE const tool_field_t tool_fields[] =
+{
+    DRV8305_PACKED_CONFIGURATION_FIELDS(TOOL_FIELD)
+};
+
+#define TOOL_FIELD_COUNT  (int)(sizeof(tool_fields) / sizeof(tool_fields[0]))
+
+DRV8305_PRIVATE const char *tool_blob_status_names[] =
+{
+    "ok", "bad magic", "bad version", "bad length", "bad variant", "bad crc", "bad field"
+};
+
+extern drv8305_configuration_t default_configuration;
+
+DRV8305_PRIVATE int  tool_template (const char *text_path);
+DRV8305_PRIVATE int  tool_encode   (const char *text_path, const char *blob_path);
+DRV8305_PRIVATE int  tool_decode   (const char *blob_path, const char *text_path);
+DRV8305_PRIVATE void tool_write_text(FILE *file, const drv8305_packed_configuration_t *cfg, uint16_t variant);
+DRV8305_PRIVATE int  tool_usage    (void);
+
+int main(int argc, char **argv)
+{
+    if(argc >= 2 && strcmp(argv[1], "template") == 0)            { return tool_template((argc > 2) ? argv[2] : NULL); }
+    if(argc == 4 && strcmp(argv[1], "encode") == 0)              { return tool_encode(argv[2], argv[3]); }
+    if((argc == 3 || argc == 4) && strcmp(argv[1], "decode") == 0) { return tool_decode(argv[2], (argc > 3) ? argv[3] : NULL); }
+
+    return tool_usage();
+}
+
+DRV8305_PRIVATE int tool_usage(void)
+{
+    fprintf(stderr, "usage: drv8305_blob_tool template [text]\n"
+                    "       drv8305_blob_tool encode <text> <blob>\n"
+                    "       drv8305_blob_tool decode <blob> [text]\n");
+    return 2;
+}
+
+/**
+ * @brief Write the default configuration as text
+ * @param[in] text_path Output file, NULL for stdout
+ * @return int Exit code
+ */
+DRV8305_PRIVATE int tool_template(const char *text_path)
+{
+    drv8305_packed_configuration_t cfg;
+    FILE                          *file = (text_path) ? fopen(text_path, "w") : stdout;
+
+    if(!file) { perror(text_path); return 1; }
+
+    drv8305_configuration_pack(&cfg, &default_configuration);
+    tool_write_text(file, &cfg, DRV8305_VARIANT_ANY);
+
+    if(text_path) { fclose(file); }
+
+    return 0;
+}
+
+/**
+ * @brief Parse a text configuration and write the blob
+ * @param[in] text_path Input text file
+ * @param[in] blob_path Output blob file
+ * @return int Exit code
+ */
+DRV8305_PRIVATE int tool_encode(const char *text_path, const char *blob_path)
+{
+    drv8305_packed_configuration_t cfg;
+    drv8305_config_blob_t          blob;
+    char                           line[TOOL_LINE_LENGTH];
+    char                           key[TOOL_LINE_LENGTH];
+    long                           value;
+    uint16_t                       variant = DRV8305_VARIANT_ANY;
+    int                            line_number = 0;
+    FILE                          *file = fopen(text_path, "r");
+
+    if(!file) { perror(text_path); return 1; }
+
+    drv8305_configuration_pack(&cfg, &default_configuration);
+
+    while(fgets(line, sizeof(line), file))
+    {
+        char *comment = strchr(line, '#');
+        char *cursor  = line;
+
+        line_number++;
+
+        if(comment) { *comment = '\0'; }
+        while(isspace((unsigned char)*cursor)) { cursor++; }
+        if(*cursor == '\0') { continue; }
+
+        if(sscanf(cursor, " %255[^= \t] = %li", key, &value) != 2)
+        {
+            fprintf(stderr, "%s:%d: expected 'name = value'\n", text_path, line_number);
+            fclose(file);
+            return 1;
+        }
+
+        if(strcmp(key, "variant") == 0)
+        {
+            variant = (uint16_t)value;
+            continue;
+        }
+
+        int index = 0;
+
+        while(index < TOOL_FIELD_COUNT && strcmp(key, tool_fields[index].name) != 0) { index++; }
+
+        if(index == TOOL_FIELD_COUNT || value < 0 || value > (long)tool_fields[index].mask)
+        {
+            fprintf(stderr, "%s:%d: %s '%s'\n", text_path, line_number, (index == TOOL_FIELD_COUNT) ? "unknown field" : "value out of range for", key);
+            fclose(file);
+            return 1;
+        }
+
+        const tool_field_t *field = &tool_fields[index];
+
+        cfg.word[field->index] = (uint16_t)((cfg.word[field->index] & ~(field->mask << field->shift)) | ((uint16_t)value << field->shift));
+    }
+
+    fclose(file);
+
+    drv8305_config_blob_serialize(&blob, &cfg, (drv8305_device_variant_e)variant);
+
+    drv8305_blob_status_e status = drv8305_config_blob_validate(&blob, DRV8305_VARIANT_ANY);
+
+    if(status != DRV8305_BLOB_OK)
+    {
+        fprintf(stderr, "%s: %s\n", text_path, tool_blob_status_names[status]);
+        return 1;
+    }
+
+    file = fopen(blob_path, "wb");
+    if(!file) { perror(blob_path); return 1; }
+
+    const uint16_t *words = (const uint16_t *)&blob;
+
+    for(int index = 0; index < DRV8305_CONFIG_BLOB_WORDS; index++)
+    {
+        fputc(words[index] & 0xFF, file);
+        fputc(words[index] >> 8, file);
+    }
+
+    fclose(file);
+
+    return 0;
+}
+
+/**
+ * @brief Validate a blob file and write it as text
+ * @param[in] blob_path Input blob file
+ * @param[in] text_path Output text file, NULL for stdout
+ * @return int Exit code
+ */
+DRV8305_PRIVATE int tool_decode(const char *blob_path, const char *text_path)
+{
+    drv8305_config_blob_t          blob;
+    drv8305_packed_configuration_t cfg;
+    uint16_t                      *words = (uint16_t *)&blob;
+    unsigned char                  octets[2 * DRV8305_CONFIG_BLOB_WORDS + 1];
+    FILE                          *file = fopen(blob_path, "rb");
+
+    if(!file) { perror(blob_path); return 1; }
+
+    size_t length = fread(octets, 1, sizeof(octets), file);
+
+    fclose(file);
+
+    if(length != 2 * (size_t)DRV8305_CONFIG_BLOB_WORDS)
+    {
+        fprintf(stderr, "%s: expected %d bytes, got %zu\n", blob_path, 2 * DRV8305_CONFIG_BLOB_WORDS, length);
+        return 1;
+    }
+
+    for(int index = 0; index < DRV8305_CONFIG_BLOB_WORDS; index++)
+    {
+        words[index] = (uint16_t)(octets[2 * index] | (octets[2 * index + 1] << 8));
+    }
+
+    drv8305_blob_status_e status = drv8305_config_blob_deserialize(&blob, DRV8305_VARIANT_ANY, &cfg);
+
+    if(status != DRV8305_BLOB_OK)
+    {
+        fprintf(stderr, "%s: %s\n", blob_path, tool_blob_status_names[status]);
+        return 1;
+    }
+
+    file = (text_path) ? fopen(text_path, "w") : stdout;
+    if(!file) { perror(text_path); return 1; }
+
+    tool_write_text(file, &cfg, blob.variant);
+
+    if(text_path) { fclose(file); }
+
+    return 0;
+}
+
+/**
+ * @brief Write every field of a packed configuration, one per line
+ * @param[in] file Output stream
+ * @param[in] cfg Packed configuration
+ * @param[in] variant Device variant tag
+ * @return None
+ */
+DRV8305_PRIVATE void tool_write_text(FILE *file, const drv8305_packed_configuration_t *cfg, uint16_t variant)
+{
+    fprintf(file, "# DRV8305 configuration blob, version %u\n", DRV8305_CONFIG_BLOB_VERSION);
+    fprintf(file, "# registers 0x05 0x06 0x07 0x09 0x0A 0x0B 0x0C:");
+    for(int index = 0; index < DRV8305_NUMBER_OF_CONTROL_REGISTERS; index++)
+    {
+        fprintf(file, " 0x%03X", cfg->word[index]);
+    }
+    fprintf(file, "\nvariant = %u\n", variant);
+
+    for(int index = 0; index < TOOL_FIELD_COUNT; index++)
+    {
+        const tool_field_t *field = &tool_fields[index];
+
+        fprintf(file, "%s = 0x%X\n", field->name, (cfg->word[field->index] >> field->shift) & field->mask);
+    }
+}
@@ -0,0 +1,223 @@
+/**
+ * @file drv8305_postmortem_reset_sim.c
+ * @brief DRV8305 Post-Mortem Reset Simulation (Host)
+ * @details Simulates a board reset on the host: the post-mortem record is the only memory
+ *          that survives, persisted to a file in between the two "boots".
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * Sequence:
+ *   1. Boot 1: run the driver against a register model, inject a VDS fault, let the
+ *      protective policy capture the post-mortem record, write the record to the file
+ *   2. Reset: clear the user object and the record (all RAM is lost)
+ *   3. Boot 2: reload the record from the file (no-init RAM), initialize, attach, check
+ *      that the capture is reported and matches boot 1, print it as JSON, release it
+ *   4. Corrupt one word of the file image and check that attach rejects it
+ *
+ * @usage
+ * drv8305_postmortem_reset_sim [file]   (default: drv8305_postmortem.bin)
+ * Exit code 0 when every check passes.
+ *
+ * @build
+ * Compile together with every driver source except drv8305_app.c, from this directory:
+ *   gcc -std=c99 -O2 -I../../DRV8305_Driver drv8305_postmortem_reset_sim.c <driver sources>
+ *       -o drv8305_postmortem_reset_sim
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "drv8305_macros.h"
+#include "DRV8305_API/drv8305_api.h"
+#include "DRV8305_PostMortem/drv8305_postmortem.h"
+#include "DRV8305_Status_Registers/drv8305_status_registers_definitions.h"
+#include "DRV8305_Status_Registers/drv8305_status_registers_handlers.h"
+#include "DRV8305_Control_Registers/drv8305_control_registers_handlers.h"
+
+/** @brief Simulated milliseconds run before the fault is injected */
+#define SIM_WARMUP_TICKS    (uint32_t)5000
+/** @brief Simulated milliseconds allowed for the protective capture */
+#define SIM_CAPTURE_TICKS   (uint32_t)5000
+
+DRV8305_PRIVATE uint16_t sim_spi_callback       (uint16_t data);
+DRV8305_PRIVATE bool     sim_fault_pin_callback (void);
+DRV8305_PRIVATE void     sim_nop_callback       (void);
+DRV8305_PRIVATE void     sim_boot               (void);
+DRV8305_PRIVATE void     sim_run                (uint32_t ticks);
+DRV8305_PRIVATE bool     sim_check              (bool condition, const char *what);
+
+DRV8305_PRIVATE uint16_t sim_registers[16];
+DRV8305_PRIVATE int      sim_failures;
+
+DRV8305_POSTMORTEM_DEFINE(sim_postmortem);
+
+DRV8305_PRIVATE const drv8305_user_object_t sim_drv8305_template =
+{
+    .hw_callbacks =
+    {
+        .drv8305_disable_io                          = sim_nop_callback,
+        .drv8305_enable_io                           = sim_nop_callback,
+        .drv8305_sleep_io                            = sim_nop_callback,
+        .drv8305_wake_up_io                          = sim_nop_callback,
+        .drv8305_get_fault_pin_status                = sim_fault_pin_callback,
+        .drv8305_spi_write_and_read_from_register_cb = sim_spi_callback
+    },
+
+    .status_callbacks =
+    {
+        .drv8305_warning_register_cb    = drv8305_warning_register_handler,
+        .drv8305_ov_vds_register_cb     = drv8305_ov_vds_register_handler,
+        .drv8305_ic_faults_register_cb  = drv8305_ic_faults_register_handler,
+        .drv8305_vgs_faults_register_cb = drv8305_vgs_faults_register_handler
+    },
+
+    .control_callbacks =
+    {
+        .drv8305_hs_gate_drive_control_register_cb     = drv8305_hs_gate_drive_register_handler,
+        .drv8305_ls_gate_drive_control_register_cb     = drv8305_ls_gate_drive_register_handler,
+        .drv8305_gate_drive_control_register_cb        = drv8305_gate_drive_register_handler,
+        .drv8305_ic_operation_register_cb              = drv8305_ic_operation_register_handler,
+        .drv8305_shunt_amplifier_control_register_cb   = drv8305_shunt_amplifier_register_handler,
+        .drv8305_voltage_regulator_control_register_cb = drv8305_voltage_regulator_register_handler,
+        .drv8305_vds_sense_control_register_cb         = drv8305_vds_sense_register_handler
+    }
+};
+
+DRV8305_PRIVATE drv8305_user_object_t sim_drv8305_obj;
+
+int main(int argc, char **argv)
+{
+    const char                 *path = (argc > 1) ? argv[1] : "drv8305_postmortem.bin";
+    drv8305_postmortem_record_t captured;
+    drv8305_postmortem_record_t reported;
+    FILE                       *file;
+
+    /* Boot 1: clean no-init RAM, fault, capture */
+    memset(&sim_postmortem, 0, sizeof(sim_postmortem));
+    sim_boot();
+    sim_check(!drv8305_api_postmortem_attach(&sim_drv8305_obj, &sim_postmortem), "boot 1 starts without capture");
+
+    drv8305_api_confirm_configuration(&sim_drv8305_obj);
+    drv8305_api_set_protection_policy(&sim_drv8305_obj, NULL, NULL, NULL);
+    sim_run(SIM_WARMUP_TICKS);
+
+    sim_registers[DRV8305_STATUS_02_REG_ADDR] = DRV8305_VDS_HA;
+    sim_run(SIM_CAPTURE_TICKS);
+
+    sim_check(drv8305_api_get_postmortem(&sim_drv8305_obj, &captured), "protective shutdown captured");
+
+    file = fopen(path, "wb");
+    if(!file || fwrite(&sim_postmortem, sizeof(sim_postmortem), 1, file) != 1) { perror(path); return 2; }
+    fclose(file);
+
+    /* Reset: everything but the persisted record is lost */
+    memset(&sim_drv8305_obj, 0xA5, sizeof(sim_drv8305_obj));
+    memset(&sim_postmortem,  0xA5, sizeof(sim_postmortem));
+    memset(sim_registers,    0,    sizeof(sim_registers));
+
+    /* Boot 2: no-init RAM restored from the file */
+    file = fopen(path, "rb");
+    if(!file || fread(&sim_postmortem, sizeof(sim_postmortem), 1, file) != 1) { perror(path); return 2; }
+    fclose(file);
+
+    sim_boot();
+    sim_check(drv8305_api_postmortem_attach(&sim_drv8305_obj, &sim_postmortem), "boot 2 reports capture");
+    sim_check(drv8305_api_get_postmortem(&sim_drv8305_obj, &reported), "boot 2 exposes capture");
+    sim_check(memcmp(&captured, &reported, sizeof(reported)) == 0, "capture identical across reset");
+    sim_check(reported.reason == DRV8305_POSTMORTEM_REASON_PROTECTIVE_SHUTDOWN, "capture reason");
+    sim_check((reported.registers[DRV8305_STATUS_02_ARRAY_INDEX] & DRV8305_VDS_HA) != 0, "faulted status word kept");
+#if defined(DRV8305_POSTMORTEM_EVENTS)
+    sim_check(reported.event_count > 0 && reported.events[reported.event_count - 1].raised == DRV8305_VDS_HA, "triggering event kept");
+#endif
+
+    printf("{\"timestamp\":%lu,\"reason\":%u,\"flags\":%u,\"confirmation_flags\":%u,\"main_state\":%u,\"status_state\":%u,\"registers\":[",
+           (unsigned long)reported.timestamp, reported.reason, reported.flags, reported.confirmation_flags, reported.main_state, reported.status_state);
+    for(int index = 0; index < DRV8305_NUMBER_OF_REGISTERS; index++)
+    {
+        printf("%s%u", (index == 0) ? "" : ",", reported.registers[index]);
+    }
+    printf("],\"events\":[");
+    for(int index = 0; index < reported.event_count; index++)
+    {
+        printf("%s{\"t\":%lu,\"reg\":%u,\"raised\":%u,\"cleared\":%u}", (index == 0) ? "" : ",",
+               (unsigned long)reported.events[index].timestamp, reported.events[index].register_address,
+               reported.events[index].raised, reported.events[index].cleared);
+    }
+    printf("],\"crc\":%lu}\n", (unsigned long)reported.crc);
+
+    drv8305_api_postmortem_release(&sim_drv8305_obj);
+    sim_check(!drv8305_api_get_postmortem(&sim_drv8305_obj, &reported), "release clears capture");
+
+    /* Corrupted no-init RAM must not be reported */
+    file = fopen(path, "rb");
+    if(!file || fread(&sim_postmortem, sizeof(sim_postmortem), 1, file) != 1) { perror(path); return 2; }
+    fclose(file);
+
+    sim_postmortem.registers[DRV8305_CONTROL_09_ARRAY_INDEX] ^= 0x0001U;
+    sim_boot();
+    sim_check(!drv8305_api_postmortem_attach(&sim_drv8305_obj, &sim_postmortem), "corrupted capture rejected");
+
+    return (sim_failures == 0) ? 0 : 1;
+}
+
+/**
+ * @brief Power-on of the simulated board: fresh user object, initialized driver
+ * @return None
+ */
+DRV8305_PRIVATE void sim_boot(void)
+{
+    sim_drv8305_obj = sim_drv8305_template;
+    drv8305_api_initialize(&sim_drv8305_obj);
+}
+
+DRV8305_PRIVATE void sim_run(uint32_t ticks)
+{
+    for(uint32_t tick = 0; tick < ticks; tick++)
+    {
+        drv8305_api_master_sm_polling(&sim_drv8305_obj);
+        drv8305_api_timer(&sim_drv8305_obj);
+    }
+}
+
+DRV8305_PRIVATE bool sim_check(bool condition, const char *what)
+{
+    if(!condition)
+    {
+        fprintf(stderr, "FAIL: %s\n", what);
+        sim_failures++;
+    }
+
+    return condition;
+}
+
+/**
+ * @brief Register model: writes store data, reads return [fault][address][data]
+ * @param[in] data SPI frame from the driver
+ * @return uint16_t Response frame
+ */
+DRV8305_PRIVATE uint16_t sim_spi_callback(uint16_t data)
+{
+    uint16_t address = (data >> 11) & 0x0FU;
+
+    if((data & 0x8000U) == 0)
+    {
+        sim_registers[address] = data & DRV8305_REGISTER_DATA_MASK;
+        return 0;
+    }
+
+    return (uint16_t)((address << 11) | sim_registers[address]);
+}
+
+DRV8305_PRIVATE bool sim_fault_pin_callback(void)
+{
+    return true;
+}
+
+DRV8305_PRIVATE void sim_nop_callback(void)
+{
+}
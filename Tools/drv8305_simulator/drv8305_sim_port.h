@@ -0,0 +1,95 @@
+/**
+ * @file drv8305_sim_port.h
+ * @brief DRV8305 Port - Behavioral Simulator Binding for Static Dispatch (Host)
+ * @details Port header of the host simulator: binds every SPI frame, GPIO access and register
+ *          notification of a -DDRV8305_STATIC_DISPATCH build to the attached drv8305_sim_t
+ *          instance and the register handlers, the same way drv8305_port.h binds the C2000 board.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * Lets the unit tests run the driver in static dispatch mode on the host. The application
+ * still calls drv8305_sim_attach() to select the instance; the callback table it fills is
+ * ignored by the driver in this mode.
+ *
+ * @build
+ * Compile the driver sources and drv8305_simulator.c with
+ *   -DDRV8305_STATIC_DISPATCH -DDRV8305_PORT_HEADER="\"drv8305_sim_port.h\"" -I../Tools/drv8305_simulator
+ * (CMake: drv8305_static_dispatch and the drv8305_<module>_test_static targets).
+ */
+
+#ifndef DRV8305_SIM_PORT_H_
+#define DRV8305_SIM_PORT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "drv8305_macros.h"
+#include "drv8305_simulator.h"
+#include "DRV8305_Status_Registers/drv8305_status_registers_handlers.h"
+#include "DRV8305_Control_Registers/drv8305_control_registers_handlers.h"
+
+/**
+ * @brief Route a status register frame to its handler (static dispatch)
+ * @param[in] self Pointer to DRV8305 user object
+ * @param[in] status_index Status register index (DRV8305_STATUS_0x_ARRAY_INDEX)
+ * @param[in] data Raw status frame
+ * @return None
+ */
+DRV8305_INLINE void drv8305_sim_port_status_notify(void *self, uint16_t status_index, uint16_t data)
+{
+    switch (status_index)
+    {
+        case DRV8305_STATUS_01_ARRAY_INDEX: { drv8305_warning_register_handler(self, data);    break; }
+        case DRV8305_STATUS_02_ARRAY_INDEX: { drv8305_ov_vds_register_handler(self, data);     break; }
+        case DRV8305_STATUS_03_ARRAY_INDEX: { drv8305_ic_faults_register_handler(self, data);  break; }
+        case DRV8305_STATUS_04_ARRAY_INDEX: { drv8305_vgs_faults_register_handler(self, data); break; }
+        default:                            { break; }
+    }
+}
+
+/**
+ * @brief Route a control register readback to its handler (static dispatch)
+ * @param[in] self Pointer to DRV8305 user object
+ * @param[in] array_index Control register index (DRV8305_CONTROL_xx_ARRAY_INDEX)
+ * @param[in] data Raw readback frame
+ * @return None
+ */
+DRV8305_INLINE void drv8305_sim_port_control_notify(void *self, uint16_t array_index, uint16_t data)
+{
+    switch (array_index)
+    {
+        case DRV8305_CONTROL_05_ARRAY_INDEX: { drv8305_hs_gate_drive_register_handler(self, data);     break; }
+        case DRV8305_CONTROL_06_ARRAY_INDEX: { drv8305_ls_gate_drive_register_handler(self, data);     break; }
+        case DRV8305_CONTROL_07_ARRAY_INDEX: { drv8305_gate_drive_register_handler(self, data);        break; }
+        case DRV8305_CONTROL_09_ARRAY_INDEX: { drv8305_ic_operation_register_handler(self, data);      break; }
+        case DRV8305_CONTROL_0A_ARRAY_INDEX: { drv8305_shunt_amplifier_register_handler(self, data);   break; }
+        case DRV8305_CONTROL_0B_ARRAY_INDEX: { drv8305_voltage_regulator_register_handler(self, data); break; }
+        case DRV8305_CONTROL_0C_ARRAY_INDEX: { drv8305_vds_sense_register_handler(self, data);         break; }
+        default:                             { break; }
+    }
+}
+
+// ============================================================================
+// STATIC DISPATCH BINDING - Consumed by DRV8305_API/drv8305_dispatch.h
+// ============================================================================
+
+#define DRV8305_PORT_SPI_TRANSFER(self, frame)          drv8305_sim_transfer(drv8305_sim_get_attached(), frame)
+#define DRV8305_PORT_ENABLE_IO(self)                    drv8305_sim_set_en_gate(drv8305_sim_get_attached(), true)
+#define DRV8305_PORT_DISABLE_IO(self)                   drv8305_sim_set_en_gate(drv8305_sim_get_attached(), false)
+#define DRV8305_PORT_SLEEP_IO(self)                     drv8305_sim_set_wake(drv8305_sim_get_attached(), false)
+#define DRV8305_PORT_WAKE_UP_IO(self)                   drv8305_sim_set_wake(drv8305_sim_get_attached(), true)
+#define DRV8305_PORT_STATUS_NOTIFY(self, index, data)   drv8305_sim_port_status_notify(self, index, data)
+#define DRV8305_PORT_CONTROL_NOTIFY(self, index, data)  drv8305_sim_port_control_notify(self, index, data)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRV8305_SIM_PORT_H_ */
@@ -0,0 +1,595 @@
+/**
+ * @file drv8305_simulator.c
+ * @brief DRV8305 Behavioral Simulator (Host) - Implementation
+ * @details Implements the register file, status latching, control 0x09 commands, pin effects
+ *          and fault injection described in drv8305_simulator.h.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * This implementation file contains:
+ *   - Datasheet reset words of the control registers (register image)
+ *   - SPI frame decoding and status word composition
+ *   - Hardware callback trampolines for the attached instance
+ *   - Fault injection and the script clock
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "drv8305_macros.h"
+#include "drv8305_register_map.h"
+#include "DRV8305_Config/drv8305_register_image.h"
+#include "DRV8305_Control_Registers/drv8305_control_registers_definitions.h"
+#include "DRV8305_Status_Registers/drv8305_status_registers_definitions.h"
+#include "drv8305_simulator.h"
+
+/** @brief Read flag of an SPI command frame */
+#define DRV8305_SIM_FRAME_READ      (uint16_t)0x8000U
+/** @brief Address of an SPI command frame */
+#define DRV8305_SIM_FRAME_ADDRESS(frame)  (uint16_t)(((frame) >> 11) & 0x0FU)
+
+/** @brief VDS faults of Status 0x02 detected only while the gates switch */
+#define DRV8305_SIM_VDS_GATE_FAULTS (uint16_t)(DRV8305_VDS_LC | DRV8305_VDS_HC | DRV8305_VDS_LB | DRV8305_VDS_HB | DRV8305_VDS_LA | DRV8305_VDS_HA)
+/** @brief Sense amplifier overcurrent faults of Status 0x02 */
+#define DRV8305_SIM_SNS_OCP_FAULTS  (uint16_t)(DRV8305_VDS_SNS_A_OCP | DRV8305_VDS_SNS_B_OCP | DRV8305_VDS_SNS_C_OCP)
+/** @brief VGS faults of Status 0x04 */
+#define DRV8305_SIM_VGS_FAULTS      (uint16_t)(DRV8305_VGS_LC | DRV8305_VGS_HC | DRV8305_VGS_LB | DRV8305_VGS_HB | DRV8305_VGS_LA | DRV8305_VGS_HA)
+
+DRV8305_PRIVATE bool     drv8305_sim_is_control_address (uint16_t address);
+DRV8305_PRIVATE bool     drv8305_sim_is_fault_address   (uint16_t address);
+DRV8305_PRIVATE uint16_t drv8305_sim_detect_mask        (const drv8305_sim_t *sim, uint16_t address);
+DRV8305_PRIVATE uint16_t drv8305_sim_nfault_mask        (const drv8305_sim_t *sim, uint16_t address);
+DRV8305_PRIVATE void     drv8305_sim_evaluate           (drv8305_sim_t *sim);
+DRV8305_PRIVATE void     drv8305_sim_clear_faults       (drv8305_sim_t *sim);
+DRV8305_PRIVATE void     drv8305_sim_reset_registers    (drv8305_sim_t *sim);
+DRV8305_PRIVATE void     drv8305_sim_write              (drv8305_sim_t *sim, uint16_t address, uint16_t data);
+
+DRV8305_PRIVATE uint16_t drv8305_sim_spi_callback       (uint16_t data);
+DRV8305_PRIVATE bool     drv8305_sim_fault_pin_callback (void);
+DRV8305_PRIVATE void     drv8305_sim_enable_callback    (void);
+DRV8305_PRIVATE void     drv8305_sim_disable_callback   (void);
+DRV8305_PRIVATE void     drv8305_sim_wake_up_callback   (void);
+DRV8305_PRIVATE void     drv8305_sim_sleep_callback     (void);
+
+/**@brief: Datasheet reset words, what the control registers hold after power-up **/
+DRV8305_PRIVATE DRV8305_REGISTER_IMAGE_DEFINE(drv8305_sim_reset_image,
+    (DRV8305_TDRIVE_1780NS, DRV8305_ISINK_60MA, DRV8305_ISOURCE_50MA),
+    (DRV8305_TDRIVE_1780NS, DRV8305_ISINK_60MA, DRV8305_ISOURCE_50MA),
+    (DRV8305_VCPH_FREQ_518KHZ, DRV8305_COMM_ACTIVE_FREEWHEEL, DRV8305_PWM_6_INPUTS, DRV8305_DEADTIME_52NS, DRV8305_TBLANK_1_75US, DRV8305_TVDS_3_5US),
+    (0, 0, 0, 0, DRV8305_WD_DLY_20MS, 0, 0, 0, 0, 0),
+    (0, 0, 0, DRV8305_CS_BLANK_0NS, DRV8305_GAIN_10V_V, DRV8305_GAIN_10V_V, DRV8305_GAIN_10V_V),
+    (DRV8305_VREF_SCALE_DIV2, DRV8305_SLEEP_DLY_10US, 0, DRV8305_VREG_UV_70PCT),
+    (DRV8305_VDS_1_175V, DRV8305_VDS_MODE_LATCH_SHUTDOWN));
+
+/**@brief: Register address of each register image word **/
+DRV8305_PRIVATE const uint16_t drv8305_sim_control_addresses[DRV8305_NUMBER_OF_CONTROL_REGISTERS] =
+{
+    DRV8305_CONTROL_05_REG_ADDR,
+    DRV8305_CONTROL_06_REG_ADDR,
+    DRV8305_CONTROL_07_REG_ADDR,
+    DRV8305_CONTROL_09_REG_ADDR,
+    DRV8305_CONTROL_0A_REG_ADDR,
+    DRV8305_CONTROL_0B_REG_ADDR,
+    DRV8305_CONTROL_0C_REG_ADDR
+};
+
+/**@brief: Instance answering the hardware callbacks **/
+DRV8305_PRIVATE drv8305_sim_t *drv8305_sim_attached = NULL;
+
+/* -------------------------------- PUBLIC FUNCTIONS -------------------------------- */
+
+/**
+ * @brief Power up the model (implementation)
+ * @param[out] sim Model state
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_sim_init(drv8305_sim_t *sim)
+{
+    if(!sim) { return; }
+
+    memset(sim, 0, sizeof(drv8305_sim_t));
+
+    drv8305_sim_reset_registers(sim);
+
+    sim->en_gate = true;
+    sim->wake    = true;
+}
+
+/**
+ * @brief Attach the model to a driver callback table (implementation)
+ * @param[in] sim Model answering the callbacks
+ * @param[out] callbacks Hardware callback table of the user object
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_sim_attach(drv8305_sim_t *sim, drv8305_hardware_low_level_cb_t *callbacks)
+{
+    drv8305_sim_attached = sim;
+
+    if(!callbacks) { return; }
+
+    callbacks->drv8305_spi_write_and_read_from_register_cb = drv8305_sim_spi_callback;
+    callbacks->drv8305_get_fault_pin_status                = drv8305_sim_fault_pin_callback;
+    callbacks->drv8305_enable_io                           = drv8305_sim_enable_callback;
+    callbacks->drv8305_disable_io                          = drv8305_sim_disable_callback;
+    callbacks->drv8305_wake_up_io                          = drv8305_sim_wake_up_callback;
+    callbacks->drv8305_sleep_io                            = drv8305_sim_sleep_callback;
+}
+
+/**
+ * @brief Get the attached instance (implementation)
+ * @return drv8305_sim_t* Attached model, NULL before drv8305_sim_attach()
+ */
+DRV8305_PUBLIC drv8305_sim_t* drv8305_sim_get_attached(void)
+{
+    return drv8305_sim_attached;
+}
+
+/**
+ * @brief Answer one SPI frame (implementation)
+ * @details Asleep, the device does not drive SDO and ignores the frame.
+ * @param[in,out] sim Model state
+ * @param[in] frame 16-bit command frame
+ * @return uint16_t Response frame, data bits 10:0
+ */
+DRV8305_PUBLIC uint16_t drv8305_sim_transfer(drv8305_sim_t *sim, uint16_t frame)
+{
+    if(!sim) { return 0; }
+
+    sim->frames++;
+
+    if(sim->asleep) { return 0; }
+
+    uint16_t address  = DRV8305_SIM_FRAME_ADDRESS(frame);
+    uint16_t response = drv8305_sim_peek(sim, address);
+
+    if(frame & DRV8305_SIM_FRAME_READ)
+    {
+        sim->reads[address]++;
+    }
+    else
+    {
+        sim->writes[address]++;
+        drv8305_sim_write(sim, address, (uint16_t)(frame & DRV8305_REGISTER_DATA_MASK));
+    }
+
+    return response;
+}
+
+/**
+ * @brief Drive the EN_GATE pin (implementation)
+ * @param[in,out] sim Model state
+ * @param[in] level true = high
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_sim_set_en_gate(drv8305_sim_t *sim, bool level)
+{
+    if(!sim) { return; }
+
+    if(sim->en_gate && !level)
+    {
+        sim->en_gate_falls++;
+        drv8305_sim_clear_faults(sim);
+    }
+
+    sim->en_gate = level;
+
+    drv8305_sim_evaluate(sim);
+}
+
+/**
+ * @brief Drive the WAKE pin (implementation)
+ * @param[in,out] sim Model state
+ * @param[in] level true = high
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_sim_set_wake(drv8305_sim_t *sim, bool level)
+{
+    if(!sim) { return; }
+
+    if(!sim->wake && level && sim->asleep)
+    {
+        sim->asleep = false;
+        drv8305_sim_reset_registers(sim);
+        memset(sim->latched, 0, sizeof(sim->latched));
+    }
+
+    sim->wake = level;
+
+    drv8305_sim_evaluate(sim);
+}
+
+/**
+ * @brief Read the nFAULT pin (implementation)
+ * @param[in] sim Model state
+ * @return true when high (no fault latched)
+ */
+DRV8305_PUBLIC bool drv8305_sim_nfault(const drv8305_sim_t *sim)
+{
+    if(!sim) { return true; }
+
+    for(uint16_t address = DRV8305_STATUS_02_REG_ADDR; address <= DRV8305_STATUS_04_REG_ADDR; address++)
+    {
+        if((sim->latched[address] & drv8305_sim_nfault_mask(sim, address)) != 0) { return false; }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Check whether the gate drivers switch (implementation)
+ * @param[in] sim Model state
+ * @return true when EN_GATE is high, the device awake and no shutdown fault latched
+ */
+DRV8305_PUBLIC bool drv8305_sim_gates_active(const drv8305_sim_t *sim)
+{
+    if(!sim) { return false; }
+
+    return sim->en_gate && !sim->asleep && drv8305_sim_nfault(sim);
+}
+
+/**
+ * @brief Word a read of address would return (implementation)
+ * @param[in] sim Model state
+ * @param[in] address Register address
+ * @return uint16_t Data bits 10:0
+ */
+DRV8305_PUBLIC uint16_t drv8305_sim_peek(const drv8305_sim_t *sim, uint16_t address)
+{
+    if(!sim || address >= (uint16_t)DRV8305_SIM_ADDRESS_COUNT) { return 0; }
+
+    if(address == DRV8305_STATUS_01_REG_ADDR)
+    {
+        uint16_t warning = sim->condition[DRV8305_STATUS_01_REG_ADDR] & (uint16_t)~(DRV8305_WARN_VDS_STATUS | DRV8305_WARN_FAULT);
+
+        if((sim->condition[DRV8305_STATUS_02_REG_ADDR] & drv8305_sim_detect_mask(sim, DRV8305_STATUS_02_REG_ADDR) & DRV8305_SIM_VDS_GATE_FAULTS) != 0)
+        {
+            warning |= DRV8305_WARN_VDS_STATUS;
+        }
+
+        if(!drv8305_sim_nfault(sim))
+        {
+            warning |= DRV8305_WARN_FAULT;
+        }
+
+        return (uint16_t)(warning & DRV8305_REGISTER_DATA_MASK);
+    }
+
+    if(drv8305_sim_is_fault_address(address))
+    {
+        return (uint16_t)(sim->latched[address] & DRV8305_REGISTER_DATA_MASK);
+    }
+
+    if(drv8305_sim_is_control_address(address))
+    {
+        return (uint16_t)(sim->registers[address] & DRV8305_REGISTER_DATA_MASK);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Inject a fault now (implementation)
+ * @param[in,out] sim Model state
+ * @param[in] action Injection action
+ * @param[in] address Register address the action applies to
+ * @param[in] bits Condition bits or XOR pattern
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_sim_inject(drv8305_sim_t *sim, drv8305_sim_action_e action, uint16_t address, uint16_t bits)
+{
+    if(!sim || address >= (uint16_t)DRV8305_SIM_ADDRESS_COUNT) { return; }
+
+    switch (action)
+    {
+        case DRV8305_SIM_ASSERT:
+        {
+            sim->condition[address] |= bits;
+            break;
+        }
+
+        case DRV8305_SIM_RELEASE:
+        {
+            sim->condition[address] &= (uint16_t)~bits;
+            break;
+        }
+
+        case DRV8305_SIM_PULSE:
+        {
+            sim->condition[address] |= bits;
+            drv8305_sim_evaluate(sim);
+            sim->condition[address] &= (uint16_t)~bits;
+            break;
+        }
+
+        case DRV8305_SIM_CORRUPT:
+        {
+            if(drv8305_sim_is_control_address(address))
+            {
+                sim->registers[address] = (uint16_t)((sim->registers[address] ^ bits) & DRV8305_REGISTER_DATA_MASK);
+            }
+            break;
+        }
+
+        case DRV8305_SIM_STICK:
+        {
+            sim->stuck_mask |= (uint16_t)(1U << address);
+            break;
+        }
+
+        case DRV8305_SIM_UNSTICK:
+        {
+            sim->stuck_mask &= (uint16_t)~(1U << address);
+            break;
+        }
+
+        case DRV8305_SIM_BROWN_OUT:
+        {
+            drv8305_sim_reset_registers(sim);
+            sim->asleep                                = false;
+            sim->latched[DRV8305_STATUS_03_REG_ADDR] |= (bits != 0) ? bits : (uint16_t)DRV8305_IC_PVDD_UVLO2;
+            break;
+        }
+
+        default:
+        {
+            break;
+        }
+    }
+
+    drv8305_sim_evaluate(sim);
+}
+
+/**
+ * @brief Load a timed fault injection script (implementation)
+ * @param[in,out] sim Model state
+ * @param[in] script Steps sorted by time
+ * @param[in] length Number of steps
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_sim_load_script(drv8305_sim_t *sim, const drv8305_sim_step_t *script, uint16_t length)
+{
+    if(!sim) { return; }
+
+    sim->script        = script;
+    sim->script_length = (script != NULL) ? length : 0;
+    sim->script_next   = 0;
+}
+
+/**
+ * @brief Advance the simulated clock (implementation)
+ * @param[in,out] sim Model state
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_sim_tick(drv8305_sim_t *sim)
+{
+    if(!sim) { return; }
+
+    sim->time++;
+
+    while(sim->script_next < sim->script_length && sim->script[sim->script_next].time <= sim->time)
+    {
+        const drv8305_sim_step_t *step = &sim->script[sim->script_next++];
+
+        drv8305_sim_inject(sim, step->action, step->address, step->bits);
+    }
+}
+
+/* -------------------------------- PRIVATE FUNCTIONS -------------------------------- */
+
+/**
+ * @brief Check for a control register address (internal)
+ * @param[in] address Register address
+ * @return true for 0x05 - 0x07 and 0x09 - 0x0C
+ */
+DRV8305_PRIVATE bool drv8305_sim_is_control_address(uint16_t address)
+{
+    return address >= DRV8305_CONTROL_05_REG_ADDR && address <= DRV8305_CONTROL_0C_REG_ADDR && address != (uint16_t)0x08U;
+}
+
+/**
+ * @brief Check for a latching fault register address (internal)
+ * @param[in] address Register address
+ * @return true for 0x02 - 0x04
+ */
+DRV8305_PRIVATE bool drv8305_sim_is_fault_address(uint16_t address)
+{
+    return address >= DRV8305_STATUS_02_REG_ADDR && address <= DRV8305_STATUS_04_REG_ADDR;
+}
+
+/**
+ * @brief Fault bits of a status register the device currently detects (internal)
+ * @param[in] sim Model state
+ * @param[in] address Status register address (0x02 - 0x04)
+ * @return uint16_t Detected bits
+ */
+DRV8305_PRIVATE uint16_t drv8305_sim_detect_mask(const drv8305_sim_t *sim, uint16_t address)
+{
+    uint16_t ic_operation = sim->registers[DRV8305_CONTROL_09_REG_ADDR];
+    bool     switching    = sim->en_gate && !sim->asleep;
+
+    switch (address)
+    {
+        case DRV8305_STATUS_02_REG_ADDR:
+        {
+            uint16_t mask = DRV8305_REGISTER_DATA_MASK;
+
+            if(DRV8305_FIELD_GET(ic_operation, DRV8305_CTRL09_DIS_SNS_OCP_FIELD) != 0)
+            {
+                mask &= (uint16_t)~DRV8305_SIM_SNS_OCP_FAULTS;
+            }
+
+            if(!switching || DRV8305_FIELD_GET(sim->registers[DRV8305_CONTROL_0C_REG_ADDR], DRV8305_CTRL0C_VDS_MODE_FIELD) == DRV8305_VDS_MODE_DISABLED)
+            {
+                mask &= (uint16_t)~DRV8305_SIM_VDS_GATE_FAULTS;
+            }
+
+            return mask;
+        }
+
+        case DRV8305_STATUS_03_REG_ADDR:
+        {
+            uint16_t mask = DRV8305_REGISTER_DATA_MASK;
+
+            if(DRV8305_FIELD_GET(ic_operation, DRV8305_CTRL09_DIS_PVDD_UVLO2_FIELD) != 0)
+            {
+                mask &= (uint16_t)~DRV8305_IC_PVDD_UVLO2;
+            }
+
+            return mask;
+        }
+
+        case DRV8305_STATUS_04_REG_ADDR:
+        {
+            if(!switching || DRV8305_FIELD_GET(ic_operation, DRV8305_CTRL09_DIS_GDRV_FAULT_FIELD) != 0) { return 0; }
+
+            return DRV8305_SIM_VGS_FAULTS;
+        }
+
+        default:
+        {
+            return 0;
+        }
+    }
+}
+
+/**
+ * @brief Latched bits of a status register that pull nFAULT low (internal)
+ * @param[in] sim Model state
+ * @param[in] address Status register address (0x02 - 0x04)
+ * @return uint16_t Fault bits, VDS faults excluded in report-only mode
+ */
+DRV8305_PRIVATE uint16_t drv8305_sim_nfault_mask(const drv8305_sim_t *sim, uint16_t address)
+{
+    if(address == DRV8305_STATUS_02_REG_ADDR &&
+       DRV8305_FIELD_GET(sim->registers[DRV8305_CONTROL_0C_REG_ADDR], DRV8305_CTRL0C_VDS_MODE_FIELD) == DRV8305_VDS_MODE_REPORT_ONLY)
+    {
+        return (uint16_t)(DRV8305_REGISTER_DATA_MASK & ~DRV8305_SIM_VDS_GATE_FAULTS);
+    }
+
+    return DRV8305_REGISTER_DATA_MASK;
+}
+
+/**
+ * @brief Latch every present fault condition the device detects (internal)
+ * @param[in,out] sim Model state
+ * @return None
+ */
+DRV8305_PRIVATE void drv8305_sim_evaluate(drv8305_sim_t *sim)
+{
+    if(sim->asleep) { return; }
+
+    for(uint16_t address = DRV8305_STATUS_02_REG_ADDR; address <= DRV8305_STATUS_04_REG_ADDR; address++)
+    {
+        sim->latched[address] |= (uint16_t)(sim->condition[address] & drv8305_sim_detect_mask(sim, address));
+    }
+}
+
+/**
+ * @brief Clear the latches whose condition is gone (internal)
+ * @param[in,out] sim Model state
+ * @return None
+ */
+DRV8305_PRIVATE void drv8305_sim_clear_faults(drv8305_sim_t *sim)
+{
+    for(uint16_t address = DRV8305_STATUS_02_REG_ADDR; address <= DRV8305_STATUS_04_REG_ADDR; address++)
+    {
+        sim->latched[address] &= sim->condition[address];
+    }
+}
+
+/**
+ * @brief Load the datasheet reset words into the register file (internal)
+ * @param[in,out] sim Model state
+ * @return None
+ */
+DRV8305_PRIVATE void drv8305_sim_reset_registers(drv8305_sim_t *sim)
+{
+    memset(sim->registers, 0, sizeof(sim->registers));
+
+    for(int index = 0; index < DRV8305_NUMBER_OF_CONTROL_REGISTERS; index++)
+    {
+        sim->registers[drv8305_sim_control_addresses[index]] = drv8305_sim_reset_image.word[index];
+    }
+}
+
+/**
+ * @brief Apply the data of a write frame (internal)
+ * @details Status and reserved addresses and stuck registers ignore writes. CLR_FLTS and
+ *          SLEEP of Control 0x09 act once and are not stored.
+ * @param[in,out] sim Model state
+ * @param[in] address Register address
+ * @param[in] data Data bits 10:0
+ * @return None
+ */
+DRV8305_PRIVATE void drv8305_sim_write(drv8305_sim_t *sim, uint16_t address, uint16_t data)
+{
+    if(!drv8305_sim_is_control_address(address) || (sim->stuck_mask & (1U << address)) != 0) { return; }
+
+    if(address == DRV8305_CONTROL_09_REG_ADDR)
+    {
+        if(DRV8305_FIELD_GET(data, DRV8305_CTRL09_CLR_FLTS_FIELD) != 0)
+        {
+            sim->fault_clears++;
+            drv8305_sim_clear_faults(sim);
+        }
+
+        if(DRV8305_FIELD_GET(data, DRV8305_CTRL09_SLEEP_FIELD) != 0 && !sim->en_gate)
+        {
+            sim->asleep = true;
+        }
+
+        data &= (uint16_t)~(DRV8305_CTRL09_CLR_FLTS_MASK | DRV8305_CTRL09_SLEEP_MASK);
+    }
+
+    sim->registers[address] = data;
+
+    drv8305_sim_evaluate(sim);
+}
+
+/**
+ * @brief SPI transfer callback (trampoline to the attached instance)
+ * @param[in] data SPI frame from the driver
+ * @return uint16_t Response frame
+ */
+DRV8305_PRIVATE uint16_t drv8305_sim_spi_callback(uint16_t data)
+{
+    return drv8305_sim_transfer(drv8305_sim_attached, data);
+}
+
+/**
+ * @brief nFAULT pin callback (trampoline to the attached instance)
+ * @return bool true when high (no fault)
+ */
+DRV8305_PRIVATE bool drv8305_sim_fault_pin_callback(void)
+{
+    return drv8305_sim_nfault(drv8305_sim_attached);
+}
+
+/** @brief EN_GATE high callback (trampoline to the attached instance) */
+DRV8305_PRIVATE void drv8305_sim_enable_callback(void)
+{
+    drv8305_sim_set_en_gate(drv8305_sim_attached, true);
+}
+
+/** @brief EN_GATE low callback (trampoline to the attached instance) */
+DRV8305_PRIVATE void drv8305_sim_disable_callback(void)
+{
+    drv8305_sim_set_en_gate(drv8305_sim_attached, false);
+}
+
+/** @brief WAKE high callback (trampoline to the attached instance) */
+DRV8305_PRIVATE void drv8305_sim_wake_up_callback(void)
+{
+    drv8305_sim_set_wake(drv8305_sim_attached, true);
+}
+
+/** @brief WAKE low callback (trampoline to the attached instance) */
+DRV8305_PRIVATE void drv8305_sim_sleep_callback(void)
+{
+    drv8305_sim_set_wake(drv8305_sim_attached, false);
+}
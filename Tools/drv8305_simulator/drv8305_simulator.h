@@ -0,0 +1,232 @@
+/**
+ * @file drv8305_simulator.h
+ * @brief DRV8305 Behavioral Simulator (Host) - Register File, Pins and Fault Injection
+ * @details Declares a host-side model of the DRV8305 that answers the driver's SPI frames and
+ *          GPIO calls through drv8305_hardware_low_level_cb_t, so the unmodified driver runs on
+ *          Linux without a C2000 board.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * This module provides:
+ *   - drv8305_sim_t: register file, fault conditions and latches, EN_GATE/WAKE/nFAULT pins
+ *   - drv8305_sim_attach(): fills the driver's hardware callback table with the model
+ *   - drv8305_sim_port.h: the same binding for -DDRV8305_STATIC_DISPATCH builds
+ *   - drv8305_sim_inject(): immediate fault injection (conditions, upsets, stuck registers,
+ *     brown-out)
+ *   - drv8305_sim_load_script() / drv8305_sim_tick(): timed fault injection on the
+ *     simulated millisecond clock
+ *
+ * @model
+ * Frames (drv8305_spi_write_packet_create / drv8305_spi_read_packet_create):
+ *   - [15] 1 = read, 0 = write, [14:11] address, [10:0] data
+ *   - Response: [15:11] 0, [10:0] the register word; a write returns the word held before it
+ *   - Status 0x01 - 0x04 and reserved addresses ignore writes; reserved addresses read 0
+ * Status registers:
+ *   - 0x01 warnings are live: set while their condition is asserted; bit 5 (VDS_STATUS) is the
+ *     OR of the asserted VDS conditions, bit 10 (FAULT) the OR of all latched faults
+ *   - 0x02 - 0x04 faults latch when their condition is asserted and read latch | condition
+ *   - VDS (0x02 bits 10:5) and VGS (0x04) faults are detected only while the gates are enabled;
+ *     0x0C VDS_MODE report-only latches VDS faults without nFAULT, disabled ignores them
+ * Control 0x09:
+ *   - CLR_FLTS clears the latches whose condition is gone and reads back 0 (self-clearing)
+ *   - SLEEP with EN_GATE low enters sleep (ignored while EN_GATE is high) and reads back 0
+ * Pins:
+ *   - EN_GATE low disables the gates; a falling edge clears the latches like CLR_FLTS
+ *   - Asleep, SPI returns 0 and ignores writes; a WAKE rising edge wakes the device with the
+ *     register file at its reset words and the latches cleared
+ *   - nFAULT (drv8305_get_fault_pin_status) is low while a fault is latched
+ *
+ * @limitations
+ * One attached instance per process (the callback table carries no context). No analog
+ * behavior, watchdog or charge pump timing: faults exist only when injected.
+ *
+ * @usage
+ * @code
+ * DRV8305_PRIVATE drv8305_sim_t sim;
+ * DRV8305_PRIVATE const drv8305_sim_step_t script[] =
+ * {
+ *     { 1000, DRV8305_SIM_ASSERT,  DRV8305_STATUS_02_REG_ADDR, DRV8305_VDS_HA },
+ *     { 1200, DRV8305_SIM_RELEASE, DRV8305_STATUS_02_REG_ADDR, DRV8305_VDS_HA },
+ * };
+ *
+ * drv8305_sim_init(&sim);
+ * drv8305_sim_attach(&sim, &user_drv8305_obj.hw_callbacks);
+ * drv8305_sim_load_script(&sim, script, 2);
+ * drv8305_api_initialize(&user_drv8305_obj);
+ *
+ * for(;;) { drv8305_api_master_sm_polling(&user_drv8305_obj); drv8305_api_timer(&user_drv8305_obj); drv8305_sim_tick(&sim); }
+ * @endcode
+ *
+ * @build
+ * Host only; compile with drv8305_simulator.c and the driver sources except drv8305_app.c,
+ * with -I../../DRV8305_Driver.
+ */
+
+#ifndef DRV8305_SIMULATOR_H_
+#define DRV8305_SIMULATOR_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "drv8305_macros.h"
+#include "drv8305_register_map.h"
+#include "DRV8305_API/drv8305_api.h"
+
+/** @brief Size of the 4-bit SPI address space */
+#define DRV8305_SIM_ADDRESS_COUNT  (int)16
+
+typedef enum
+{
+    DRV8305_SIM_ASSERT,       // -> Condition bits of status address become present
+    DRV8305_SIM_RELEASE,      // -> Condition bits of status address go away (latches stay)
+    DRV8305_SIM_PULSE,        // -> Assert and release at once, only the latch remains
+    DRV8305_SIM_CORRUPT,      // -> XOR bits into control address (single-event upset)
+    DRV8305_SIM_STICK,        // -> Writes to control address are ignored
+    DRV8305_SIM_UNSTICK,      // -> Writes to control address work again
+    DRV8305_SIM_BROWN_OUT,    // -> Register file back to reset words, bits latched in 0x03
+} drv8305_sim_action_e;
+
+/**
+ * @brief One timed fault injection step
+ * @note Steps are applied in order once time reaches their time stamp
+ */
+typedef struct
+{
+    uint32_t             time;    // Simulated milliseconds (drv8305_sim_tick() count)
+    drv8305_sim_action_e action;
+    uint16_t             address; // Register address (DRV8305_xx_REG_ADDR)
+    uint16_t             bits;    // Condition bits, XOR pattern; BROWN_OUT: 0x03 bits (0 = PVDD_UVLO2)
+} drv8305_sim_step_t;
+
+typedef struct
+{
+    uint16_t                  registers[DRV8305_SIM_ADDRESS_COUNT]; // Control words by address
+    uint16_t                  condition[DRV8305_SIM_ADDRESS_COUNT]; // Present conditions, status addresses
+    uint16_t                  latched[DRV8305_SIM_ADDRESS_COUNT];   // Latched faults, 0x02 - 0x04
+    uint16_t                  stuck_mask;                           // Bit per address: writes ignored
+
+    bool                      en_gate;
+    bool                      wake;
+    bool                      asleep;
+
+    const drv8305_sim_step_t *script;
+    uint16_t                  script_length;
+    uint16_t                  script_next;
+    uint32_t                  time;
+
+    uint32_t                  frames;          // SPI frames answered (asleep included)
+    uint32_t                  writes[DRV8305_SIM_ADDRESS_COUNT];
+    uint32_t                  reads[DRV8305_SIM_ADDRESS_COUNT];
+    uint32_t                  fault_clears;    // CLR_FLTS writes
+    uint32_t                  en_gate_falls;   // EN_GATE high -> low transitions
+} drv8305_sim_t;
+
+/**
+ * @brief Power up the model
+ * @details Register file at the datasheet reset words, no conditions or latches, awake,
+ *          EN_GATE and WAKE high (the board state drv8305_api_initialize() assumes).
+ * @param[out] sim Model state
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_sim_init(drv8305_sim_t *sim);
+
+/**
+ * @brief Attach the model to a driver callback table
+ * @param[in] sim Model answering the callbacks (becomes the attached instance)
+ * @param[out] callbacks Hardware callback table of the user object
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_sim_attach(drv8305_sim_t *sim, drv8305_hardware_low_level_cb_t *callbacks);
+
+/**
+ * @brief Get the attached instance
+ * @return drv8305_sim_t* Model given to the last drv8305_sim_attach(), NULL before
+ * @note Used by the static dispatch port header drv8305_sim_port.h
+ */
+DRV8305_PUBLIC drv8305_sim_t* drv8305_sim_get_attached(void);
+
+/**
+ * @brief Answer one SPI frame
+ * @param[in,out] sim Model state
+ * @param[in] frame 16-bit command frame
+ * @return uint16_t Response frame
+ */
+DRV8305_PUBLIC uint16_t drv8305_sim_transfer(drv8305_sim_t *sim, uint16_t frame);
+
+/**
+ * @brief Drive the EN_GATE pin
+ * @param[in,out] sim Model state
+ * @param[in] level true = high (gates enabled)
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_sim_set_en_gate(drv8305_sim_t *sim, bool level);
+
+/**
+ * @brief Drive the WAKE pin
+ * @param[in,out] sim Model state
+ * @param[in] level true = high (a rising edge wakes a sleeping device)
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_sim_set_wake(drv8305_sim_t *sim, bool level);
+
+/**
+ * @brief Read the nFAULT pin
+ * @param[in] sim Model state
+ * @return true when high (no fault latched), false when a fault is latched
+ */
+DRV8305_PUBLIC bool drv8305_sim_nfault(const drv8305_sim_t *sim);
+
+/**
+ * @brief Check whether the gate drivers switch
+ * @param[in] sim Model state
+ * @return true when EN_GATE is high, the device awake and no shutdown fault latched
+ */
+DRV8305_PUBLIC bool drv8305_sim_gates_active(const drv8305_sim_t *sim);
+
+/**
+ * @brief Word a read of address would return, without side effects
+ * @param[in] sim Model state
+ * @param[in] address Register address
+ * @return uint16_t Data bits 10:0
+ */
+DRV8305_PUBLIC uint16_t drv8305_sim_peek(const drv8305_sim_t *sim, uint16_t address);
+
+/**
+ * @brief Inject a fault now
+ * @param[in,out] sim Model state
+ * @param[in] action Injection action
+ * @param[in] address Register address the action applies to
+ * @param[in] bits Condition bits or XOR pattern (see drv8305_sim_step_t)
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_sim_inject(drv8305_sim_t *sim, drv8305_sim_action_e action, uint16_t address, uint16_t bits);
+
+/**
+ * @brief Load a timed fault injection script
+ * @param[in,out] sim Model state
+ * @param[in] script Steps sorted by time (kept by reference)
+ * @param[in] length Number of steps
+ * @return None
+ */
+DRV8305_PUBLIC void drv8305_sim_load_script(drv8305_sim_t *sim, const drv8305_sim_step_t *script, uint16_t length);
+
+/**
+ * @brief Advance the simulated clock by one millisecond and apply due script steps
+ * @param[in,out] sim Model state
+ * @return None
+ * @note Call once per drv8305_api_timer() call
+ */
+DRV8305_PUBLIC void drv8305_sim_tick(drv8305_sim_t *sim);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRV8305_SIMULATOR_H_ */
@@ -0,0 +1,208 @@
+/**
+ * @file drv8305_simulator_demo.c
+ * @brief DRV8305 Simulator Scenarios (Host)
+ * @details Runs the unmodified driver against the behavioral simulator through a scripted
+ *          fault sequence and checks how the driver and the device model react.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * Sequence:
+ *   1. Power-up: the configuration is programmed and confirmed, the register file holds it
+ *   2. VDS_HA pulse: protective shutdown (EN_GATE low), recovery with CLR_FLTS, EN_GATE re-armed
+ *   3. OTSD held: recovery latches out; released and unlatched, the driver recovers
+ *   4. Brown-out: reset words and PVDD_UVLO2; reset detection re-programs the registers
+ *   5. Upset in Control 0x0B: the background scrubber restores the word
+ *   6. Device model: SLEEP with EN_GATE low, SPI silent, WAKE edge restores reset words
+ *
+ * @usage
+ * drv8305_simulator_demo
+ * Exit code 0 when every check passes.
+ *
+ * @build
+ * Compile together with drv8305_simulator.c and every driver source except drv8305_app.c,
+ * from this directory:
+ *   gcc -std=c99 -O2 -I../../DRV8305_Driver drv8305_simulator_demo.c drv8305_simulator.c
+ *       <driver sources> -o drv8305_simulator_demo
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "drv8305_macros.h"
+#include "drv8305_register_map.h"
+#include "DRV8305_API/drv8305_api.h"
+#include "DRV8305_Status_Registers/drv8305_status_registers_definitions.h"
+#include "DRV8305_Status_Registers/drv8305_status_registers_handlers.h"
+#include "DRV8305_Control_Registers/drv8305_control_registers_definitions.h"
+#include "DRV8305_Control_Registers/drv8305_control_registers_handlers.h"
+#include "drv8305_simulator.h"
+
+/** @brief Simulated milliseconds allowed for each scenario phase */
+#define DEMO_PHASE_TICKS    (uint32_t)20000U
+
+DRV8305_PRIVATE void demo_run                (uint32_t ticks);
+DRV8305_PRIVATE bool demo_check              (bool condition, const char *what);
+DRV8305_PRIVATE bool demo_registers_programmed (void);
+
+DRV8305_PRIVATE drv8305_sim_t         demo_sim;
+DRV8305_PRIVATE drv8305_user_object_t demo_drv8305_obj;
+DRV8305_PRIVATE int                   demo_failures;
+
+/**@brief: Fault script, times in simulated milliseconds from power-up **/
+DRV8305_PRIVATE const drv8305_sim_step_t demo_script[] =
+{
+    {  5000, DRV8305_SIM_PULSE,     DRV8305_STATUS_02_REG_ADDR,  DRV8305_VDS_HA      },
+    { 25000, DRV8305_SIM_ASSERT,    DRV8305_STATUS_03_REG_ADDR,  DRV8305_IC_OTSD     },
+    { 85000, DRV8305_SIM_RELEASE,   DRV8305_STATUS_03_REG_ADDR,  DRV8305_IC_OTSD     },
+    {110000, DRV8305_SIM_BROWN_OUT, DRV8305_STATUS_03_REG_ADDR,  0                   },
+    {130000, DRV8305_SIM_CORRUPT,   DRV8305_CONTROL_0B_REG_ADDR, 0x0003U             },
+};
+
+DRV8305_PRIVATE const drv8305_status_register_cb_t demo_status_callbacks =
+{
+    .drv8305_warning_register_cb    = drv8305_warning_register_handler,
+    .drv8305_ov_vds_register_cb     = drv8305_ov_vds_register_handler,
+    .drv8305_ic_faults_register_cb  = drv8305_ic_faults_register_handler,
+    .drv8305_vgs_faults_register_cb = drv8305_vgs_faults_register_handler
+};
+
+DRV8305_PRIVATE const drv8305_control_register_cb_t demo_control_callbacks =
+{
+    .drv8305_hs_gate_drive_control_register_cb     = drv8305_hs_gate_drive_register_handler,
+    .drv8305_ls_gate_drive_control_register_cb     = drv8305_ls_gate_drive_register_handler,
+    .drv8305_gate_drive_control_register_cb        = drv8305_gate_drive_register_handler,
+    .drv8305_ic_operation_register_cb              = drv8305_ic_operation_register_handler,
+    .drv8305_shunt_amplifier_control_register_cb   = drv8305_shunt_amplifier_register_handler,
+    .drv8305_voltage_regulator_control_register_cb = drv8305_voltage_regulator_register_handler,
+    .drv8305_vds_sense_control_register_cb         = drv8305_vds_sense_register_handler
+};
+
+int main(void)
+{
+    drv8305_reset_detect_t reset_detect;
+    drv8305_scrubber_t     scrubber;
+    uint32_t               fault_clears;
+
+    drv8305_sim_init(&demo_sim);
+    drv8305_sim_load_script(&demo_sim, demo_script, (uint16_t)(sizeof(demo_script) / sizeof(demo_script[0])));
+
+    memset(&demo_drv8305_obj, 0, sizeof(demo_drv8305_obj));
+    demo_drv8305_obj.status_callbacks  = demo_status_callbacks;
+    demo_drv8305_obj.control_callbacks = demo_control_callbacks;
+    drv8305_sim_attach(&demo_sim, &demo_drv8305_obj.hw_callbacks);
+
+    drv8305_api_set_protection_policy(&demo_drv8305_obj, NULL, NULL, NULL);
+    drv8305_api_initialize(&demo_drv8305_obj);
+    drv8305_api_set_recovery_policy(&demo_drv8305_obj, NULL, true);
+
+    /* Differ from the reset words, so a device reset is visible in the readback */
+    drv8305_packed_set_gate_drive_dead_time(&demo_drv8305_obj.config, DRV8305_DEADTIME_88NS);
+    drv8305_packed_set_hs_gate_drive_isink(&demo_drv8305_obj.config, DRV8305_ISINK_250MA);
+    drv8305_api_confirm_configuration(&demo_drv8305_obj);
+
+    /* 1. Power-up */
+    demo_run(5000 - 1);
+    demo_check(drv8305_api_is_configuration_confirm(&demo_drv8305_obj), "power-up: configuration confirmed");
+    demo_check(demo_registers_programmed(), "power-up: register file holds the configuration");
+    demo_check(drv8305_sim_gates_active(&demo_sim), "power-up: gates active");
+
+    /* 2. VDS_HA pulse at 5 s */
+    demo_run(DEMO_PHASE_TICKS);
+    demo_check(demo_drv8305_obj.protection.shutdown_count >= 1, "vds pulse: protective shutdown");
+    demo_check(demo_sim.en_gate_falls >= 1, "vds pulse: EN_GATE driven low");
+    demo_check(demo_sim.fault_clears >= 1, "vds pulse: CLR_FLTS written");
+    demo_check(drv8305_api_get_recovery_status(&demo_drv8305_obj) == DRV8305_RECOVERY_IDLE, "vds pulse: recovery idle");
+    demo_check(drv8305_sim_gates_active(&demo_sim), "vds pulse: EN_GATE re-armed");
+
+    /* 3. OTSD held from 25 s to 85 s */
+    demo_run(60000);
+    demo_check(drv8305_api_get_recovery_status(&demo_drv8305_obj) == DRV8305_RECOVERY_LATCHED, "otsd held: recovery latched out");
+    demo_check(!drv8305_sim_nfault(&demo_sim), "otsd held: nFAULT low");
+
+    demo_run(85000 - demo_sim.time + 1);
+    fault_clears = demo_sim.fault_clears;
+    drv8305_api_recovery_unlatch(&demo_drv8305_obj);
+    demo_run(DEMO_PHASE_TICKS);
+    demo_check(demo_sim.fault_clears > fault_clears, "otsd released: CLR_FLTS written after unlatch");
+    demo_check(drv8305_sim_nfault(&demo_sim), "otsd released: nFAULT high");
+    demo_check(drv8305_api_get_recovery_status(&demo_drv8305_obj) == DRV8305_RECOVERY_IDLE, "otsd released: recovery idle");
+
+    /* 4. Brown-out at 110 s */
+    demo_run(110000 - demo_sim.time + DEMO_PHASE_TICKS / 2);
+    drv8305_api_get_reset_detect(&demo_drv8305_obj, &reset_detect);
+    demo_check(reset_detect.detections == 1, "brown-out: device reset detected");
+    demo_check(demo_registers_programmed(), "brown-out: register file re-programmed");
+
+    /* 5. Upset in 0x0B at 130 s */
+    drv8305_api_set_scrub_budget(&demo_drv8305_obj, 20);
+    demo_run(130000 - demo_sim.time + DEMO_PHASE_TICKS);
+    drv8305_api_get_scrubber(&demo_drv8305_obj, &scrubber);
+    demo_check(scrubber.mismatches >= 1, "upset: scrubber mismatch");
+    demo_check(demo_registers_programmed(), "upset: register file restored");
+
+    printf("{\"time\":%lu,\"frames\":%lu,\"fault_clears\":%lu,\"en_gate_falls\":%lu,\"shutdowns\":%lu,\"reset_detections\":%lu,\"scrub_mismatches\":%lu}\n",
+           (unsigned long)demo_sim.time, (unsigned long)demo_sim.frames, (unsigned long)demo_sim.fault_clears,
+           (unsigned long)demo_sim.en_gate_falls, (unsigned long)demo_drv8305_obj.protection.shutdown_count,
+           (unsigned long)reset_detect.detections, (unsigned long)scrubber.mismatches);
+
+    /* 6. Device model: sleep and wake */
+    drv8305_sim_set_en_gate(&demo_sim, false);
+    drv8305_sim_set_wake(&demo_sim, false);
+    drv8305_sim_transfer(&demo_sim, (uint16_t)((DRV8305_CONTROL_09_REG_ADDR << 11) | DRV8305_CTRL09_SLEEP_MASK));
+    demo_check(demo_sim.asleep, "model: SLEEP with EN_GATE low");
+    demo_check(drv8305_sim_transfer(&demo_sim, (uint16_t)(0x8000U | (DRV8305_CONTROL_05_REG_ADDR << 11))) == 0, "model: SPI silent while asleep");
+    drv8305_sim_set_wake(&demo_sim, true);
+    demo_check(!demo_sim.asleep, "model: WAKE edge wakes");
+    demo_check(drv8305_sim_peek(&demo_sim, DRV8305_CONTROL_05_REG_ADDR) == 0x0344U, "model: reset words after wake");
+
+    return (demo_failures == 0) ? 0 : 1;
+}
+
+/**
+ * @brief Run driver and model for a number of simulated milliseconds
+ * @param[in] ticks Simulated milliseconds
+ * @return None
+ */
+DRV8305_PRIVATE void demo_run(uint32_t ticks)
+{
+    for(uint32_t tick = 0; tick < ticks; tick++)
+    {
+        drv8305_api_master_sm_polling(&demo_drv8305_obj);
+        drv8305_api_timer(&demo_drv8305_obj);
+        drv8305_sim_tick(&demo_sim);
+    }
+}
+
+DRV8305_PRIVATE bool demo_check(bool condition, const char *what)
+{
+    if(!condition)
+    {
+        fprintf(stderr, "FAIL: %s\n", what);
+        demo_failures++;
+    }
+
+    return condition;
+}
+
+/**
+ * @brief Compare the model's register file with the words the driver programs
+ * @return true when every control register holds drv8305_api_get_control_word()
+ * @note CLR_FLTS is self-clearing and never reads back as written
+ */
+DRV8305_PRIVATE bool demo_registers_programmed(void)
+{
+    for(uint16_t index = DRV8305_CONTROL_05_ARRAY_INDEX; index <= DRV8305_CONTROL_0C_ARRAY_INDEX; index++)
+    {
+        uint16_t address = (uint16_t)demo_drv8305_obj.register_manager[index].type;
+        uint16_t ignore  = (address == DRV8305_CONTROL_09_REG_ADDR) ? (uint16_t)DRV8305_CTRL09_CLR_FLTS_MASK : 0U;
+
+        if(((drv8305_sim_peek(&demo_sim, address) ^ drv8305_api_get_control_word(&demo_drv8305_obj, index)) & (uint16_t)~ignore) != 0) { return false; }
+    }
+
+    return true;
+}
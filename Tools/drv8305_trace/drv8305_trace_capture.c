@@ -0,0 +1,122 @@
+/**
+ * @file drv8305_trace_capture.c
+ * @brief DRV8305 SPI Trace Capture (Host)
+ * @details Runs the driver, built with DRV8305_SPI_TRACE, against the behavioral simulator and
+ *          writes its SPI trace as a dump file for drv8305_trace_export.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * Cold start, configuration programming and status scans, with a VDS_HA pulse at 3 s so the
+ * protective shutdown and the CLR_FLTS recovery show up on the bus. The ring keeps the last
+ * DRV8305_TRACE_DEPTH frames.
+ *
+ * @usage
+ * drv8305_trace_capture <dump> [milliseconds]   (default: 10000 simulated ms)
+ *
+ * @build
+ * Compile with -DDRV8305_SPI_TRACE (a deeper ring, e.g. -DDRV8305_TRACE_DEPTH=1024, keeps the
+ * whole run) together with the simulator and every driver source except drv8305_app.c, or build
+ * the drv8305_trace_capture CMake target.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "drv8305_macros.h"
+#include "drv8305_register_map.h"
+#include "DRV8305_API/drv8305_api.h"
+#include "DRV8305_Trace/drv8305_trace.h"
+#include "DRV8305_Status_Registers/drv8305_status_registers_definitions.h"
+#include "DRV8305_Status_Registers/drv8305_status_registers_handlers.h"
+#include "DRV8305_Control_Registers/drv8305_control_registers_handlers.h"
+#include "drv8305_simulator.h"
+
+#if !defined(DRV8305_SPI_TRACE)
+#error "drv8305_trace_capture requires the driver built with DRV8305_SPI_TRACE"
+#endif
+
+/** @brief Simulated milliseconds captured when none are given */
+#define CAPTURE_DEFAULT_MS  (uint32_t)10000
+
+DRV8305_PRIVATE drv8305_sim_t         capture_sim;
+DRV8305_PRIVATE drv8305_user_object_t capture_drv8305_obj;
+DRV8305_PRIVATE uint16_t              capture_words[DRV8305_TRACE_DUMP_WORDS(DRV8305_TRACE_DEPTH)];
+
+DRV8305_PRIVATE const drv8305_sim_step_t capture_script[] =
+{
+    { 3000, DRV8305_SIM_PULSE, DRV8305_STATUS_02_REG_ADDR, DRV8305_VDS_HA },
+};
+
+DRV8305_PRIVATE const drv8305_status_register_cb_t capture_status_callbacks =
+{
+    .drv8305_warning_register_cb    = drv8305_warning_register_handler,
+    .drv8305_ov_vds_register_cb     = drv8305_ov_vds_register_handler,
+    .drv8305_ic_faults_register_cb  = drv8305_ic_faults_register_handler,
+    .drv8305_vgs_faults_register_cb = drv8305_vgs_faults_register_handler
+};
+
+DRV8305_PRIVATE const drv8305_control_register_cb_t capture_control_callbacks =
+{
+    .drv8305_hs_gate_drive_control_register_cb     = drv8305_hs_gate_drive_register_handler,
+    .drv8305_ls_gate_drive_control_register_cb     = drv8305_ls_gate_drive_register_handler,
+    .drv8305_gate_drive_control_register_cb        = drv8305_gate_drive_register_handler,
+    .drv8305_ic_operation_register_cb              = drv8305_ic_operation_register_handler,
+    .drv8305_shunt_amplifier_control_register_cb   = drv8305_shunt_amplifier_register_handler,
+    .drv8305_voltage_regulator_control_register_cb = drv8305_voltage_regulator_register_handler,
+    .drv8305_vds_sense_control_register_cb         = drv8305_vds_sense_register_handler
+};
+
+int main(int argc, char **argv)
+{
+    if(argc < 2)
+    {
+        fprintf(stderr, "usage: drv8305_trace_capture <dump> [milliseconds]\n");
+        return 2;
+    }
+
+    uint32_t duration = (argc > 2) ? (uint32_t)strtoul(argv[2], NULL, 0) : CAPTURE_DEFAULT_MS;
+
+    drv8305_sim_init(&capture_sim);
+    drv8305_sim_load_script(&capture_sim, capture_script, (uint16_t)(sizeof(capture_script) / sizeof(capture_script[0])));
+
+    memset(&capture_drv8305_obj, 0, sizeof(capture_drv8305_obj));
+    capture_drv8305_obj.status_callbacks  = capture_status_callbacks;
+    capture_drv8305_obj.control_callbacks = capture_control_callbacks;
+    drv8305_sim_attach(&capture_sim, &capture_drv8305_obj.hw_callbacks);
+
+    drv8305_api_set_protection_policy(&capture_drv8305_obj, NULL, NULL, NULL);
+    drv8305_api_initialize(&capture_drv8305_obj);
+    drv8305_api_set_recovery_policy(&capture_drv8305_obj, NULL, true);
+    drv8305_api_confirm_configuration(&capture_drv8305_obj);
+
+    for(uint32_t tick = 0; tick < duration; tick++)
+    {
+        drv8305_api_master_sm_polling(&capture_drv8305_obj);
+        drv8305_api_timer(&capture_drv8305_obj);
+        drv8305_sim_tick(&capture_sim);
+    }
+
+    uint32_t word_count = drv8305_api_export_trace(&capture_drv8305_obj, capture_words, (uint32_t)(sizeof(capture_words) / sizeof(capture_words[0])));
+    FILE    *file       = fopen(argv[1], "wb");
+
+    if(!file) { perror(argv[1]); return 1; }
+
+    for(uint32_t index = 0; index < word_count; index++)
+    {
+        fputc(capture_words[index] & 0xFF, file);
+        fputc(capture_words[index] >> 8, file);
+    }
+
+    fclose(file);
+
+    printf("{\"frames\":%lu,\"recorded\":%u,\"simulated_ms\":%lu}\n", (unsigned long)capture_sim.frames,
+           (unsigned)capture_words[2], (unsigned long)capture_sim.time);
+
+    return (capture_words[2] != 0) ? 0 : 1;
+}
@@ -0,0 +1,267 @@
+/**
+ * @file drv8305_trace_export.c
+ * @brief DRV8305 SPI Trace Exporter (Host)
+ * @details Converts an SPI trace dump (drv8305_trace.h) to Perfetto / Chrome JSON or to a VCD
+ *          waveform, so frames, bus utilization and gaps show up in a timeline viewer.
+ * @author Furkan YAYLA
+ * @email yaylafurkan@protonmail.com
+ * @date October 2026
+ * @version 1.0
+ *
+ * @purpose
+ * Commands:
+ *   perfetto <dump> <json> [spi_hz]   Chrome trace event JSON (ui.perfetto.dev, chrome://tracing)
+ *   vcd <dump> <vcd> [spi_hz]         Value change dump (GTKWave, PulseView, Surfer)
+ *
+ * @timeline
+ *   - A frame starts at its timestamp and lasts 16 SPI clocks (spi_hz, default 1 MHz)
+ *   - Timestamps are unwrapped across 32-bit overflow; a frame that would start before the
+ *     previous one ended (coarse timestamps) is moved to one SPI clock after it
+ *   - Perfetto: thread "SPI" holds one slice per frame ("R 0x02", "W 0x09" with tx, rx, data
+ *     and state args), thread "Driver state" one slice per main state run
+ *   - VCD: cs_n, tx, rx, address, read, main_state and sub_state, 1 ns timescale
+ *
+ * @dump_file
+ * The dump words, each written as two octets, low octet first (drv8305_trace_capture, or a
+ * memory save of the drv8305_api_export_trace() buffer).
+ *
+ * @build
+ * From this directory:
+ *   gcc -std=c99 -O2 -I../../DRV8305_Driver drv8305_trace_export.c
+ *       ../../DRV8305_Driver/DRV8305_Trace/drv8305_trace.c -o drv8305_trace_export
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "drv8305_macros.h"
+#include "DRV8305_API/drv8305_api.h"
+#include "DRV8305_Trace/drv8305_trace.h"
+
+/** @brief SPI clock assumed when none is given */
+#define EXPORT_DEFAULT_SPI_HZ  (uint32_t)1000000
+/** @brief Clocks per DRV8305 frame */
+#define EXPORT_FRAME_CLOCKS    (uint64_t)16
+/** @brief Largest dump accepted (65535 records) */
+#define EXPORT_MAX_WORDS       DRV8305_TRACE_DUMP_WORDS(0xFFFFU)
+
+/**
+ * @brief One frame placed on the timeline
+ */
+typedef struct
+{
+    uint64_t               start_ns;
+    drv8305_trace_record_t record;
+} export_frame_t;
+
+DRV8305_PRIVATE int         export_load       (const char *dump_path, uint32_t spi_hz);
+DRV8305_PRIVATE int         export_perfetto   (FILE *file);
+DRV8305_PRIVATE int         export_vcd        (FILE *file);
+DRV8305_PRIVATE void        export_vcd_bits   (FILE *file, uint16_t value, int width, char id);
+DRV8305_PRIVATE const char *export_state_name (uint16_t state);
+DRV8305_PRIVATE int         export_usage      (void);
+
+DRV8305_PRIVATE export_frame_t *export_frames;
+DRV8305_PRIVATE uint16_t        export_count;
+DRV8305_PRIVATE uint64_t        export_frame_ns;
+
+DRV8305_PRIVATE const char *const export_state_names[] =
+{
+    "init", "idle", "status", "control", "recovery", "delay"
+};
+
+int main(int argc, char **argv)
+{
+    if(argc < 4 || argc > 5) { return export_usage(); }
+
+    bool perfetto = (strcmp(argv[1], "perfetto") == 0);
+
+    if(!perfetto && strcmp(argv[1], "vcd") != 0) { return export_usage(); }
+
+    uint32_t spi_hz = (argc > 4) ? (uint32_t)strtoul(argv[4], NULL, 0) : EXPORT_DEFAULT_SPI_HZ;
+
+    if(spi_hz == 0 || export_load(argv[2], spi_hz) != 0) { return 1; }
+
+    FILE *file = fopen(argv[3], "w");
+
+    if(!file) { perror(argv[3]); free(export_frames); return 1; }
+
+    int result = perfetto ? export_perfetto(file) : export_vcd(file);
+
+    fclose(file);
+    free(export_frames);
+
+    return result;
+}
+
+/**
+ * @brief Read a dump and place its frames on the nanosecond timeline
+ * @param[in] dump_path Dump file
+ * @param[in] spi_hz SPI clock
+ * @return int 0 on success
+ */
+DRV8305_PRIVATE int export_load(const char *dump_path, uint32_t spi_hz)
+{
+    FILE *file = fopen(dump_path, "rb");
+
+    if(!file) { perror(dump_path); return 1; }
+
+    uint16_t *words      = malloc(EXPORT_MAX_WORDS * sizeof(uint16_t));
+    uint32_t  word_count = 0;
+    int       low, high;
+
+    if(!words) { fclose(file); return 1; }
+
+    while(word_count < EXPORT_MAX_WORDS && (low = fgetc(file)) != EOF && (high = fgetc(file)) != EOF)
+    {
+        words[word_count++] = (uint16_t)((uint16_t)low | ((uint16_t)high << 8));
+    }
+
+    fclose(file);
+
+    drv8305_trace_dump_header_t header;
+
+    if(!drv8305_trace_dump_header(words, word_count, &header))
+    {
+        fprintf(stderr, "%s: not a DRV8305 trace dump\n", dump_path);
+        free(words);
+        return 1;
+    }
+
+    export_count    = header.count;
+    export_frame_ns = EXPORT_FRAME_CLOCKS * 1000000000ULL / spi_hz;
+    export_frames   = calloc((header.count != 0) ? header.count : 1, sizeof(export_frame_t));
+
+    if(!export_frames) { free(words); return 1; }
+
+    uint64_t wraps = 0, bit_ns = 1000000000ULL / spi_hz, end_ns = 0;
+    uint32_t previous = 0;
+
+    for(uint16_t index = 0; index < header.count; index++)
+    {
+        export_frame_t *frame = &export_frames[index];
+
+        drv8305_trace_dump_record(words, index, &frame->record);
+
+        if(index != 0 && frame->record.timestamp < previous) { wraps += 1ULL << 32; }
+        previous = frame->record.timestamp;
+
+        frame->start_ns = (wraps + frame->record.timestamp) * 1000000000ULL / header.timestamp_hz;
+
+        if(index != 0 && frame->start_ns < end_ns + bit_ns) { frame->start_ns = end_ns + bit_ns; }
+        end_ns = frame->start_ns + export_frame_ns;
+    }
+
+    free(words);
+
+    return 0;
+}
+
+/**
+ * @brief Write Chrome trace event JSON
+ * @param[in] file Output file
+ * @return int 0 on success
+ */
+DRV8305_PRIVATE int export_perfetto(FILE *file)
+{
+    fprintf(file, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+    fprintf(file, "{\"ph\":\"M\",\"pid\":1,\"name\":\"process_name\",\"args\":{\"name\":\"DRV8305\"}},\n");
+    fprintf(file, "{\"ph\":\"M\",\"pid\":1,\"tid\":1,\"name\":\"thread_name\",\"args\":{\"name\":\"SPI\"}},\n");
+    fprintf(file, "{\"ph\":\"M\",\"pid\":1,\"tid\":2,\"name\":\"thread_name\",\"args\":{\"name\":\"Driver state\"}}");
+
+    uint16_t run_start = 0;
+
+    for(uint16_t index = 0; index < export_count; index++)
+    {
+        const export_frame_t *frame = &export_frames[index];
+        uint16_t              tx    = frame->record.tx;
+
+        fprintf(file, ",\n{\"ph\":\"X\",\"pid\":1,\"tid\":1,\"name\":\"%c 0x%02X\",\"ts\":%.3f,\"dur\":%.3f,"
+                      "\"args\":{\"tx\":\"0x%04X\",\"rx\":\"0x%04X\",\"data\":\"0x%03X\",\"state\":\"%s\",\"sub_state\":%u}}",
+                DRV8305_TRACE_FRAME_IS_READ(tx) ? 'R' : 'W', DRV8305_TRACE_FRAME_ADDRESS(tx),
+                (double)frame->start_ns / 1000.0, (double)export_frame_ns / 1000.0,
+                tx, frame->record.rx, frame->record.rx & DRV8305_REGISTER_DATA_MASK,
+                export_state_name(frame->record.state), DRV8305_TRACE_SUB_STATE(frame->record.state));
+
+        /* One state slice per run of frames in the same main state */
+        bool last = (index + 1 == export_count);
+
+        if(last || DRV8305_TRACE_MAIN_STATE(export_frames[index + 1].record.state) != DRV8305_TRACE_MAIN_STATE(frame->record.state))
+        {
+            uint64_t start = export_frames[run_start].start_ns;
+            uint64_t end   = last ? frame->start_ns + export_frame_ns : export_frames[index + 1].start_ns;
+
+            fprintf(file, ",\n{\"ph\":\"X\",\"pid\":1,\"tid\":2,\"name\":\"%s\",\"ts\":%.3f,\"dur\":%.3f}",
+                    export_state_name(frame->record.state), (double)start / 1000.0, (double)(end - start) / 1000.0);
+
+            run_start = (uint16_t)(index + 1);
+        }
+    }
+
+    fprintf(file, "\n]}\n");
+
+    return 0;
+}
+
+/**
+ * @brief Write a value change dump
+ * @param[in] file Output file
+ * @return int 0 on success
+ */
+DRV8305_PRIVATE int export_vcd(FILE *file)
+{
+    fprintf(file, "$version drv8305_trace_export $end\n$timescale 1ns $end\n$scope module drv8305 $end\n");
+    fprintf(file, "$var wire 1 c cs_n $end\n$var wire 16 t tx $end\n$var wire 16 r rx $end\n");
+    fprintf(file, "$var wire 4 a address $end\n$var wire 1 w read $end\n");
+    fprintf(file, "$var wire 8 m main_state $end\n$var wire 8 s sub_state $end\n");
+    fprintf(file, "$upscope $end\n$enddefinitions $end\n");
+    fprintf(file, "#0\n$dumpvars\n1c\nbx t\nbx r\nbx a\nxw\nbx m\nbx s\n$end\n");
+
+    for(uint16_t index = 0; index < export_count; index++)
+    {
+        const export_frame_t *frame = &export_frames[index];
+        uint16_t              tx    = frame->record.tx;
+
+        if(frame->start_ns != 0) { fprintf(file, "#%llu\n", (unsigned long long)frame->start_ns); }
+
+        fprintf(file, "0c\n");
+        export_vcd_bits(file, tx, 16, 't');
+        export_vcd_bits(file, frame->record.rx, 16, 'r');
+        export_vcd_bits(file, DRV8305_TRACE_FRAME_ADDRESS(tx), 4, 'a');
+        fprintf(file, "%cw\n", DRV8305_TRACE_FRAME_IS_READ(tx) ? '1' : '0');
+        export_vcd_bits(file, DRV8305_TRACE_MAIN_STATE(frame->record.state), 8, 'm');
+        export_vcd_bits(file, DRV8305_TRACE_SUB_STATE(frame->record.state), 8, 's');
+        fprintf(file, "#%llu\n1c\n", (unsigned long long)(frame->start_ns + export_frame_ns));
+    }
+
+    return 0;
+}
+
+DRV8305_PRIVATE void export_vcd_bits(FILE *file, uint16_t value, int width, char id)
+{
+    fputc('b', file);
+
+    for(int bit = width - 1; bit >= 0; bit--)
+    {
+        fputc(((value >> bit) & 1U) ? '1' : '0', file);
+    }
+
+    fprintf(file, " %c\n", id);
+}
+
+DRV8305_PRIVATE const char *export_state_name(uint16_t state)
+{
+    uint16_t main_state = DRV8305_TRACE_MAIN_STATE(state);
+
+    return (main_state < sizeof(export_state_names) / sizeof(export_state_names[0])) ? export_state_names[main_state] : "unknown";
+}
+
+DRV8305_PRIVATE int export_usage(void)
+{
+    fprintf(stderr, "usage: drv8305_trace_export perfetto <dump> <json> [spi_hz]\n"
+                    "       drv8305_trace_export vcd <dump> <vcd> [spi_hz]\n");
+    return 2;
+}